@@ -0,0 +1,408 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2017 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+/* eslint-env es6, node */
+
+'use strict';
+
+// Headless benchmarks for the hot paths of the Node binding.
+//
+//   node index.js [--sizes 10000,100000,1000000] [--iterations 5] [--only name,...]
+//                 [--output results.json] [--call-stats]
+//
+// Every scenario runs against a fresh Realm filled with the same deterministic data, once
+// untimed to warm up and then `iterations` times. The results are written as JSON to stdout
+// (or to --output) so that a CI job can keep them and compare runs; progress goes to stderr.
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+
+const Realm = require('realm');
+
+const ItemSchema = {
+    name: 'Item',
+    properties: {
+        id: 'int',
+        name: 'string',
+        value: 'double',
+        flag: 'bool',
+    }
+};
+
+const ItemListSchema = {
+    name: 'ItemList',
+    properties: {
+        items: {type: 'list', objectType: 'Item'},
+    }
+};
+
+const BlobSchema = {
+    name: 'Blob',
+    properties: {
+        id: 'int',
+        data: 'data',
+    }
+};
+
+const schema = [ItemSchema, ItemListSchema, BlobSchema];
+const blobSize = 64;
+
+function makeItem(i) {
+    return {
+        id: i,
+        name: 'item ' + (i % 1000),
+        value: (i * 7919) % 10007 / 10,
+        flag: i % 2 === 0,
+    };
+}
+
+function makeItems(count) {
+    const items = new Array(count);
+    for (let i = 0; i < count; i++) {
+        items[i] = makeItem(i);
+    }
+    return items;
+}
+
+function makeBlob(i) {
+    const data = new Uint8Array(blobSize);
+    for (let j = 0; j < blobSize; j++) {
+        data[j] = (i + j) & 0xff;
+    }
+    return data.buffer;
+}
+
+function fillItems(realm, size) {
+    const items = makeItems(size);
+    realm.write(() => realm.createMany('Item', items));
+}
+
+// Each scenario has an optional untimed `setup(realm, size)` and a timed `run(realm, size, state)`,
+// which may return a promise. `state` is whatever `setup` returned.
+const scenarios = [
+    {
+        name: 'create',
+        run(realm, size) {
+            realm.write(() => {
+                for (let i = 0; i < size; i++) {
+                    realm.create('Item', makeItem(i));
+                }
+            });
+        }
+    },
+    {
+        name: 'createMany',
+        setup(realm, size) {
+            return makeItems(size);
+        },
+        run(realm, size, items) {
+            realm.write(() => realm.createMany('Item', items));
+        }
+    },
+    {
+        name: 'propertyRead',
+        setup(realm, size) {
+            fillItems(realm, size);
+            return realm.objects('Item');
+        },
+        run(realm, size, objects) {
+            let sum = 0;
+            for (let i = 0; i < size; i++) {
+                const item = objects[i];
+                sum += item.id + item.value + item.name.length + (item.flag ? 1 : 0);
+            }
+            return sum;
+        }
+    },
+    {
+        name: 'resultsIteration',
+        setup(realm, size) {
+            fillItems(realm, size);
+            return realm.objects('Item');
+        },
+        run(realm, size, objects) {
+            let count = 0;
+            for (const item of objects) {
+                if (item) {
+                    count++;
+                }
+            }
+            return count;
+        }
+    },
+    {
+        name: 'filteredSorted',
+        setup(realm, size) {
+            fillItems(realm, size);
+            return realm.objects('Item');
+        },
+        run(realm, size, objects) {
+            const results = objects.filtered('value > 500 AND flag == true').sorted('value', true);
+            return results.length && results[0].id;
+        }
+    },
+    {
+        name: 'listMutation',
+        setup(realm, size) {
+            fillItems(realm, size);
+            let list;
+            realm.write(() => {
+                list = realm.create('ItemList', {items: []});
+            });
+            return {list: list.items, objects: realm.objects('Item')};
+        },
+        run(realm, size, state) {
+            realm.write(() => {
+                const list = state.list;
+                for (let i = 0; i < size; i++) {
+                    list.push(state.objects[i]);
+                }
+                list.splice(0, size / 2);
+                while (list.length) {
+                    list.pop();
+                }
+            });
+        }
+    },
+    {
+        name: 'notifications',
+        setup(realm, size) {
+            fillItems(realm, size);
+            const objects = realm.objects('Item');
+            // Wait for the initial notification so it isn't counted against the first write.
+            return new Promise((resolve) => {
+                const listener = () => {
+                    objects.removeListener(listener);
+                    resolve(objects);
+                };
+                objects.addListener(listener);
+            });
+        },
+        run(realm, size, objects) {
+            return new Promise((resolve) => {
+                const listener = (collection, changes) => {
+                    if (changes.modifications.length) {
+                        objects.removeListener(listener);
+                        resolve();
+                    }
+                };
+                objects.addListener(listener);
+                realm.write(() => {
+                    for (let i = 0; i < size; i += 10) {
+                        objects[i].value = -objects[i].value;
+                    }
+                });
+            });
+        }
+    },
+    {
+        name: 'binaryIO',
+        setup(realm, size) {
+            const blobs = new Array(size);
+            for (let i = 0; i < size; i++) {
+                blobs[i] = {id: i, data: makeBlob(i)};
+            }
+            return blobs;
+        },
+        run(realm, size, blobs) {
+            realm.write(() => realm.createMany('Blob', blobs));
+
+            let checksum = 0;
+            const objects = realm.objects('Blob');
+            for (let i = 0; i < size; i++) {
+                checksum += new Uint8Array(objects[i].data)[0];
+            }
+            return checksum;
+        }
+    },
+];
+
+function parseArguments(argv) {
+    const options = {
+        sizes: [10000, 100000, 1000000],
+        iterations: 5,
+        only: null,
+        output: null,
+        callStats: false,
+    };
+
+    for (let i = 0; i < argv.length; i++) {
+        const arg = argv[i];
+        switch (arg) {
+        case '--sizes':
+            options.sizes = argv[++i].split(',').map(Number);
+            break;
+        case '--iterations':
+            options.iterations = Number(argv[++i]);
+            break;
+        case '--only':
+            options.only = argv[++i].split(',');
+            break;
+        case '--output':
+            options.output = argv[++i];
+            break;
+        case '--call-stats':
+            options.callStats = true;
+            break;
+        default:
+            throw new Error(`Unknown argument '${arg}'`);
+        }
+    }
+
+    if (options.sizes.some((size) => !(size > 0)) || !(options.iterations > 0)) {
+        throw new Error('Sizes and iterations must be positive numbers');
+    }
+    return options;
+}
+
+function removeRecursively(target) {
+    if (!fs.existsSync(target)) {
+        return;
+    }
+    if (fs.lstatSync(target).isDirectory()) {
+        fs.readdirSync(target).forEach((name) => removeRecursively(path.join(target, name)));
+        fs.rmdirSync(target);
+    }
+    else {
+        fs.unlinkSync(target);
+    }
+}
+
+function elapsedMilliseconds(start) {
+    const elapsed = process.hrtime(start);
+    return elapsed[0] * 1e3 + elapsed[1] / 1e6;
+}
+
+function median(values) {
+    const sorted = values.slice().sort((a, b) => a - b);
+    const middle = sorted.length >> 1;
+    return sorted.length % 2 ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2;
+}
+
+// Runs the scenario once against a new Realm and resolves to the duration of `run` in milliseconds.
+function runOnce(directory, scenario, size, index) {
+    const realmPath = path.join(directory, `${scenario.name}-${size}-${index}.realm`);
+    const realm = new Realm({path: realmPath, schema: schema});
+    let start;
+
+    return Promise.resolve(scenario.setup ? scenario.setup(realm, size) : undefined)
+        .then((state) => {
+            start = process.hrtime();
+            return scenario.run(realm, size, state);
+        })
+        .then(() => {
+            const duration = elapsedMilliseconds(start);
+            realm.close();
+            return duration;
+        }, (error) => {
+            realm.close();
+            throw error;
+        });
+}
+
+function runScenario(directory, scenario, size, options) {
+    const times = [];
+    let callStats;
+
+    // The first run only warms up the caches and the JIT.
+    let run = runOnce(directory, scenario, size, 0);
+    for (let i = 1; i <= options.iterations; i++) {
+        run = run.then((time) => {
+            if (i > 1) {
+                times.push(time);
+            }
+            // Only the last run is counted, so the call stats describe a single run (setup included).
+            if (options.callStats && i == options.iterations) {
+                Realm.collectCallStats = true;
+            }
+            return runOnce(directory, scenario, size, i);
+        });
+    }
+
+    return run.then((time) => {
+        times.push(time);
+        if (options.callStats) {
+            callStats = Realm.callStats;
+            Realm.collectCallStats = false;
+        }
+
+        const result = {
+            name: scenario.name,
+            size: size,
+            iterations: times.length,
+            times: times,
+            min: Math.min.apply(Math, times),
+            median: median(times),
+            opsPerSecond: size / (median(times) / 1000),
+        };
+        if (callStats) {
+            result.callStats = callStats;
+        }
+        return result;
+    });
+}
+
+function main() {
+    const options = parseArguments(process.argv.slice(2));
+    const selected = scenarios.filter((scenario) => !options.only || options.only.indexOf(scenario.name) != -1);
+    const directory = fs.mkdtempSync(path.join(os.tmpdir(), 'realm-benchmarks-'));
+    const results = [];
+
+    let run = Promise.resolve();
+    options.sizes.forEach((size) => {
+        selected.forEach((scenario) => {
+            run = run
+                .then(() => runScenario(directory, scenario, size, options))
+                .then((result) => {
+                    results.push(result);
+                    console.error(`${result.name} (${result.size}): ${result.median.toFixed(2)} ms median, ${result.min.toFixed(2)} ms min`);
+                });
+        });
+    });
+
+    return run
+        .then(() => {
+            const report = {
+                realm: require('realm/package.json').version,
+                node: process.version,
+                platform: process.platform,
+                arch: process.arch,
+                cpus: os.cpus().length ? os.cpus()[0].model : undefined,
+                date: new Date().toISOString(),
+                iterations: options.iterations,
+                results: results,
+            };
+            const json = JSON.stringify(report, null, 2);
+            if (options.output) {
+                fs.writeFileSync(options.output, json + '\n');
+            }
+            else {
+                console.log(json);
+            }
+        })
+        .then(() => removeRecursively(directory), (error) => {
+            removeRecursively(directory);
+            throw error;
+        });
+}
+
+main().catch((error) => {
+    console.error(error.stack || error);
+    process.exit(1);
+});
@@ -15,10 +15,12 @@
       ],
       "sources": [
         "src/node/platform.cpp",
-        "src/js_realm.cpp"
+        "src/js_realm.cpp",
+        "vendor/base64.cpp"
       ],
       "include_dirs": [
-        "src"
+        "src",
+        "vendor"
       ],
       "conditions": [
         ["realm_node_build_as_library", {
@@ -18,6 +18,12 @@
 
 /**
  * Abstract base class containing methods shared by {@link Realm.List} and {@link Realm.Results}.
+ *
+ * Iterators and the `every`, `some`, `forEach`, `find`, `findIndex`, `map`, `filter` and
+ * `reduce` methods read objects from the collection in chunks, up to 256 ahead of the one being
+ * visited, except within a write transaction. If the Realm begins a write transaction, advances to
+ * a newer version or is closed before they are visited, e.g. from the callback, the objects read
+ * ahead are dropped and those that are then at their indexes are read again from the collection.
  * @memberof Realm
  * @since 0.11.0
  */
@@ -61,6 +67,32 @@ class Collection {
      */
     sorted(descriptor, reverse) {}
 
+    /**
+     * Like {@link Realm.Collection#filtered filtered}, but the query is evaluated on a background
+     * thread instead of when the returned _Results_ are first read.
+     * @param {string} query - Query used to filter objects from the collection.
+     * @param {...any} [arg] - Each subsequent argument is used by the placeholders
+     *   (e.g. `$0`, `$1`, `$2`, …) in the query.
+     * @throws {Error} If the query or any other argument passed into this method is invalid.
+     * @returns {Promise<Realm.Results>} resolved once the query has been evaluated, or rejected if
+     *   the collection is invalidated first, such as by closing the Realm.
+     * @since 1.12.0
+     */
+    filteredAsync(query, ...arg) {}
+
+    /**
+     * Like {@link Realm.Collection#sorted sorted}, but the sort is evaluated on a background
+     * thread instead of when the returned _Results_ are first read.
+     * @param {string|Realm.Results~SortDescriptor[]} descriptor - The property name(s) to sort
+     *   the objects in the collection.
+     * @param {boolean} [reverse=false] - May only be provided if `descriptor` is a string.
+     * @throws {Error} If a specified property does not exist.
+     * @returns {Promise<Realm.Results>} resolved once the sort has been evaluated, or rejected if
+     *   the collection is invalidated first, such as by closing the Realm.
+     * @since 1.12.0
+     */
+    sortedAsync(descriptor, reverse) {}
+
     /**
      * Create a frozen snapshot of the collection. This means objects added to and removed from the
      * original collection will not be reflected in the _Results_ returned by this method.
@@ -71,6 +103,76 @@ class Collection {
      */
     snapshot() {}
 
+    /**
+     * Reads the given properties of every object in the collection in a single call, without
+     * creating a {@link Realm.Object} for each of them.
+     * Properties of type `int`, `float`, `double` and `date` are returned as a `Float64Array`
+     * (dates as milliseconds since the epoch, and `NaN` for `null`), while `bool` and `string`
+     * properties are returned as arrays.
+     * @param {string[]} properties - The names of the properties to read.
+     * @throws {Error} If a property does not exist or is of a type that cannot be read as a column.
+     * @returns {Object} mapping each property name to the values of that property, in the order
+     *   of the collection.
+     * @since 1.12.0
+     * @example
+     * let {vintage, price} = wines.toColumns(['vintage', 'price']);
+     */
+    toColumns(properties) {}
+
+    /**
+     * Computes the minimum value of a property over all objects in the collection.
+     * @param {string} property - The name of an `int`, `float`, `double` or `date` property.
+     * @throws {Error} If the property does not exist or is of an unsupported type.
+     * @returns {number|Date|undefined} the minimum value, or `undefined` if the collection is
+     *   empty or the property is `null` for all of its objects.
+     * @since 1.12.0
+     */
+    min(property) {}
+
+    /**
+     * Computes the maximum value of a property over all objects in the collection.
+     * @param {string} property - The name of an `int`, `float`, `double` or `date` property.
+     * @throws {Error} If the property does not exist or is of an unsupported type.
+     * @returns {number|Date|undefined} the maximum value, or `undefined` if the collection is
+     *   empty or the property is `null` for all of its objects.
+     * @since 1.12.0
+     */
+    max(property) {}
+
+    /**
+     * Computes the sum of a property over all objects in the collection, ignoring `null` values.
+     * @param {string} property - The name of an `int`, `float` or `double` property.
+     * @throws {Error} If the property does not exist or is of an unsupported type.
+     * @returns {number} the sum, which is `0` for an empty collection.
+     * @since 1.12.0
+     */
+    sum(property) {}
+
+    /**
+     * Computes the average of a property over all objects in the collection, ignoring `null` values.
+     * @param {string} property - The name of an `int`, `float` or `double` property.
+     * @throws {Error} If the property does not exist or is of an unsupported type.
+     * @returns {number|undefined} the average, or `undefined` if there are no values to average.
+     * @since 1.12.0
+     */
+    avg(property) {}
+
+    /**
+     * Groups the objects in the collection by the value of a property and computes an aggregate
+     * for each group, without creating a {@link Realm.Object} for any of them.
+     * @param {string} keyProperty - The name of a `bool`, `int`, `string` or `date` property to
+     *   group by.
+     * @param {string} [aggregate="count"] - One of `"count"`, `"min"`, `"max"`, `"sum"` or `"avg"`.
+     * @param {string} [property] - The name of the `int`, `float` or `double` property to
+     *   aggregate. Required unless `aggregate` is `"count"`.
+     * @throws {Error} If a property does not exist or is of an unsupported type.
+     * @returns {Array} of `[key, value]` pairs, one per distinct key and ordered by key.
+     * @since 1.12.0
+     * @example
+     * let totals = new Map(transactions.groupBy('category', 'sum', 'amount'));
+     */
+    groupBy(keyProperty, aggregate, property) {}
+
     /**
      * @see {@link https://developer.mozilla.org/en-US/docs/Web/JavaScript/Reference/Global_Objects/Array/entries Array.prototype.entries}
      * @returns {Realm.Collection~Iterator} of each `[index, object]` pair in the collection
@@ -128,11 +230,48 @@ class Collection {
      *   index will be include in the return value. If negative, then the end index will be
      *   counted from the end of the collection. If omitted, then all objects from the start
      *   index will be included in the return value.
-     * @returns {Realm.Object[]} containing the objects from the start index up to, but not
+     * @param {string[]} [properties] - If given, each object is returned as a plain object
+     *   holding only these properties, which is cheaper than creating a {@link Realm.Object}
+     *   when only a few properties are displayed. _Available since 1.12.0._
+     * @returns {Realm.Object[]|Object[]} containing the objects from the start index up to, but not
      *   including, the end index.
      * @since 0.11.0
+     * @example
+     * // Render a window of rows, then re-read only the rows that a change touched.
+     * let rows = transactions.slice(first, first + 50, ['date', 'amount']);
+     * transactions.addListener((collection, changes) => {
+     *     changes.modifications.filter(i => i >= first && i < first + 50).forEach(i => {
+     *         rows[i - first] = collection.slice(i, i + 1, ['date', 'amount'])[0];
+     *     });
+     * });
      */
-    slice(start, end) {}
+    slice(start, end, properties) {}
+
+    /**
+     * Create a plain array of the objects in this collection, or of a part of it. This is the
+     * same as {@link Realm.Collection#slice slice()}, and unlike `Array.from()` or spreading it
+     * reads all those objects in one native call.
+     * @param {number} [start=0] - The start index.
+     * @param {number} [end] - The end index, which is not included. Defaults to the length.
+     * @returns {Realm.Object[]} containing the objects from the start index up to, but not
+     *   including, the end index.
+     * @since 1.12.0
+     */
+    toArray(start, end) {}
+
+    /**
+     * Copy objects from this collection into plain JavaScript objects in a single call, in the
+     * same way as {@link Realm.Object#toJSON toJSON()}.
+     * @param {number} [start=0] - The start index.
+     * @param {number} [end] - The end index, which is not included. Defaults to the length.
+     * @param {Realm.Object~ToJSONOptions} [options]
+     * @returns {Object[]} the plain objects, from the start index up to, but not including, the
+     *   end index.
+     * @since 1.12.0
+     * @example
+     * store.dispatch({type: 'MESSAGES', messages: messages.toPlainArray(0, 50, {depth: 1})});
+     */
+    toPlainArray(start, end, options) {}
 
     /**
      * @see {@link https://developer.mozilla.org/en-US/docs/Web/JavaScript/Reference/Global_Objects/Array/find Array.prototype.find}
@@ -166,6 +305,7 @@ class Collection {
 
    /**
     Finds the index of the given object in the collection.
+    Repeated lookups in a collection that hasn't changed in between take constant time.
     * @param {Realm.Object} [object] - The object to search for in the collection.
     * @throws {Error} If the argument does not belong to the realm.
     * @returns {number} representing the index where the object was found, or `-1`
@@ -174,6 +314,25 @@ class Collection {
     */
    indexOf(object) {}
 
+   /**
+    * Checks whether the given object is in the collection, in the same way as
+    * {@link Realm.Collection#indexOf indexOf}.
+    * @param {Realm.Object} object - The object to search for in the collection.
+    * @throws {Error} If the argument does not belong to the realm.
+    * @returns {boolean} whether the object was found.
+    * @since 1.12.0
+    */
+   includes(object) {}
+
+   /**
+    * Checks whether the collection has no objects. For _Results_ that haven't been read yet this
+    * stops at the first object that matches the query, without evaluating the rest of it, and the
+    * answer is remembered until the Realm changes.
+    * @returns {boolean} whether the collection is empty.
+    * @since 1.12.0
+    */
+   isEmpty() {}
+
     /**
      * @see {@link https://developer.mozilla.org/en-US/docs/Web/JavaScript/Reference/Global_Objects/Array/forEach Array.prototype.forEach}
      * @param {function} callback - Function to execute on each object in the collection.
@@ -278,8 +437,30 @@ class Collection {
      *   The callback function is called with two arguments:
      *   - `collection`: the collection instance that changed,
      *   - `changes`: a dictionary with keys `insertions`, `modifications` and `deletions`,
-     *      each containing a list of indices that were inserted, updated or deleted respectively.
-     * @throws {Error} If `callback` is not a function.
+     *      each containing a list of indices that were inserted, updated or deleted respectively,
+     *      and `modifiedProperties`, which maps the name of each changed property to the indices
+     *      of the objects where it changed.
+     * @param {Object} [options]
+     * @param {string} [options.format='indexes'] - How the lists of indices are delivered:
+     *   - `'indexes'`: arrays of numbers,
+     *   - `'typed'`: `Uint32Array`s, which are much cheaper for large change sets,
+     *   - `'ranges'`: arrays of `[start, count]` pairs, one per contiguous run of indices.
+     *   Available since 1.12.0.
+     * @param {string[]} [options.properties] - Only report modifications of these properties. Changes
+     *   that only touch other properties don't call `callback`. Available since 1.12.0.
+     * @param {string} [options.priority='default'] - When `callback` is called after a change,
+     *   relative to the other listeners of collections in the same Realm:
+     *   - `'high'`: right away, such as for the collection shown on screen,
+     *   - `'default'`: right away, unless there are `'high'` listeners, which then run first and
+     *     leave these for the next turn of the event loop,
+     *   - `'low'`: after the others, a few milliseconds' worth of listeners per turn of the event
+     *     loop, so that many background listeners don't hold up rendering a frame.
+     *   Changes that arrive while a listener is waiting are merged into the ones it is called with.
+     *   Listeners that are still waiting when a write transaction begins on the Realm are called
+     *   then, before and again after it begins, rather than after the commit.
+     *   Available since 1.12.0.
+     * @throws {Error} If `callback` is not a function, `options.format` or `options.priority` is not
+     *   one of the above, or `options.properties` names a property that doesn't exist.
      * @example
      * wines.addListener((collection, changes) => {
      *  // collection === wines
@@ -289,7 +470,7 @@ class Collection {
      *  console.log(`new size of collection: ${collection.length}`);
      * });
      */
-    addListener(callback) {}
+    addListener(callback, options) {}
 
     /**
      * Remove the listener `callback` from the collection instance.
@@ -64,6 +64,29 @@ class List extends Collection {
      */
     splice(index, count, ...object) {}
 
+    /**
+     * Add all objects in an array to the _end_ of the list in a single call.
+     * @param {Array<Realm.Object|Object>} objects - Realm objects of the list's
+     *   {@linkcode Realm~ObjectSchemaProperty objectType}, or plain objects, which are created
+     *   the same way as with {@link Realm.List#push push}.
+     * @throws {Error} If an object is of the wrong type or not inside a write transaction.
+     * @returns {number} equal to the new {@link Realm.List#length length} of the list
+     *   after adding objects.
+     * @since 1.12.0
+     */
+    pushMany(objects) {}
+
+    /**
+     * Replace the contents of the list with the objects in an array. Only the objects that differ
+     * are replaced, inserted or removed, so that listeners are notified about the actual changes
+     * rather than about every object in the list.
+     * @param {Array<Realm.Object|Object>} objects - The new contents of the list, in the same
+     *   forms accepted by {@link Realm.List#pushMany pushMany}.
+     * @throws {Error} If an object is of the wrong type or not inside a write transaction.
+     * @since 1.12.0
+     */
+    replaceAll(objects) {}
+
     /**
      * Add one or more objects to the _beginning_ of the list.
      * @param {...Realm.Object} object - Each object’s type must match
@@ -46,4 +46,82 @@ class Object {
      * @since 1.9.0
      */
     linkingObjects(objectType, property) {}
+
+    /**
+     * Returns the number of objects that link to this object in the specified relationship,
+     * without creating a {@link Realm.Results} for them.
+     * @param {string} objectType - The type of the objects that link to this object's type.
+     * @param {string} property - The name of the property that references objects of this object's type.
+     * @throws {Error} If the relationship is not valid.
+     * @returns {number} the number of links to this object, counting an object once for every time
+     *   it links here.
+     * @since 1.12.0
+     */
+    linkingObjectsCount(objectType, property) {}
+
+    /**
+     * Copy this object into a plain JavaScript object in a single call, such as for sending it
+     * over the network or keeping it in application state. Objects it links to, and the objects in
+     * its lists, are copied in the same way, two levels deep by default. This is what
+     * `JSON.stringify()` calls.
+     * @param {Realm.Object~ToJSONOptions} [options]
+     * @returns {Object} a plain object with the values of the object's properties. Dates stay
+     *   `Date` objects and data properties become `ArrayBuffer`s.
+     * @since 1.12.0
+     * @example
+     * let json = JSON.stringify(person); // Follows two levels of links, replacing cycles with null.
+     * let summary = person.toJSON({properties: ['name', 'friends'], depth: 1});
+     */
+    toJSON(options) {}
+
+    /**
+     * Add a listener `callback` which will be called when this object changes or is deleted.
+     * Adding the same callback more than once has no effect.
+     * @param {function(object, changes)} callback - A function to be called when changes occur.
+     *   The callback function is called with two arguments:
+     *   - `object`: the object that changed,
+     *   - `changes`: a dictionary with the keys `deleted`, which is `true` if the object was deleted,
+     *     and `changedProperties`, the names of the properties that changed.
+     * @throws {Error} If `callback` is not a function or the object has been deleted.
+     * @since 1.12.0
+     * @example
+     * wine.addListener((object, changes) => {
+     *  if (changes.deleted) {
+     *    console.log('wine was deleted');
+     *  }
+     *  changes.changedProperties.forEach((name) => console.log(`${name} is now ${object[name]}`));
+     * });
+     */
+    addListener(callback) {}
+
+    /**
+     * Remove the listener `callback` from this object.
+     * @param {function(object, changes)} callback - Callback function that was previously
+     *   added as a listener through the {@link Realm.Object#addListener addListener} method.
+     * @throws {Error} If `callback` is not a function.
+     * @since 1.12.0
+     */
+    removeListener(callback) {}
+
+    /**
+     * Remove all listeners from this object.
+     * @since 1.12.0
+     */
+    removeAllListeners() {}
 }
+
+/**
+ * Options for {@link Realm.Object#toJSON toJSON()} and
+ * {@link Realm.Collection#toPlainArray toPlainArray()}.
+ * @typedef Realm.Object~ToJSONOptions
+ * @type {Object}
+ * @property {string[]} [properties] - The properties to copy from the object itself. All of its
+ *   properties by default. Linked objects always have all their properties copied.
+ * @property {number} [depth=2] - How many levels of links and lists to follow. Links and
+ *   lists below that are left out, so `0` only copies the object's own values. An object linked
+ *   to along several chains of links is copied for each of them, so a large `depth`, such as
+ *   `Infinity`, can take very long on densely linked objects.
+ *
+ * A link back to an object that is already being copied, further up the same chain of links,
+ * becomes `null`.
+ */
@@ -93,7 +93,10 @@ class Realm {
 
     /**
      * Open a realm asynchronously with a promise. If the realm is synced, it will be fully 
-     * synchronized before it is available.
+     * synchronized before it is available. If it is a local Realm whose file already exists,
+     * the file is first opened on a background thread, so that checking the encryption key and
+     * upgrading the file format don't block JavaScript. Migrations still run on the JavaScript
+     * thread.
      * @param {Realm~Configuration} config 
      * @returns {Promise} - a promise that will be resolved with the realm instance when it's available.
      */
@@ -108,6 +111,43 @@ class Realm {
      */
     static openAsync(config, callback) {}
 
+    /**
+     * Compact the Realm file described by `config` on a background thread, if enough of it is
+     * free space. Unlike {@link Realm#compact compact()} this doesn't block JavaScript while
+     * the file is rewritten, but the Realm must not be open anywhere (including in this
+     * process), otherwise the file is left as it is and `compacted` is `false`.
+     * Synchronized Realms are not supported.
+     * @param {Realm~Configuration} [config] - Only `path` and `encryptionKey` are used.
+     * @param {Object} [options]
+     * @param {number} [options.threshold=0] - The fraction of the file, from `0` up to but
+     *   excluding `1`, that must be free space for the file to be compacted.
+     * @param {callback(number, number)} [options.progress] - Called with the total and used
+     *   size of the file, in bytes, once it has been decided to compact it.
+     * @returns {Promise<Realm~CompactResult>} - a promise that is resolved when the compaction
+     *   finished or was skipped, and rejected if the file could not be opened.
+     * @since 1.12.0
+     */
+    static compactAsync(config, options) {}
+
+    /**
+     * Delete the Realm file described by `config`, along with its lock and note files and its
+     * management directory. Files that don't exist are skipped.
+     * @param {Realm~Configuration} [config] - Only `path` is used.
+     * @throws {Error} If the Realm is open.
+     * @since 1.12.0
+     */
+    static deleteFile(config) {}
+
+    /**
+     * Delete every Realm file in `directory`, along with their lock and note files and their
+     * management directories, on a background thread. On Node the files are removed in parallel.
+     * None of the Realms in `directory` may be open.
+     * @param {string} [directory] - Defaults to the directory of {@link Realm.defaultPath}.
+     * @returns {Promise} - a promise that is resolved once the files are deleted.
+     * @since 1.12.0
+     */
+    static deleteFilesAsync(directory) {}
+
     /**
      * Closes this Realm so it may be re-opened with a newer schema version.
      * All objects and collections from this Realm are no longer valid after calling this method.
@@ -126,25 +166,96 @@ class Realm {
      */
     create(type, properties, update) {}
 
+    /**
+     * Create new Realm objects of the given type from each of the provided property sets.
+     * This is equivalent to calling {@link Realm#create create()} for each element, but the
+     * objects are inserted in a single call and no {@link Realm.Object} is returned for them.
+     * @param {Realm~ObjectType} type - The type of Realm objects to create.
+     * @param {Object[]} objects - Property values for each object to create, in either object
+     *   or array form.
+     * @param {boolean} [update=false] - Signals that existing objects with matching primary keys
+     *   should be updated.
+     * @returns {number} the number of objects that were created or updated.
+     * @since 1.12.0
+     */
+    createMany(type, objects, update) {}
+
+    /**
+     * Creates or updates many Realm objects of a type with a primary key in a single call.
+     * This is equivalent to calling {@link Realm#createMany createMany} with `update` set to `true`.
+     * @param {Realm~ObjectType} type - The type of Realm objects to create or update.
+     * @param {Array<Object|Array>} objects - The property values of each object, in either object
+     *   or array form.
+     * @throws {Error} If the type has no primary key or any of the objects are invalid.
+     * @returns {number} the number of objects that were created or updated.
+     * @since 1.12.0
+     */
+    upsertMany(type, objects) {}
+
     /**
      * Deletes the provided Realm object, or each one inside the provided collection.
      * @param {Realm.Object|Realm.Object[]|Realm.List|Realm.Results} object
      */
     delete(object) {}
 
+    /**
+     * Searches for Realm objects by their primary keys.
+     * @param {Realm~ObjectType} type - The type of Realm objects to search for.
+     * @param {Array<number|string>} keys - The primary key values of the objects to search for.
+     * @throws {Error} If type passed into this method is invalid or if the object type did
+     *   not have a `primaryKey` specified in its {@link Realm~ObjectSchema ObjectSchema}.
+     * @returns {Array<Realm.Object|undefined>} with the object for each key, in the same order as
+     *   `keys`, or `undefined` for keys without an object.
+     * @since 1.12.0
+     */
+    objectsForPrimaryKeys(type, keys) {}
+
+    /**
+     * Deletes all objects of the given type that match a query, without creating a
+     * {@link Realm.Object} for any of them.
+     * @param {Realm~ObjectType} type - The type of Realm objects to delete.
+     * @param {string} query - Query used to select the objects to delete.
+     * @param {...any} [arg] - Each subsequent argument is used by the placeholders
+     *   (e.g. `$0`, `$1`, `$2`, …) in the query.
+     * @throws {Error} If the type or query is invalid, or if not inside a write transaction.
+     * @returns {number} the number of objects that were deleted.
+     * @since 1.12.0
+     * @example
+     * realm.write(() => {
+     *     realm.deleteWhere('Transaction', 'date < $0', cutoff);
+     * });
+     */
+    deleteWhere(type, query, ...arg) {}
+
     /**
      * **WARNING:** This will delete **all** objects in the Realm!
      */
     deleteAll() {}
 
     /**
-     * Returns all objects of the given `type` in the Realm.
+     * Returns all objects of the given `type` in the Realm. If the Realm was opened with
+     * `cacheObjects`, the same _Results_ are returned for each call with the same `type` (so
+     * listeners added to them are shared as well), until the schema changes.
      * @param {Realm~ObjectType} type - The type of Realm objects to retrieve.
      * @throws {Error} If type passed into this method is invalid.
      * @returns {Realm.Results} that will live-update as objects are created and destroyed.
      */
     objects(type) {}
 
+    /**
+     * Returns the number of objects of the given `type`, or of those matching `predicate`, without
+     * creating a {@link Realm.Results} for them. Counts of predicates without placeholders are
+     * remembered until the Realm changes.
+     * @param {Realm~ObjectType} type - The type of Realm objects to count.
+     * @param {string} [predicate] - Query used to select the objects to count.
+     * @param {...any} [arg] - Each subsequent argument is used by the placeholders
+     *   (e.g. `$0`, `$1`, `$2`, …) in the query.
+     * @throws {Error} If the type or query is invalid.
+     * @returns {number} the number of objects.
+     * @since 1.12.0
+     */
+    count(type, predicate, ...arg) {}
+
     /**
      * Searches for a Realm object by its primary key.
      * @param {Realm~ObjectType} type - The type of Realm object to search for.
@@ -156,10 +267,56 @@ class Realm {
      */
     objectForPrimaryKey(type, key) {}
 
+    /**
+     * Prepares a query that is run many times with different arguments, such as a search that
+     * is updated as the user types. Predicates are parsed once and then reused, both by this
+     * and by {@link Realm.Collection#filtered filtered()}.
+     * @param {Realm~ObjectType} type - The type of Realm objects to query.
+     * @param {string} predicate - A query string, with placeholders (e.g. `$0`) for the arguments.
+     * @throws {Error} If `type` is invalid or `predicate` is not a string.
+     * @returns {Realm~CompiledQuery} whose `run(...args)` method returns the objects of `type`
+     *   matching `predicate` for the given arguments.
+     * @since 1.12.0
+     * @example
+     * let search = realm.compileQuery('Contact', 'name BEGINSWITH[c] $0');
+     * let matches = search.run(text);
+     */
+    compileQuery(type, predicate) {}
+
+    /**
+     * Create objects of the given type from a file, one object per line as JSON or one row per
+     * object as CSV, in the format written by {@link Realm.Results#exportTo exportTo()}. The file
+     * is parsed and the objects are created on a background thread, in write transactions of
+     * `batchSize` objects each, so that neither the whole file nor the whole import is held in
+     * memory. Batches written before a failure stay in the Realm.
+     *
+     * A line of JSON may also be an array of values in the order of the properties in the schema.
+     * Links are given either as nested objects, which are created, or as the primary key of an
+     * existing object. Dates may be ISO 8601 strings or milliseconds since the epoch, and data
+     * is base64. The `default` values in the schema are applied as for {@link Realm#create create()}.
+     * @param {string} path - The file to read.
+     * @param {Realm~ObjectType} type - The type of Realm objects to create.
+     * @param {Object} [options]
+     * @param {string} [options.format='json'] - Either `'json'` for newline-delimited JSON or `'csv'`,
+     *   whose header line names the property of each column.
+     * @param {number} [options.batchSize=1000] - The number of objects created per write transaction.
+     * @param {boolean} [options.update=false] - Update existing objects with the same primary key
+     *   instead of failing.
+     * @param {callback(number, number, number)} [options.progress] - Called after each batch with the
+     *   number of objects created so far, the bytes of the file read so far and its size.
+     * @throws {Error} If `type` or an option is invalid, or the Realm is read-only.
+     * @returns {Promise<{rows: number}>} resolved with the number of objects created, or rejected
+     *   with an error that names the failing line.
+     * @since 1.12.0
+     */
+    importFrom(path, type, options) {}
+
     /**
      * Add a listener `callback` for the specified event `name`.
      * @param {string} name - The name of event that should cause the callback to be called.
-     *   _Currently, only the "change" event supported_.
+     *   _Currently, only the "change" and "changeset" events are supported_. A "changeset"
+     *   callback is only called when objects changed, and gets a third argument whose
+     *   `objectTypes` property lists the object types that changed (since 1.12.0).
      * @param {callback(Realm, string)} callback - Function to be called when the event occurs.
      *   Each callback will only be called once per event, regardless of the number of times
      *   it was added.
@@ -170,7 +327,7 @@ class Realm {
    /**
     * Remove the listener `callback` for the specfied event `name`.
     * @param {string} name - The event name.
-    *   _Currently, only the "change" event supported_.
+    *   _Currently, only the "change" and "changeset" events are supported_.
     * @param {callback(Realm, string)} callback - Function that was previously added as a
     *   listener for this event through the {@link Realm#addListener addListener} method.
     * @throws {Error} If an invalid event `name` is supplied, or if `callback` is not a function.
@@ -180,7 +337,7 @@ class Realm {
    /**
     * Remove all event listeners (restricted to the event `name`, if provided).
     * @param {string} [name] - The name of the event whose listeners should be removed.
-    *   _Currently, only the "change" event supported_.
+    *   _Currently, only the "change" and "changeset" events are supported_.
     * @throws {Error} When invalid event `name` is supplied
     */
     removeAllListeners(name) {}
@@ -191,6 +348,45 @@ class Realm {
     */
     write(callback) {}
 
+   /**
+    * Call the provided `callback` inside a write transaction on a later turn of the event loop.
+    * Pending writes to the same Realm file run in the order they were requested, one per turn,
+    * so that other work can run between consecutive large writes. The write is only deferred: it
+    * still runs and is committed on the JS thread, blocking it until the commit is done.
+    * @param {function()} callback
+    * @returns {Promise} - resolved with the return value of `callback` once the transaction has been
+    *   committed, or rejected with the error thrown by `callback` or the commit.
+    * @throws {TypeError} If `callback` is not a function.
+    * @since 1.12.0
+    */
+    deferWrite(callback) {}
+
+   /**
+    * Turn group commit on or off for the {@link Realm#deferWrite deferWrite()} calls on this
+    * Realm file. With group commit, the writes requested within `delay` milliseconds of the first
+    * pending one run together in a single transaction, up to `maxWrites` at a time, and their
+    * promises are settled once that transaction is committed. This lets many small concurrent
+    * writes, such as one per HTTP request, share the cost of committing to disk. Only writes
+    * requested on the same `Realm` instance are grouped together, and closing any instance of the
+    * file turns group commit off for it.
+    *
+    * If a callback throws, its promise is rejected and its changes are rolled back along with
+    * those of the others in the group, which are then run again without it. Callbacks may
+    * therefore be called more than once, and should not have side effects outside of the Realm.
+    * @param {?Object} options - `null` turns group commit off.
+    * @param {number} [options.delay=0] - How long to wait for more writes after the first one is
+    *   requested, in milliseconds.
+    * @param {number} [options.maxWrites=100] - The most writes committed together.
+    * @throws {TypeError} If the options are invalid.
+    * @since 1.12.0
+    * @example
+    * realm.setGroupCommit({delay: 5, maxWrites: 50});
+    * app.post('/visits', (req, res) => {
+    *     realm.deferWrite(() => realm.create('Visit', req.body)).then(() => res.sendStatus(201));
+    * });
+    */
+    setGroupCommit(options) {}
+
     /**
      * Initiate a write transaction.
      * @throws {Error} When already in write transaction
@@ -224,6 +420,18 @@ class Realm {
      * @returns {true} if compaction succeeds.
      */
     compact() {}
+
+    /**
+     * Report what is keeping memory and old versions of this Realm alive, for tracking down
+     * leaks. Every object, list and results that JavaScript still holds on to keeps a native
+     * copy alive, and listeners keep notifiers running. Old versions stay in the file for as
+     * long as any Realm or snapshot is at that version, which makes the file grow.
+     * @returns {Realm~Stats} The counts and sizes for this Realm's file.
+     * @throws {Error} If the Realm is closed.
+     * @since 1.12.0
+     */
+    stats() {}
+
 }
 
 /**
@@ -243,6 +451,144 @@ Realm.schemaVersion = function(path, encryptionKey) {};
  */
 Realm.defaultPath;
 
+/**
+ * How long each phase of the most recent construction of a {@link Realm} took, or `undefined`
+ * if no Realm has been opened yet.
+ * @type {Realm~OpenStats}
+ * @readonly
+ * @since 1.12.0
+ */
+Realm.lastOpenStats;
+
+/**
+ * The durations, in milliseconds, of the phases of opening a Realm.
+ * @typedef Realm~OpenStats
+ * @type {Object}
+ * @property {number} config - Reading the configuration, not including the schema.
+ * @property {number} schema - Parsing the schema.
+ * @property {number} open - Opening the file, including any schema changes and the migration.
+ * @property {number} migration - Running the `migration` function, if it was called.
+ * @property {number} datetimeConversion - Converting dates stored in files created by old versions.
+ * @property {number} accessorPrototypes - Creating the accessor prototypes, if
+ *   `prototypeAccessors` was set.
+ * @property {number} total - The whole construction.
+ * @property {number} copyBundledRealmFiles - The most recent call to
+ *   `Realm.copyBundledRealmFiles()`, if any.
+ */
+
+/**
+ * Whether calls into the native methods and property accessors are counted and timed in
+ * {@link Realm.callStats}. This is off by default; turning it on clears the counters
+ * collected so far.
+ * @type {boolean}
+ * @since 1.12.0
+ */
+Realm.collectCallStats;
+
+/**
+ * The calls counted since {@link Realm.collectCallStats} was last turned on, keyed by
+ * `Class.member` (e.g. `Results.filtered`, `List.push` or `RealmObject[name]` for object
+ * properties). Members that haven't been called are left out.
+ * @type {Object<string, Realm~CallStats>}
+ * @readonly
+ * @since 1.12.0
+ * @example
+ * Realm.collectCallStats = true;
+ * renderList(realm.objects('Item'));
+ * Realm.collectCallStats = false;
+ * console.log(Realm.callStats['Results.filtered']);
+ */
+Realm.callStats;
+
+/**
+ * The most indices that `Object.keys()`, `for...in`, object spread and debuggers see on a
+ * {@link Realm.Results} or {@link Realm.List}, which would otherwise create a property name for
+ * every object in the collection. Collections longer than this only enumerate their first
+ * `collectionEnumerationLimit` indices; indexing, `length`, `for...of` and the collection
+ * methods are not affected. Defaults to `Infinity`.
+ * @type {number}
+ * @since 1.12.0
+ * @example
+ * Realm.collectionEnumerationLimit = 1000;
+ */
+Realm.collectionEnumerationLimit;
+
+/**
+ * Whether React Native reloads keep the Realm files open. When the JavaScript context is
+ * recreated (by a reload during development, or by restarting the bridge after an update),
+ * every Realm is closed and the next open of each file starts from scratch. With this set,
+ * only the old context's Realms and their listeners are closed; each file stays open and mapped
+ * until the new context opens it again, which is then much faster. A file that is reopened with
+ * a different schema version or configuration is closed first. Defaults to `false`.
+ * @type {boolean}
+ * @since 1.12.0
+ * @example
+ * Realm.keepOpenAcrossReloads = true;
+ */
+Realm.keepOpenAcrossReloads;
+
+/**
+ * Warn through `console.warn()` when a Realm file keeps more than this many versions, which
+ * is checked each time a Realm with this file changes. It warns again only after the count
+ * has gone back down to the threshold. Set it to `0` to switch the warning off. Defaults to `0`.
+ * @type {number}
+ * @since 1.12.0
+ * @example
+ * Realm.versionWarningThreshold = 100;
+ */
+Realm.versionWarningThreshold;
+
+/**
+ * The diagnostics reported by {@link Realm#stats realm.stats()}. The version and space counts
+ * are `null` for read-only and synced Realms, where they can't be read, and `fileSize` is `null`
+ * for in-memory Realms.
+ * @typedef Realm~Stats
+ * @type {Object}
+ * @property {Object<string, number>} liveObjects - The number of native objects alive for this
+ *   file, keyed by object type for {@link Realm.Object}s, and by `"Realm.List"` and
+ *   `"Realm.Results"` for collections.
+ * @property {number} notificationTokens - The number of listeners registered on this Realm and on
+ *   its objects and collections.
+ * @property {?number} versions - The number of versions kept in the file, including the latest one.
+ * @property {?number} fileSize - The size of the file, which is also how much of it is mapped into memory.
+ * @property {?number} usedSize - The bytes in the file that hold the latest version's data.
+ * @property {?number} freeSize - The bytes in the file that are free, or only hold older versions.
+ * @since 1.12.0
+ */
+
+/**
+ * The counters for one native method or property accessor.
+ * @typedef Realm~CallStats
+ * @type {Object}
+ * @property {number} calls - The number of calls.
+ * @property {number} totalTime - The time spent in those calls, in milliseconds.
+ * @property {number} maxTime - The slowest call, in milliseconds.
+ * @property {number[]} histogram - The number of calls taking less than 1, 2, 4, … 16384
+ *   microseconds, each bucket starting where the previous one ends; the last bucket counts
+ *   all slower calls.
+ */
+
+/**
+ * A query prepared by {@link Realm#compileQuery}.
+ * @typedef Realm~CompiledQuery
+ * @type {Object}
+ * @property {Realm} realm - The Realm that is queried.
+ * @property {string} objectType - The type of the objects that are queried.
+ * @property {string} predicate - The query string.
+ * @property {function(...any): Realm.Results} run - Returns the matching objects for the given
+ *   arguments, in the same way as `realm.objects(objectType).filtered(predicate, ...args)`.
+ */
+
+/**
+ * The outcome of {@link Realm.compactAsync}.
+ * @typedef Realm~CompactResult
+ * @type {Object}
+ * @property {boolean} compacted - Whether the file was compacted.
+ * @property {number} totalBytes - The size of the file beforehand, in bytes.
+ * @property {number} usedBytes - How much of the file was used by data, in bytes.
+ * @property {number} compactedBytes - The size of the file afterwards, in bytes.
+ */
+
 /**
  * This describes the different options used to create a {@link Realm} instance.
  * @typedef Realm~Configuration
@@ -264,11 +610,36 @@ Realm.defaultPath;
  *   will be skipped if another process is accessing it.
  * @property {string} [path={@link Realm.defaultPath}] - The path to the file where the
  *   Realm database should be stored.
+ * @property {boolean} [prototypeAccessors=false] - Specifies if the properties of Realm objects
+ *   should be provided by accessors on a prototype generated for each object type, instead of
+ *   being looked up by name on every access. This makes repeated property access considerably
+ *   faster, but the properties are no longer _own_ properties of the objects, so e.g.
+ *   `Object.keys()` will not list them (`for...in` loops still do). Only supported on Node, and
+ *   ignored with JavaScriptCore, where the properties are always looked up by name.
+ * @property {boolean} [cacheObjects=false] - Specifies if {@link Realm#objects objects()} should
+ *   return the same _Results_ for each call with the same type while the schema is unchanged,
+ *   instead of new _Results_ every time. As these are then shared, so are the listeners added to
+ *   them. (since 1.12.0)
  * @property {boolean} [readOnly=false] - Specifies if this Realm should be opened as read-only.
+ * @property {boolean} [bundled=false] - Open the Realm file named `path` from the app's bundle
+ *   (iOS) or assets (Android), instead of from the default directory. Requires `readOnly`. On iOS
+ *   the file is opened where it is, without copying it; on Android, where assets can't be opened
+ *   as files, only this file is copied out of the APK, the first time it is opened and again
+ *   whenever an update of the app bundles a different version of it.
+ *   Not supported on Node. (since 1.12.0)
+ * @property {boolean} [inMemory=false] - Keep the data of this Realm in memory instead of in a
+ *   file. Realms opened with the same `path` share their data until the last of them is closed,
+ *   which discards it. The `path` is still used for the small lock files that coordinate them.
+ *   Can't be combined with `readOnly` or `sync`. (since 1.12.0)
  * @property {Array<Realm~ObjectClass|Realm~ObjectSchema>} [schema] - Specifies all the
  *   object types in this Realm. **Required** when first creating a Realm at this `path`.
  * @property {number} [schemaVersion] - **Required** (and must be incremented) after
  *   changing the `schema`.
+ * @property {boolean} [skipMigrationForAdditiveChanges=false] - Specifies if the `migration`
+ *   function should be skipped when the only differences from the schema in the file are new
+ *   object types, new optional or list properties and added or removed indexes. These are applied
+ *   without running any JavaScript, which speeds up opening large files after such an update.
+ *   Available since 1.12.0.
  * @property {Object} [sync] - Sync configuration parameters with the following 
  *   child properties:
  *   - `user` - A `User` object obtained by calling `Realm.Sync.User.login`
@@ -299,7 +670,8 @@ Realm.defaultPath;
  * @type {Object}
  * @property {Realm~PropertyType} type - The type of this property.
  * @property {string} [objectType] - **Required**  when `type` is `"list"` or `"linkingObjects"`,
- *   and must match the type of an object in the same schema.
+ *   and must match the type of an object in the same schema. Lists of primitive values such as
+ *   `"string"` or `"int"` are not supported, and are rejected when the schema is parsed.
  * @property {string} [property] - **Required** when `type` is `"linkingObjects"`, and must match
  *   the name of a property on the type specified in `objectType` that links to the type this property belongs to.
  * @property {any} [default] - The default value for this property on creation when not
@@ -307,6 +679,12 @@ Realm.defaultPath;
  * @property {boolean} [optional] - Signals if this property may be assigned `null` or `undefined`.
  * @property {boolean} [indexed] - Signals if this property should be indexed. Only supported for
  *   `"string"`, `"int"`, and `"bool"` properties. 
+ * @property {boolean} [fullText] - Keeps a word index for this property, which `CONTAINS` queries
+ *   on it use to only look at the objects that contain the words searched for. The index is built
+ *   by the first such query, and rebuilt from the whole property once two queries in a row find
+ *   the objects of this type unchanged since they last changed; until then queries look at every
+ *   object. It suits properties that are queried far more often than written. Only supported for
+ *   `"string"` properties. (since 1.12.0)
  */
 
 /**
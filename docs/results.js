@@ -27,4 +27,36 @@
  * @memberof Realm
  */
 class Results extends Collection {
+    /**
+     * The number of objects in these _Results_, like {@link Realm.Collection#length length}, but
+     * remembered until the Realm changes. _Results_ that haven't been read yet are counted by
+     * running their query, without collecting the objects that match it.
+     * @returns {number} the number of objects.
+     * @since 1.12.0
+     */
+    count() {}
+
+    /**
+     * Write the objects in these _Results_ to a file, one object per line as JSON or one row per
+     * object as CSV. The objects are read and written on a background thread, as they were when
+     * this method was called, so changes made afterwards are not included.
+     *
+     * Links are written as the primary key of the linked object (or `null` if it has none), lists
+     * as an array of them, dates as ISO 8601 strings and data as base64.
+     * @param {string} path - The file to write, which is replaced if it exists.
+     * @param {Realm.Results~ExportOptions} [options] - The format and properties to export.
+     * @throws {Error} If a property cannot be exported or this is called within a write transaction.
+     * @returns {Promise<{rows: number}>} resolved with the number of objects written once the file
+     *   is complete.
+     * @since 1.12.0
+     */
+    exportTo(path, options) {}
 }
+
+/**
+ * @typedef Realm.Results~ExportOptions
+ * @type {Object}
+ * @property {string} [format='json'] - Either `'json'` for newline-delimited JSON or `'csv'`.
+ * @property {string[]} [properties] - The properties to export, in order. Defaults to every
+ *   property other than linking objects.
+ */
@@ -58,9 +58,36 @@ class Sync {
      */
     static setLogLevel(log_level) {}
 
+    /**
+     * Send the sync client's log messages to `callback` instead of the default logger. Messages
+     * below `level` are filtered out natively, and the rest are buffered and delivered in batches,
+     * so even debug logging doesn't call into JavaScript for every message. It can be called at any
+     * time, including after synced Realms have been opened.
+     * @param {?string} level - The lowest level to deliver, as for {@link Realm.Sync.setLogLevel setLogLevel()},
+     *   or `null` to send the messages to the default logger again.
+     * @param {callback(Realm.Sync~LogEntry[], number)} [callback] - Called with the messages logged since the
+     *   previous call, oldest first, and the number of messages dropped because the buffer was full.
+     * @param {number} [maxBufferedMessages=1000] - How many messages are kept while waiting to be delivered.
+     * @since 1.12.0
+     * @example
+     * Realm.Sync.setLogger('debug', (entries) => {
+     *     entries.forEach((entry) => appLogger.log(entry.level, entry.message));
+     * });
+     */
+    static setLogger(level, callback, maxBufferedMessages) {}
+
 
 }
 
+/**
+ * A message from the sync client, as delivered to the callback of {@link Realm.Sync.setLogger setLogger()}.
+ * @typedef Realm.Sync~LogEntry
+ * @type {Object}
+ * @property {string} level - The message's level, such as `"debug"` or `"error"`.
+ * @property {string} message - The message.
+ * @since 1.12.0
+ */
+
 /**
  * Change info passed when receiving sync 'change' events
  * @memberof Realm.Sync
@@ -334,6 +361,36 @@ class Session {
      * @type {string}
      */
     get state() {}
+
+    /**
+     * Register a progress notification callback on a session object
+     * @param {string} direction - The progress direction to register for.
+     * Can be either:
+     *  - `download` - report download progress
+     *  - `upload` - report upload progress
+     * @param {string} mode - The progress notification mode to use for the registration.
+     * Can be either:
+     *  - `reportIndefinitely` - the registration will stay active until the callback is unregistered
+     *  - `forCurrentlyOutstandingWork` - the registration will be active until only the currently transferable bytes are synced
+     * @param {callback(transferred, transferable)} callback - called with the following arguments:
+     *   - `transferred` - the current number of bytes already transferred
+     *   - `transferable` - the total number of transferable bytes (the number of bytes already transferred plus the number of bytes pending transfer)
+     * @param {Object} [options] - Limits how often `callback` is called. The first call and the
+     *   one completing a transfer are never held back.
+     * @param {number} [options.minInterval] - The minimum number of milliseconds between calls.
+     * @param {number} [options.minDelta] - The fraction (between `0` and `1`) of `transferable`
+     *   that must be transferred between calls. With both options, either of them lets a call through.
+     * @since 1.12.0
+     */
+    addProgressNotification(direction, mode, callback, options) {}
+
+    /**
+     * Unregister a progress notification callback that was registered with
+     * {@link Realm.Sync.Session#addProgressNotification addProgressNotification}.
+     * @param {callback(transferred, transferable)} callback - a previously registered progress callback
+     * @since 1.12.0
+     */
+    removeProgressNotification(callback) {}
 }
 
 
@@ -19,8 +19,8 @@
 'use strict';
 
 import { keys } from './constants';
-import { getterForProperty } from './util';
-import { getProperty, setProperty } from './rpc';
+import { createMethod, getterForProperty } from './util';
+import { getProperty, getRows, getStateVersion, setProperty } from './rpc';
 
 let mutationListeners = {};
 
@@ -53,16 +53,86 @@ export function fireMutationListeners(realmId) {
     }
 }
 
+export function createColumnsMethod(type) {
+    let method = createMethod(type, 'toColumns');
+
+    return function() {
+        let columns = method.apply(this, arguments);
+
+        // Numeric columns arrive as binary data, so restore them to the typed arrays returned natively.
+        Object.keys(columns).forEach((name) => {
+            if (columns[name] instanceof ArrayBuffer) {
+                columns[name] = new Float64Array(columns[name]);
+            }
+        });
+        return columns;
+    };
+}
+
+// Collection listeners aren't called while debugging, and queries are evaluated on the device anyway,
+// so the async query methods resolve right away.
+export function createAsyncMethods(prototype) {
+    Object.defineProperties(prototype, {
+        filteredAsync: {
+            value: function(...args) {
+                return new Promise((resolve) => resolve(this.filtered(...args)));
+            },
+            configurable: true,
+            writable: true,
+        },
+        sortedAsync: {
+            value: function(...args) {
+                return new Promise((resolve) => resolve(this.sorted(...args)));
+            },
+            configurable: true,
+            writable: true,
+        },
+    });
+}
+
 function isIndex(propertyName) {
     return typeof propertyName === 'number' || (typeof propertyName === 'string' && /^\d+$/.test(propertyName));
 }
 
 const mutable = Symbol('mutable');
+const rowCache = Symbol('rowCache');
+
+// The number of rows fetched at once while a collection is being read in order.
+const rowChunkSize = 100;
+
+function getRow(collection, index) {
+    let version = getStateVersion();
+    let cache = collection[rowCache];
+
+    if (cache && cache.version === version) {
+        if (index >= cache.start && index < cache.start + cache.rows.length) {
+            return cache.rows[index - cache.start];
+        }
+    }
+    else {
+        cache = null;
+    }
+
+    // Only read ahead when the previous access was to the row before this one.
+    let sequential = cache && index === cache.start + cache.rows.length;
+    let realmId = collection[keys.realm];
+    let {length, rows} = getRows(realmId, collection[keys.id], index, index + (sequential ? rowChunkSize : 1));
+
+    collection[keys.values] = {version, values: {length: {value: length}}};
+
+    if (!rows.length) {
+        // Let the server decide what reading past the end does.
+        return getProperty(realmId, collection[keys.id], index);
+    }
+
+    collection[rowCache] = {version, start: index, rows};
+    return rows[0];
+}
 
 const traps = {
     get(collection, property, receiver) {
         if (isIndex(property)) {
-            return getProperty(collection[keys.realm], collection[keys.id], property);
+            return getRow(collection, +property);
         }
 
         return Reflect.get(collection, property, collection);
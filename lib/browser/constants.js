@@ -26,6 +26,7 @@ export const propTypes = {};
     'id',
     'realm',
     'type',
+    'values',
 ].forEach(function(name) {
     keys[name] = Symbol(name);
 });
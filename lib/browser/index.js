@@ -109,6 +109,36 @@ export default class Realm {
         return method.apply(this, [getObjectType(this, type), ...args]);
     }
 
+    createMany(type, ...args) {
+        let method = util.createMethod(objectTypes.REALM, 'createMany', true);
+        return method.apply(this, [getObjectType(this, type), ...args]);
+    }
+
+    upsertMany(type, ...args) {
+        let method = util.createMethod(objectTypes.REALM, 'upsertMany', true);
+        return method.apply(this, [getObjectType(this, type), ...args]);
+    }
+
+    objectsForPrimaryKeys(type, ...args) {
+        let method = util.createMethod(objectTypes.REALM, 'objectsForPrimaryKeys');
+        return method.apply(this, [getObjectType(this, type), ...args]);
+    }
+
+    deleteWhere(type, ...args) {
+        let method = util.createMethod(objectTypes.REALM, 'deleteWhere', true);
+        return method.apply(this, [getObjectType(this, type), ...args]);
+    }
+
+    _importFrom(path, type, ...args) {
+        let method = util.createMethod(objectTypes.REALM, '_importFrom');
+        return method.apply(this, [path, getObjectType(this, type), ...args]);
+    }
+
+    count(type, ...args) {
+        let method = util.createMethod(objectTypes.REALM, 'count');
+        return method.apply(this, [getObjectType(this, type), ...args]);
+    }
+
     objects(type, ...args) {
         let method = util.createMethod(objectTypes.REALM, 'objects');
         return method.apply(this, [getObjectType(this, type), ...args]);
@@ -125,7 +155,8 @@ util.createMethods(Realm.prototype, objectTypes.REALM, [
     'addListener',
     'removeListener',
     'removeAllListeners',
-    'close',
+    '_close',
+    'stats',
 ]);
 
 // Mutating methods:
@@ -164,6 +195,28 @@ Object.defineProperties(Realm, {
         get: util.getterForProperty('defaultPath'),
         set: util.setterForProperty('defaultPath'),
     },
+    lastOpenStats: {
+        get: util.getterForProperty('lastOpenStats'),
+    },
+    collectCallStats: {
+        get: util.getterForProperty('collectCallStats'),
+        set: util.setterForProperty('collectCallStats'),
+    },
+    callStats: {
+        get: util.getterForProperty('callStats'),
+    },
+    collectionEnumerationLimit: {
+        get: util.getterForProperty('collectionEnumerationLimit'),
+        set: util.setterForProperty('collectionEnumerationLimit'),
+    },
+    keepOpenAcrossReloads: {
+        get: util.getterForProperty('keepOpenAcrossReloads'),
+        set: util.setterForProperty('keepOpenAcrossReloads'),
+    },
+    versionWarningThreshold: {
+        get: util.getterForProperty('versionWarningThreshold'),
+        set: util.setterForProperty('versionWarningThreshold'),
+    },
     schemaVersion: {
         value: function(_path, _encryptionKey) {
             return rpc.callMethod(undefined, Realm[keys.id], 'schemaVersion', Array.from(arguments));
@@ -181,11 +234,31 @@ Object.defineProperties(Realm, {
             rpc.clearTestState();
         },
     },
+    _compactAsync: {
+        value: function(_config, _threshold, _progress, _callback) {
+            return rpc.callMethod(undefined, Realm[keys.id], '_compactAsync', Array.from(arguments));
+        }
+    },
+    deleteFile: {
+        value: function(_config) {
+            return rpc.callMethod(undefined, Realm[keys.id], 'deleteFile', Array.from(arguments));
+        }
+    },
+    _deleteFilesAsync: {
+        value: function(_directory, _callback) {
+            return rpc.callMethod(undefined, Realm[keys.id], '_deleteFilesAsync', Array.from(arguments));
+        }
+    },
     _waitForDownload: {
         value: function(_config, callback) {
             callback();
         }
     },
+    _prepareOpen: {
+        value: function(_config, callback) {
+            callback(null);
+        }
+    },
 });
 
 for (let i = 0, len = debugHosts.length; i < len; i++) {
@@ -18,7 +18,7 @@
 
 'use strict';
 
-import Collection, { createCollection } from './collections';
+import Collection, { createAsyncMethods, createCollection, createColumnsMethod } from './collections';
 import { objectTypes } from './constants';
 import { createMethods } from './util';
 
@@ -31,7 +31,17 @@ createMethods(List.prototype, objectTypes.LIST, [
     'sorted',
     'snapshot',
     'isValid',
+    'isEmpty',
     'indexOf',
+    'min',
+    'max',
+    'sum',
+    'avg',
+    'groupBy',
+    'slice',
+    'toArray',
+    '_getChunk',
+    'toPlainArray',
     'addListener',
     'removeListener',
     'removeAllListeners',
@@ -44,8 +54,16 @@ createMethods(List.prototype, objectTypes.LIST, [
     'push',
     'unshift',
     'splice',
+    'pushMany',
+    'replaceAll',
 ], true);
 
+Object.defineProperty(List.prototype, 'toColumns', {
+    value: createColumnsMethod(objectTypes.LIST),
+});
+
+createAsyncMethods(List.prototype);
+
 export function createList(realmId, info) {
     return createCollection(List.prototype, realmId, info, true);
 }
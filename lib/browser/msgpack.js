@@ -0,0 +1,314 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2016 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+'use strict';
+
+// A MessagePack encoder and decoder for RPC messages, covering the subset of types that JSON can
+// represent plus raw binary data, which is encoded from and decoded to an ArrayBuffer.
+
+export function encode(value) {
+    let writer = new Writer();
+    writer.write(value);
+    return writer.bytes();
+}
+
+export function decode(buffer) {
+    let reader = new Reader(buffer);
+    let value = reader.read();
+
+    if (reader.offset != reader.view.byteLength) {
+        throw new Error('Unexpected data after MessagePack value');
+    }
+    return value;
+}
+
+class Writer {
+    constructor() {
+        this.buffer = new ArrayBuffer(256);
+        this.view = new DataView(this.buffer);
+        this.offset = 0;
+    }
+
+    bytes() {
+        return new Uint8Array(this.buffer, 0, this.offset);
+    }
+
+    reserve(count) {
+        if (this.offset + count <= this.buffer.byteLength) {
+            return;
+        }
+
+        let buffer = new ArrayBuffer(Math.max(this.buffer.byteLength * 2, this.offset + count));
+        new Uint8Array(buffer).set(new Uint8Array(this.buffer, 0, this.offset));
+        this.buffer = buffer;
+        this.view = new DataView(buffer);
+    }
+
+    uint8(value) {
+        this.reserve(1);
+        this.view.setUint8(this.offset, value);
+        this.offset += 1;
+    }
+
+    header(type, value, byteCount) {
+        this.reserve(1 + byteCount);
+        this.view.setUint8(this.offset, type);
+
+        switch (byteCount) {
+            case 1:
+                this.view.setUint8(this.offset + 1, value);
+                break;
+            case 2:
+                this.view.setUint16(this.offset + 1, value);
+                break;
+            case 4:
+                this.view.setUint32(this.offset + 1, value);
+                break;
+        }
+        this.offset += 1 + byteCount;
+    }
+
+    length(length, fixType, fixLimit, type8, type16, type32) {
+        if (length < fixLimit) {
+            this.uint8(fixType | length);
+        } else if (type8 && length <= 0xff) {
+            this.header(type8, length, 1);
+        } else if (length <= 0xffff) {
+            this.header(type16, length, 2);
+        } else {
+            this.header(type32, length, 4);
+        }
+    }
+
+    raw(bytes) {
+        this.reserve(bytes.length);
+        new Uint8Array(this.buffer, this.offset, bytes.length).set(bytes);
+        this.offset += bytes.length;
+    }
+
+    write(value) {
+        if (value == null) {
+            this.uint8(0xc0);
+        } else if (typeof value == 'boolean') {
+            this.uint8(value ? 0xc3 : 0xc2);
+        } else if (typeof value == 'number') {
+            this.number(value);
+        } else if (typeof value == 'string') {
+            let bytes = encodeUTF8(value);
+            this.length(bytes.length, 0xa0, 32, 0xd9, 0xda, 0xdb);
+            this.raw(bytes);
+        } else if (Array.isArray(value)) {
+            this.length(value.length, 0x90, 16, 0, 0xdc, 0xdd);
+            value.forEach((item) => this.write(item));
+        } else if (value instanceof ArrayBuffer || ArrayBuffer.isView(value)) {
+            let bytes = value instanceof ArrayBuffer
+                ? new Uint8Array(value)
+                : new Uint8Array(value.buffer, value.byteOffset, value.byteLength);
+            this.length(bytes.length, 0, 0, 0xc4, 0xc5, 0xc6);
+            this.raw(bytes);
+        } else {
+            // Like JSON.stringify, leave out keys with undefined values.
+            let keys = Object.keys(value).filter((key) => value[key] !== undefined);
+            this.length(keys.length, 0x80, 16, 0, 0xde, 0xdf);
+            keys.forEach((key) => {
+                this.write(key);
+                this.write(value[key]);
+            });
+        }
+    }
+
+    number(value) {
+        if (Number.isInteger(value) && value >= -32 && value <= 0x7f) {
+            this.uint8(value & 0xff);
+        } else if (Number.isInteger(value) && value >= -0x80000000 && value <= 0x7fffffff) {
+            this.reserve(5);
+            this.view.setUint8(this.offset, 0xd2);
+            this.view.setInt32(this.offset + 1, value);
+            this.offset += 5;
+        } else {
+            this.reserve(9);
+            this.view.setUint8(this.offset, 0xcb);
+            this.view.setFloat64(this.offset + 1, value);
+            this.offset += 9;
+        }
+    }
+}
+
+class Reader {
+    constructor(buffer) {
+        this.view = new DataView(buffer);
+        this.offset = 0;
+    }
+
+    advance(count) {
+        let offset = this.offset;
+        if (offset + count > this.view.byteLength) {
+            throw new Error('Truncated MessagePack data');
+        }
+        this.offset += count;
+        return offset;
+    }
+
+    uint(byteCount) {
+        let offset = this.advance(byteCount);
+        switch (byteCount) {
+            case 1:
+                return this.view.getUint8(offset);
+            case 2:
+                return this.view.getUint16(offset);
+            case 4:
+                return this.view.getUint32(offset);
+            default:
+                return this.view.getUint32(offset) * 0x100000000 + this.view.getUint32(offset + 4);
+        }
+    }
+
+    int(byteCount) {
+        let offset = this.advance(byteCount);
+        switch (byteCount) {
+            case 1:
+                return this.view.getInt8(offset);
+            case 2:
+                return this.view.getInt16(offset);
+            case 4:
+                return this.view.getInt32(offset);
+            default:
+                return this.view.getInt32(offset) * 0x100000000 + this.view.getUint32(offset + 4);
+        }
+    }
+
+    string(length) {
+        let offset = this.advance(length);
+        return decodeUTF8(new Uint8Array(this.view.buffer, this.view.byteOffset + offset, length));
+    }
+
+    binary(length) {
+        let offset = this.view.byteOffset + this.advance(length);
+        return this.view.buffer.slice(offset, offset + length);
+    }
+
+    array(count) {
+        let array = new Array(count);
+        for (let i = 0; i < count; i++) {
+            array[i] = this.read();
+        }
+        return array;
+    }
+
+    map(count) {
+        let object = {};
+        for (let i = 0; i < count; i++) {
+            let key = this.read();
+            object[key] = this.read();
+        }
+        return object;
+    }
+
+    read() {
+        let type = this.uint(1);
+
+        if (type <= 0x7f) {
+            return type;
+        }
+        if (type >= 0xe0) {
+            return type - 0x100;
+        }
+        if ((type & 0xe0) == 0xa0) {
+            return this.string(type & 0x1f);
+        }
+        if ((type & 0xf0) == 0x90) {
+            return this.array(type & 0x0f);
+        }
+        if ((type & 0xf0) == 0x80) {
+            return this.map(type & 0x0f);
+        }
+
+        switch (type) {
+            case 0xc0: return null;
+            case 0xc2: return false;
+            case 0xc3: return true;
+            case 0xc4: return this.binary(this.uint(1));
+            case 0xc5: return this.binary(this.uint(2));
+            case 0xc6: return this.binary(this.uint(4));
+            case 0xca: return this.view.getFloat32(this.advance(4));
+            case 0xcb: return this.view.getFloat64(this.advance(8));
+            case 0xcc: return this.uint(1);
+            case 0xcd: return this.uint(2);
+            case 0xce: return this.uint(4);
+            case 0xcf: return this.uint(8);
+            case 0xd0: return this.int(1);
+            case 0xd1: return this.int(2);
+            case 0xd2: return this.int(4);
+            case 0xd3: return this.int(8);
+            case 0xd9: return this.string(this.uint(1));
+            case 0xda: return this.string(this.uint(2));
+            case 0xdb: return this.string(this.uint(4));
+            case 0xdc: return this.array(this.uint(2));
+            case 0xdd: return this.array(this.uint(4));
+            case 0xde: return this.map(this.uint(2));
+            case 0xdf: return this.map(this.uint(4));
+        }
+        throw new Error('Unsupported MessagePack type: ' + type);
+    }
+}
+
+function encodeUTF8(string) {
+    let bytes = [];
+
+    for (let i = 0; i < string.length; i++) {
+        let code = string.codePointAt(i);
+        if (code > 0xffff) {
+            i++;
+        }
+
+        if (code < 0x80) {
+            bytes.push(code);
+        } else if (code < 0x800) {
+            bytes.push(0xc0 | (code >> 6), 0x80 | (code & 0x3f));
+        } else if (code < 0x10000) {
+            bytes.push(0xe0 | (code >> 12), 0x80 | ((code >> 6) & 0x3f), 0x80 | (code & 0x3f));
+        } else {
+            bytes.push(0xf0 | (code >> 18), 0x80 | ((code >> 12) & 0x3f), 0x80 | ((code >> 6) & 0x3f), 0x80 | (code & 0x3f));
+        }
+    }
+
+    return bytes;
+}
+
+function decodeUTF8(bytes) {
+    let string = '';
+
+    for (let i = 0; i < bytes.length;) {
+        let byte = bytes[i++];
+        let code;
+
+        if (byte < 0x80) {
+            code = byte;
+        } else if (byte < 0xe0) {
+            code = ((byte & 0x1f) << 6) | (bytes[i++] & 0x3f);
+        } else if (byte < 0xf0) {
+            code = ((byte & 0x0f) << 12) | ((bytes[i++] & 0x3f) << 6) | (bytes[i++] & 0x3f);
+        } else {
+            code = ((byte & 0x07) << 18) | ((bytes[i++] & 0x3f) << 12) | ((bytes[i++] & 0x3f) << 6) | (bytes[i++] & 0x3f);
+        }
+
+        string += String.fromCodePoint(code);
+    }
+
+    return string;
+}
@@ -20,6 +20,7 @@
 
 import { keys, objectTypes } from './constants';
 import { getterForProperty, setterForProperty, createMethods } from './util';
+import { getStateVersion } from './rpc';
 
 let registeredConstructors = {};
 let registeredRealmPaths = {};
@@ -31,7 +32,12 @@ export default class RealmObject {
 createMethods(RealmObject.prototype, objectTypes.OBJECT, [
     'isValid',
     'objectSchema',
-    'linkingObjects'
+    'linkingObjects',
+    'linkingObjectsCount',
+    'toJSON',
+    'addListener',
+    'removeListener',
+    'removeAllListeners',
 ]);
 
 export function clearRegisteredConstructors() {
@@ -49,6 +55,10 @@ export function createObject(realmId, info) {
     object[keys.id] = info.id;
     object[keys.type] = info.type;
 
+    if (info.values) {
+        object[keys.values] = {version: getStateVersion(), values: info.values};
+    }
+
     schema.properties.forEach((name) => {
         Object.defineProperty(object, name, {
             enumerable: true,
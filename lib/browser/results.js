@@ -18,7 +18,7 @@
 
 'use strict';
 
-import Collection, { createCollection } from './collections';
+import Collection, { createAsyncMethods, createCollection, createColumnsMethod } from './collections';
 import { objectTypes } from './constants';
 import { createMethods } from './util';
 
@@ -30,12 +30,30 @@ createMethods(Results.prototype, objectTypes.RESULTS, [
     'sorted',
     'snapshot',
     'isValid',
+    'isEmpty',
+    'count',
     'indexOf',
+    'min',
+    'max',
+    'sum',
+    'avg',
+    'groupBy',
+    'slice',
+    'toArray',
+    '_getChunk',
+    'toPlainArray',
+    '_exportTo',
     'addListener',
     'removeListener',
     'removeAllListeners',
 ]);
 
+Object.defineProperty(Results.prototype, 'toColumns', {
+    value: createColumnsMethod(objectTypes.RESULTS),
+});
+
+createAsyncMethods(Results.prototype);
+
 export function createResults(realmId, info) {
     return createCollection(Results.prototype, realmId, info);
 }
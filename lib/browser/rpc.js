@@ -19,6 +19,7 @@
 'use strict';
 
 import * as base64 from './base64';
+import * as msgpack from './msgpack';
 import { keys, objectTypes } from './constants';
 
 const {id: idKey, realm: _realmKey} = keys;
@@ -33,6 +34,17 @@ let XMLHttpRequest = global.originalXMLHttpRequest || global.XMLHttpRequest;
 let sessionHost;
 let sessionId;
 
+// Synchronous requests can only receive binary responses inside a worker (or through sync-request),
+// so only offer the MessagePack encoding there. The server picks the encoding when creating the session.
+const supportsBinaryResponses = !!global.__debug__ || typeof global.importScripts == 'function';
+let encoding = 'json';
+
+// Incremented by every request that might change what the server would return, so values received
+// ahead of time can tell whether they are still current. Only these requests leave it unchanged.
+const readOnlyCommands = new Set(['get_property', 'get_rows']);
+let stateVersion = 0;
+let stateVersionExpiring = false;
+
 // Check if XMLHttpRequest has been overridden, and get the native one if that's the case.
 if (XMLHttpRequest.__proto__ != global.XMLHttpRequestEventTarget) {
     let fakeXMLHttpRequest = XMLHttpRequest;
@@ -41,7 +53,7 @@ if (XMLHttpRequest.__proto__ != global.XMLHttpRequestEventTarget) {
     global.XMLHttpRequest = fakeXMLHttpRequest;
 }
 
-registerTypeConverter(objectTypes.DATA, (_, {value}) => base64.decode(value));
+registerTypeConverter(objectTypes.DATA, (_, {value, bytes}) => bytes || base64.decode(value));
 registerTypeConverter(objectTypes.DATE, (_, {value}) => new Date(value));
 registerTypeConverter(objectTypes.DICT, deserializeDict);
 registerTypeConverter(objectTypes.FUNCTION, deserializeFunction);
@@ -52,7 +64,10 @@ export function registerTypeConverter(type, handler) {
 
 export function createSession(refreshAccessToken, host) {
     refreshAccessToken[persistentCallback] = true;
-    sessionId = sendRequest('create_session', { refreshAccessToken: serialize(undefined, refreshAccessToken) }, host);
+    sessionId = sendRequest('create_session', {
+        refreshAccessToken: serialize(undefined, refreshAccessToken),
+        encodings: supportsBinaryResponses ? ['msgpack'] : [],
+    }, host);
     sessionHost = host;
 
     return sessionId;
@@ -86,6 +101,28 @@ export function getProperty(realmId, id, name) {
     return deserialize(realmId, result);
 }
 
+export function getRows(realmId, id, start, end) {
+    let result = sendRequest('get_rows', {realmId, id, start, end});
+    return {
+        length: result.length,
+        rows: result.rows.map((info) => deserialize(realmId, info)),
+    };
+}
+
+// The Realms on the device may be refreshed, e.g. by sync, whenever no request is being served, just as
+// they are between turns of the event loop when running there. The version is therefore also incremented
+// at the end of each turn in which it was read.
+export function getStateVersion() {
+    if (!stateVersionExpiring) {
+        stateVersionExpiring = true;
+        setTimeout(() => {
+            stateVersionExpiring = false;
+            stateVersion++;
+        }, 0);
+    }
+    return stateVersion;
+}
+
 export function setProperty(realmId, id, name, value) {
     value = serialize(realmId, value);
     sendRequest('set_property', {realmId, id, name, value});
@@ -134,6 +171,9 @@ function serialize(realmId, value) {
     }
 
     if (value instanceof ArrayBuffer || ArrayBuffer.isView(value)) {
+        if (encoding == 'msgpack') {
+            return {type: objectTypes.DATA, bytes: value};
+        }
         return {type: objectTypes.DATA, value: base64.encode(value)};
     }
 
@@ -172,38 +212,52 @@ function deserializeFunction(realmId, info) {
     return registeredCallbacks[info.value];
 }
 
-function makeRequest(url, data) {
+function makeRequest(url, data, binary) {
     let statusCode;
     let responseText;
+    let responseData;
 
     // The global __debug__ object is provided by Visual Studio Code.
     if (global.__debug__) {
         let request = global.__debug__.require('sync-request');
         let response = request('POST', url, {
-          body: JSON.stringify(data),
+          body: binary ? global.Buffer.from(msgpack.encode(data)) : JSON.stringify(data),
           headers: {
-            "Content-Type": "text/plain;charset=UTF-8"
+            "Content-Type": binary ? "application/msgpack" : "text/plain;charset=UTF-8"
           }
         });
 
         statusCode = response.statusCode;
-        responseText = response.body.toString('utf-8');
+        if (binary) {
+            let body = response.body;
+            responseData = body.buffer.slice(body.byteOffset, body.byteOffset + body.length);
+        } else {
+            responseText = response.body.toString('utf-8');
+        }
     } else {
-        let body = JSON.stringify(data);
         let request = new XMLHttpRequest();
 
         request.open('POST', url, false);
-        request.send(body);
+        if (binary) {
+            request.responseType = 'arraybuffer';
+            request.send(msgpack.encode(data));
+        } else {
+            request.send(JSON.stringify(data));
+        }
 
         statusCode = request.status;
-        responseText = request.responseText;
+        if (binary) {
+            responseData = request.response;
+        } else {
+            responseText = request.responseText;
+        }
     }
 
     if (statusCode != 200) {
-        throw new Error(responseText);
+        throw new Error(binary ? `Request failed with status ${statusCode}` : responseText);
     }
 
-    return JSON.parse(responseText);
+    return binary ? msgpack.decode(responseData) : JSON.parse(responseText);
 }
 
 function sendRequest(command, data, host = sessionHost) {
@@ -213,8 +267,18 @@ function sendRequest(command, data, host = sessionHost) {
 
     data = Object.assign({}, data, sessionId ? {sessionId} : null);
 
+    if (!readOnlyCommands.has(command)) {
+        stateVersion++;
+    }
+
+    // Sessions are always created with JSON, and the response says which encoding to use afterwards.
+    let isCreateSession = command == 'create_session';
     let url = 'http://' + host + '/' + command;
-    let response = makeRequest(url, data);
+    let response = makeRequest(url, data, !isCreateSession && encoding == 'msgpack');
+
+    if (isCreateSession && response) {
+        encoding = response.encoding || 'json';
+    }
 
     if (!response || response.error) {
         let error = response && response.error;
@@ -229,6 +293,9 @@ function sendRequest(command, data, host = sessionHost) {
 
     let callback = response.callback;
     if (callback != null) {
+        // A notification means the Realm has changed, so nothing read before it is current.
+        stateVersion++;
+
         let result;
         let error;
         try {
@@ -31,7 +31,9 @@ Object.defineProperties(Session.prototype, {
 
 createMethods(Session.prototype, objectTypes.SESSION, [
     '_refreshAccessToken',
-    '_simulateError'
+    '_simulateError',
+    'addProgressNotification',
+    'removeProgressNotification'
 ]);
 
 export function createSession(realmId, info) {
@@ -58,6 +58,12 @@ export function createMethod(type, name, mutates) {
 
 export function getterForProperty(name) {
     return function() {
+        // Use the value sent along with this object if nothing could have changed it since.
+        let prefetched = this[keys.values];
+        if (prefetched && prefetched.version === rpc.getStateVersion() && prefetched.values.hasOwnProperty(name)) {
+            return rpc.deserialize(this[keys.realm], prefetched.values[name]);
+        }
+
         return rpc.getProperty(this[keys.realm], this[keys.id], name);
     };
 }
@@ -37,14 +37,6 @@ Object.defineProperty(iteratorPrototype, Symbol.iterator, {
     'join',
     'slice',
     'lastIndexOf',
-    'every',
-    'some',
-    'forEach',
-    'find',
-    'findIndex',
-    'map',
-    'filter',
-    'reduce',
     'reduceRight',
 ].forEach(function(methodName) {
     var method = arrayPrototype[methodName];
@@ -53,29 +45,173 @@ Object.defineProperty(iteratorPrototype, Symbol.iterator, {
     }
 });
 
+// Objects are read from the native side this many at a time when iterating, rather than one per index.
+var chunkSize = 256;
+
+// A chunk refers to the change state of its Realm, whose version goes up whenever the Realm advances, begins a
+// write transaction or is closed, after which the objects in the chunk may have been deleted or moved. Chunks
+// read through the debugger have no change state and are never stale.
+function isStale(chunk) {
+    return chunk.state !== undefined && chunk.state.version !== chunk.version;
+}
+
+// Calls `visit` with each object and its index until it returns true, reading the objects in chunks. As with the
+// methods of Array.prototype, the length is only read once. A chunk is read ahead of the objects in it being
+// visited, except within a write transaction, where each object is read right before it is visited.
+function visitAll(collection, visit) {
+    var length = collection.length;
+    var index = 0;
+    while (index < length) {
+        var chunk = collection._getChunk(index, Math.min(chunkSize, length - index));
+        if (!chunk.length) {
+            return;
+        }
+        for (var i = 0; i < chunk.length; i++, index++) {
+            // The code visiting the objects may have written to or refreshed the Realm since the chunk was read,
+            // in which case the rest of it is read again from the collection.
+            if (i > 0 && isStale(chunk)) {
+                break;
+            }
+            if (visit(chunk[i], index)) {
+                return;
+            }
+        }
+    }
+}
+
+function validatedCallback(callback) {
+    if (typeof callback != 'function') {
+        throw new TypeError(callback + ' is not a function');
+    }
+    return callback;
+}
+
+var chunkedMethods = {
+    forEach: function(callback, thisArg) {
+        var self = this;
+        validatedCallback(callback);
+        visitAll(self, function(object, index) {
+            callback.call(thisArg, object, index, self);
+        });
+    },
+    map: function(callback, thisArg) {
+        var self = this;
+        var result = [];
+        validatedCallback(callback);
+        visitAll(self, function(object, index) {
+            result.push(callback.call(thisArg, object, index, self));
+        });
+        return result;
+    },
+    filter: function(callback, thisArg) {
+        var self = this;
+        var result = [];
+        validatedCallback(callback);
+        visitAll(self, function(object, index) {
+            if (callback.call(thisArg, object, index, self)) {
+                result.push(object);
+            }
+        });
+        return result;
+    },
+    some: function(callback, thisArg) {
+        var self = this;
+        var found = false;
+        validatedCallback(callback);
+        visitAll(self, function(object, index) {
+            return found = !!callback.call(thisArg, object, index, self);
+        });
+        return found;
+    },
+    every: function(callback, thisArg) {
+        var self = this;
+        var all = true;
+        validatedCallback(callback);
+        visitAll(self, function(object, index) {
+            return !(all = !!callback.call(thisArg, object, index, self));
+        });
+        return all;
+    },
+    find: function(callback, thisArg) {
+        var self = this;
+        var found;
+        validatedCallback(callback);
+        visitAll(self, function(object, index) {
+            if (callback.call(thisArg, object, index, self)) {
+                found = object;
+                return true;
+            }
+        });
+        return found;
+    },
+    findIndex: function(callback, thisArg) {
+        var self = this;
+        var found = -1;
+        validatedCallback(callback);
+        visitAll(self, function(object, index) {
+            if (callback.call(thisArg, object, index, self)) {
+                found = index;
+                return true;
+            }
+        });
+        return found;
+    },
+    reduce: function(callback, initialValue) {
+        var self = this;
+        var hasValue = arguments.length > 1;
+        var value = initialValue;
+        validatedCallback(callback);
+        visitAll(self, function(object, index) {
+            if (hasValue) {
+                value = callback(value, object, index, self);
+            }
+            else {
+                value = object;
+                hasValue = true;
+            }
+        });
+        if (!hasValue) {
+            throw new TypeError('Reduce of empty collection with no initial value');
+        }
+        return value;
+    },
+};
+
+Object.keys(chunkedMethods).forEach(function(methodName) {
+    exports[methodName] = {value: chunkedMethods[methodName], configurable: true, writable: true};
+});
+
 ['entries', 'keys', 'values'].forEach(function(methodName) {
     var method = function() {
         var self = this;
         var index = 0;
 
+        // The objects still to be handed out from the last chunk read, starting at `chunkStart`. The length of
+        // the collection is only read again along with a chunk, except for the keys, which need no objects.
+        var chunk = [];
+        var chunkStart = 0;
+
         return Object.create(iteratorPrototype, {
             next: {
                 value: function() {
-                    if (!self || index >= self.length) {
+                    // The Realm may have changed since the last chunk was read, even between two calls when it
+                    // is refreshed, so the objects left in it are only handed out while it is not stale.
+                    if (self && methodName != 'keys' && (index - chunkStart >= chunk.length || isStale(chunk))) {
+                        chunk = index < self.length ? self._getChunk(index, chunkSize) : [];
+                        chunkStart = index;
+                    }
+                    if (!self || (methodName == 'keys' ? index >= self.length : index - chunkStart >= chunk.length)) {
                         self = null;
+                        chunk = null;
                         return {done: true, value: undefined};
                     }
 
-                    var value;
-                    switch (methodName) {
-                        case 'entries':
-                            value = [index, self[index]];
-                            break;
-                        case 'keys':
-                            value = index;
-                            break;
-                        default:
-                            value = self[index];
+                    var value = index;
+                    if (methodName != 'keys') {
+                        value = chunk[index - chunkStart];
+                        if (methodName == 'entries') {
+                            value = [index, value];
+                        }
                     }
 
                     index++;
@@ -89,3 +225,12 @@ Object.defineProperty(iteratorPrototype, Symbol.iterator, {
 });
 
 exports[Symbol.iterator] = exports.values;
+
+// Array.prototype.includes compares wrappers by identity, which differs from indexOf for Realm objects.
+exports.includes = {
+    value: function(object) {
+        return this.indexOf(object) !== -1;
+    },
+    configurable: true,
+    writable: true,
+};
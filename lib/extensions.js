@@ -31,6 +31,9 @@ function setConstructorOnPrototype(klass) {
     }
 }
 
+// The filteredAsync() and sortedAsync() calls whose first notification hasn't arrived yet.
+const pendingEvaluations = new Set();
+
 module.exports = function(realmConstructor) {
     // Add the specified Array methods to the Collection prototype.
     Object.defineProperties(realmConstructor.Collection.prototype, require('./collection-methods'));
@@ -40,11 +43,21 @@ module.exports = function(realmConstructor) {
     setConstructorOnPrototype(realmConstructor.Results);
     setConstructorOnPrototype(realmConstructor.Object);
 
+    // Synced Realms wait for the server's data to be downloaded. Local Realms that already exist are opened once
+    // on a background thread first, so that checking and upgrading the file doesn't block the JS thread.
+    function prepareOpen(config, callback) {
+        if (config && config.sync) {
+            realmConstructor._waitForDownload(config, callback);
+            return;
+        }
+        realmConstructor._prepareOpen(config || {}, (error) => callback(error ? new Error(error) : null));
+    }
+
     //Add async open API
     Object.defineProperties(realmConstructor, getOwnPropertyDescriptors({
         open(config) {
             return new Promise((resolve, reject) => {
-                realmConstructor._waitForDownload(config, (error) => {
+                prepareOpen(config, (error) => {
                     if (error) {
                         reject(error);
                     }
@@ -61,8 +74,56 @@ module.exports = function(realmConstructor) {
             });
         },
 
+        compactAsync(config, options) {
+            options = options || {};
+            return new Promise((resolve, reject) => {
+                realmConstructor._compactAsync(config || {}, options.threshold || 0, options.progress, (error, result) => {
+                    if (error) {
+                        reject(new Error(error));
+                    }
+                    else {
+                        resolve(result);
+                    }
+                });
+            });
+        },
+
+        deleteFilesAsync(directory) {
+            return new Promise((resolve, reject) => {
+                realmConstructor._deleteFilesAsync(directory, (error) => {
+                    if (error) {
+                        reject(new Error(error));
+                    }
+                    else {
+                        resolve();
+                    }
+                });
+            });
+        },
+
+        // Used by Realms opened with `prototypeAccessors` to create the prototype of each object type.
+        // The native side resolves each accessor by its index in `propertyNames`.
+        _createAccessorPrototype(basePrototype, propertyNames) {
+            let prototype = Object.create(basePrototype);
+
+            propertyNames.forEach((name, index) => {
+                Object.defineProperty(prototype, name, {
+                    enumerable: true,
+                    configurable: true,
+                    get() {
+                        return this._getPropertyAt(index);
+                    },
+                    set(value) {
+                        this._setPropertyAt(index, value);
+                    },
+                });
+            });
+
+            return prototype;
+        },
+
         openAsync(config, callback) {
-                realmConstructor._waitForDownload(config, (error) => {
+                prepareOpen(config, (error) => {
                     if (error) {
                         callback(error);
                     }
@@ -79,6 +140,284 @@ module.exports = function(realmConstructor) {
         },
     }));
 
+    // Add async query API. A Results with a listener is evaluated by the background notifier rather than on
+    // this thread, and the evaluated rows are handed over with the first notification. The promise is
+    // rejected instead if the Results is invalidated first, such as by closing its Realm.
+    function whenEvaluated(createResults) {
+        return new Promise((resolve, reject) => {
+            let results = createResults();
+            let evaluation = {
+                settle(error) {
+                    pendingEvaluations.delete(evaluation);
+                    try {
+                        results.removeListener(listener);
+                    }
+                    catch (e) {
+                        // A closed Realm has no listeners left to remove.
+                    }
+                    if (error) {
+                        reject(error);
+                    }
+                    else {
+                        resolve(results);
+                    }
+                },
+                checkValid() {
+                    let valid;
+                    try {
+                        valid = results.isValid();
+                    }
+                    catch (e) {
+                        valid = false;
+                    }
+                    if (!valid) {
+                        evaluation.settle(new Error('The collection was invalidated before it was evaluated.'));
+                    }
+                    return valid;
+                },
+            };
+            let listener = () => {
+                try {
+                    if (evaluation.checkValid()) {
+                        evaluation.settle();
+                    }
+                }
+                catch (e) {
+                    evaluation.settle(e);
+                }
+            };
+            results.addListener(listener);
+            pendingEvaluations.add(evaluation);
+        });
+    }
+
+    Object.defineProperties(realmConstructor.Collection.prototype, {
+        filteredAsync: {
+            value: function(...args) {
+                return whenEvaluated(() => this.filtered(...args));
+            },
+            configurable: true,
+            writable: true,
+        },
+        sortedAsync: {
+            value: function(...args) {
+                return whenEvaluated(() => this.sorted(...args));
+            },
+            configurable: true,
+            writable: true,
+        },
+    });
+
+    // Add compiled queries. The native side keeps the parsed form of recently used predicates, so a
+    // compiled query only holds what it needs to run again with new arguments.
+    class CompiledQuery {
+        constructor(realm, objectType, predicate) {
+            if (typeof predicate != 'string') {
+                throw new TypeError('predicate must be a string');
+            }
+            // Fails early for unknown object types.
+            realm.objects(objectType);
+
+            Object.defineProperties(this, {
+                realm: {value: realm},
+                objectType: {value: objectType},
+                predicate: {value: predicate},
+            });
+        }
+
+        run(...args) {
+            return this.realm.objects(this.objectType).filtered(this.predicate, ...args);
+        }
+    }
+
+    Object.defineProperties(realmConstructor.prototype, getOwnPropertyDescriptors({
+        close() {
+            let path = this.path;
+            this._close();
+            // The collections of this Realm are no longer valid, so their evaluations will never finish.
+            pendingEvaluations.forEach((evaluation) => evaluation.checkValid());
+            groupCommits.delete(path);
+        },
+
+        compileQuery(objectType, predicate) {
+            return new CompiledQuery(this, objectType, predicate);
+        },
+    }));
+
+    // Add streaming import. The file is parsed and its objects are created on a background thread, in
+    // write transactions of `batchSize` objects each.
+    Object.defineProperties(realmConstructor.prototype, getOwnPropertyDescriptors({
+        importFrom(path, type, options) {
+            options = options || {};
+            return new Promise((resolve, reject) => {
+                this._importFrom(path, type, options.format || 'json', options.batchSize || 1000, !!options.update,
+                                 options.progress, (error, result) => {
+                    if (error) {
+                        reject(new Error(error));
+                    }
+                    else {
+                        resolve(result);
+                    }
+                });
+            });
+        },
+    }));
+
+    // Add streaming export. The rows are read and written on a background thread, so exporting a large
+    // Results doesn't block this one.
+    Object.defineProperties(realmConstructor.Results.prototype, getOwnPropertyDescriptors({
+        exportTo(path, options) {
+            options = options || {};
+            return new Promise((resolve, reject) => {
+                this._exportTo(path, options.format || 'json', options.properties, (error, result) => {
+                    if (error) {
+                        reject(new Error(error));
+                    }
+                    else {
+                        resolve(result);
+                    }
+                });
+            });
+        },
+    }));
+
+    // Add deferred write API. Each Realm file has its own queue of pending writes, and only one of them is
+    // run per turn of the event loop so that a series of large writes doesn't block the thread throughout.
+    // The writes are still run and committed on this thread.
+    // With group commit turned on for the file, the writes queued within its delay run together instead,
+    // up to `maxWrites` of them in one transaction, so that they share a single commit. A group ends at the
+    // first write requested on another instance of the Realm, and group commit is turned off when one is closed.
+    let pendingWrites = new Map();
+    let groupCommits = new Map();
+
+    function schedulePendingWrites(path, queue, delay) {
+        clearTimeout(queue.timer);
+        queue.timer = setTimeout(() => runPendingWrites(path), delay);
+    }
+
+    function runPendingWrites(path) {
+        let queue = pendingWrites.get(path);
+        let groupCommit = groupCommits.get(path);
+
+        // Only the writes requested on the same Realm instance as the first one can share its transaction.
+        let count = 1;
+        while (groupCommit && count < Math.min(groupCommit.maxWrites, queue.length) && queue[count].realm === queue[0].realm) {
+            count++;
+        }
+        let writes = queue.splice(0, count);
+
+        if (queue.length) {
+            schedulePendingWrites(path, queue, groupCommit ? groupCommit.delay : 0);
+        } else {
+            pendingWrites.delete(path);
+        }
+
+        if (writes.length == 1) {
+            let {realm, callback, resolve, reject} = writes[0];
+            try {
+                let result;
+                realm.write(() => {
+                    result = callback();
+                });
+                resolve(result);
+            } catch (e) {
+                reject(e);
+            }
+            return;
+        }
+
+        runGroupCommit(writes);
+    }
+
+    // The writes share one transaction, and their promises are settled once it is committed. When a callback
+    // throws, the transaction is rolled back and the writes before it are run again without it, so that
+    // its changes are never committed along with theirs.
+    function runGroupCommit(writes) {
+        while (writes.length) {
+            let realm = writes[0].realm;
+            let results = [];
+            let failed = -1;
+            let error;
+
+            try {
+                realm.beginTransaction();
+            } catch (e) {
+                writes.forEach((write) => write.reject(e));
+                return;
+            }
+
+            for (let i = 0; i < writes.length; i++) {
+                try {
+                    results.push(writes[i].callback());
+                } catch (e) {
+                    failed = i;
+                    error = e;
+                    break;
+                }
+            }
+
+            if (failed == -1) {
+                try {
+                    realm.commitTransaction();
+                } catch (e) {
+                    writes.forEach((write) => write.reject(e));
+                    return;
+                }
+                writes.forEach((write, i) => write.resolve(results[i]));
+                return;
+            }
+
+            realm.cancelTransaction();
+            writes[failed].reject(error);
+            writes.splice(failed, 1);
+        }
+    }
+
+    Object.defineProperties(realmConstructor.prototype, getOwnPropertyDescriptors({
+        deferWrite(callback) {
+            if (typeof callback != 'function') {
+                throw new TypeError('callback must be a function');
+            }
+
+            return new Promise((resolve, reject) => {
+                let path = this.path;
+                let groupCommit = groupCommits.get(path);
+                let queue = pendingWrites.get(path);
+
+                if (!queue) {
+                    pendingWrites.set(path, queue = []);
+                    schedulePendingWrites(path, queue, groupCommit ? groupCommit.delay : 0);
+                }
+                queue.push({realm: this, callback, resolve, reject});
+
+                // A full group doesn't wait for the rest of the delay.
+                if (groupCommit && queue.length == groupCommit.maxWrites) {
+                    schedulePendingWrites(path, queue, 0);
+                }
+            });
+        },
+
+        setGroupCommit(options) {
+            if (options == null || options === false) {
+                groupCommits.delete(this.path);
+                return;
+            }
+            if (typeof options != 'object') {
+                throw new TypeError('options must be an object');
+            }
+
+            let delay = options.delay === undefined ? 0 : options.delay;
+            let maxWrites = options.maxWrites === undefined ? 100 : options.maxWrites;
+            if (typeof delay != 'number' || !(delay >= 0)) {
+                throw new TypeError('delay must be a non-negative number');
+            }
+            if (typeof maxWrites != 'number' || !(maxWrites >= 1)) {
+                throw new TypeError('maxWrites must be a positive number');
+            }
+            groupCommits.set(this.path, {delay, maxWrites: Math.floor(maxWrites)});
+        },
+    }));
+
     // Add sync methods
     if (realmConstructor.Sync) {
         let userMethods = require('./user-methods');
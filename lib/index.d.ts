@@ -37,6 +37,7 @@ declare namespace Realm {
         default?: any;
         optional?: boolean;
         indexed?: boolean;
+        fullText?: boolean;
     }
 
     // properties types
@@ -79,9 +80,14 @@ declare namespace Realm {
         migration?: (oldRealm: Realm, newRealm: Realm) => void;
         shouldCompactOnLaunch?: (totalBytes: number, usedBytes: number) => boolean;
         path?: string;
+        prototypeAccessors?: boolean;
+        cacheObjects?: boolean;
         readOnly?: boolean;
+        bundled?: boolean;
+        inMemory?: boolean;
         schema?: ObjectClass[] | ObjectSchema[];
         schemaVersion?: number;
+        skipMigrationForAdditiveChanges?: boolean;
         sync?: Realm.Sync.SyncConfiguration;
     }
 
@@ -109,6 +115,53 @@ declare namespace Realm {
          * @returns Results<T>
          */
         linkingObjects<T>(objectType: string, property: string): Results<T>;
+
+        /**
+         * @returns number
+         */
+        linkingObjectsCount(objectType: string, property: string): number;
+
+        /**
+         * @param  {ToJSONOptions} options?
+         * @returns { [property: string]: any }
+         */
+        toJSON(options?: ToJSONOptions): { [property: string]: any };
+
+        /**
+         * @param  {ObjectChangeCallback} callback
+         * @returns void
+         */
+        addListener(callback: ObjectChangeCallback): void;
+
+        /**
+         * @param  {ObjectChangeCallback} callback
+         * @returns void
+         */
+        removeListener(callback: ObjectChangeCallback): void;
+
+        /**
+         * @returns void
+         */
+        removeAllListeners(): void;
+    }
+
+    interface CompiledQuery<T> {
+        readonly realm: Realm;
+        readonly objectType: string | ObjectSchema | Function;
+        readonly predicate: string;
+        run(...args: any[]): Results<T>;
+    }
+
+    interface ObjectChangeSet {
+        deleted: boolean;
+        changedProperties: string[];
+    }
+
+    type ObjectChangeCallback = (object: Object, changes: ObjectChangeSet) => void;
+
+    interface ToJSONOptions {
+        properties?: string[];
+        depth?: number;
     }
 
     const Object: {
@@ -125,10 +178,69 @@ declare namespace Realm {
         insertions: number[];
         deletions: number[];
         modifications: number[];
+        modifiedProperties: { [property: string]: number[] };
     }
 
     type CollectionChangeCallback<T> = (collection: Collection<T>, change: CollectionChangeSet) => void;
 
+    interface CollectionListenerOptions {
+        format?: 'indexes' | 'typed' | 'ranges';
+        properties?: string[];
+        priority?: 'high' | 'default' | 'low';
+    }
+
+    type AggregateFunction = 'count' | 'min' | 'max' | 'sum' | 'avg';
+
+    /**
+     * OpenStats
+     * @see { @link https://realm.io/docs/javascript/latest/api/Realm.html#~OpenStats }
+     */
+    interface OpenStats {
+        config: number;
+        schema: number;
+        open: number;
+        migration: number;
+        datetimeConversion: number;
+        accessorPrototypes: number;
+        total: number;
+        copyBundledRealmFiles: number;
+    }
+
+    /**
+     * CompactResult
+     * @see { @link https://realm.io/docs/javascript/latest/api/Realm.html#~CompactResult }
+     */
+    interface CompactResult {
+        compacted: boolean;
+        totalBytes: number;
+        usedBytes: number;
+        compactedBytes: number;
+    }
+
+    /**
+     * CallStats
+     * @see { @link https://realm.io/docs/javascript/latest/api/Realm.html#~CallStats }
+     */
+    interface CallStats {
+        calls: number;
+        totalTime: number;
+        maxTime: number;
+        histogram: number[];
+    }
+
+    /**
+     * Stats
+     * @see { @link https://realm.io/docs/javascript/latest/api/Realm.html#~Stats }
+     */
+    interface Stats {
+        liveObjects: { [kind: string]: number };
+        notificationTokens: number;
+        versions: number | null;
+        fileSize: number | null;
+        usedSize: number | null;
+        freeSize: number | null;
+    }
+
     /**
      * Collection
      * @see { @link https://realm.io/docs/javascript/latest/api/Realm.Collection.html }
@@ -139,6 +251,11 @@ declare namespace Realm {
          */
         isValid(): boolean;
 
+        /**
+         * @returns boolean
+         */
+        isEmpty(): boolean;
+
         /**
          * @param  {string} query
          * @param  {any[]} ...arg
@@ -146,6 +263,13 @@ declare namespace Realm {
          */
         filtered(query: string, ...arg: any[]): Results<T>;
 
+        /**
+         * @param  {string} query
+         * @param  {any[]} ...arg
+         * @returns Promise<Results>
+         */
+        filteredAsync(query: string, ...arg: any[]): Promise<Results<T>>;
+
         /**
          * @param  {string|SortDescriptor} descriptor
          * @param  {boolean} reverse?
@@ -153,16 +277,73 @@ declare namespace Realm {
          */
         sorted(descriptor: string | SortDescriptor, reverse?: boolean): Results<T>;
 
+        /**
+         * @param  {string|SortDescriptor} descriptor
+         * @param  {boolean} reverse?
+         * @returns Promise<Results>
+         */
+        sortedAsync(descriptor: string | SortDescriptor, reverse?: boolean): Promise<Results<T>>;
+
         /**
          * @returns Results
          */
         snapshot(): Results<T>;
 
+        /**
+         * @param  {string[]} properties
+         * @returns { [property: string]: Float64Array | any[] }
+         */
+        toColumns(properties: string[]): { [property: string]: Float64Array | any[] };
+
+        /**
+         * @param  {number} start?
+         * @param  {number} end?
+         * @param  {string[]} properties?
+         * @returns T[] | { [property: string]: any }[]
+         */
+        slice(start?: number, end?: number): T[];
+        slice(start: number | undefined, end: number | undefined, properties: string[]): { [property: string]: any }[];
+        toArray(start?: number, end?: number): T[];
+        toPlainArray(start?: number, end?: number, options?: ToJSONOptions): { [property: string]: any }[];
+
+        /**
+         * @param  {string} property
+         * @returns number | Date | undefined
+         */
+        min(property: string): number | Date | undefined;
+
+        /**
+         * @param  {string} property
+         * @returns number | Date | undefined
+         */
+        max(property: string): number | Date | undefined;
+
+        /**
+         * @param  {string} property
+         * @returns number
+         */
+        sum(property: string): number;
+
+        /**
+         * @param  {string} property
+         * @returns number | undefined
+         */
+        avg(property: string): number | undefined;
+
+        /**
+         * @param  {string} keyProperty
+         * @param  {AggregateFunction} aggregate?
+         * @param  {string} property?
+         * @returns [any, number | undefined][]
+         */
+        groupBy(keyProperty: string, aggregate?: AggregateFunction, property?: string): [any, number | undefined][];
+
         /**
          * @param  {(collection:any,changes:any)=>void} callback
+         * @param  {CollectionListenerOptions} options?
          * @returns void
          */
-        addListener(callback: CollectionChangeCallback<T>): void;
+        addListener(callback: CollectionChangeCallback<T>, options?: CollectionListenerOptions): void;
 
         /**
          * @returns void
@@ -211,6 +392,18 @@ declare namespace Realm {
          */
         splice(index: number, count?: number, object?: any): T[];
 
+        /**
+         * @param  {any[]} objects
+         * @returns number
+         */
+        pushMany(objects: any[]): number;
+
+        /**
+         * @param  {any[]} objects
+         * @returns void
+         */
+        replaceAll(objects: any[]): void;
+
         /**
          * @param  {T} object
          * @returns number
@@ -226,8 +419,27 @@ declare namespace Realm {
      * Results
      * @see { @link https://realm.io/docs/javascript/latest/api/Realm.Results.html }
      */
+    /**
+     * ExportOptions
+     * @see { @link https://realm.io/docs/javascript/latest/api/Realm.Results.html#~ExportOptions }
+     */
+    interface ExportOptions {
+        format?: 'json' | 'csv';
+        properties?: string[];
+    }
+
     interface Results<T> extends Collection<T> {
+        /**
+         * @returns number
+         */
+        count(): number;
 
+        /**
+         * @param  {string} path
+         * @param  {ExportOptions} options?
+         * @returns Promise<{ rows: number }>
+         */
+        exportTo(path: string, options?: ExportOptions): Promise<{ rows: number }>;
     }
 
     const Results: {
@@ -330,6 +542,18 @@ declare namespace Realm.Sync {
         readonly state: 'invalid' | 'active' | 'inactive';
         readonly url: string;
         readonly user: User;
+
+        addProgressNotification(direction: ProgressDirection, mode: ProgressMode, callback: ProgressNotificationCallback, options?: ProgressNotificationOptions): void;
+        removeProgressNotification(callback: ProgressNotificationCallback): void;
+    }
+
+    type ProgressDirection = 'download' | 'upload';
+    type ProgressMode = 'reportIndefinitely' | 'forCurrentlyOutstandingWork';
+    type ProgressNotificationCallback = (transferred: number, transferable: number) => void;
+
+    interface ProgressNotificationOptions {
+        minInterval?: number;
+        minDelta?: number;
     }
 
     /**
@@ -356,6 +580,14 @@ declare namespace Realm.Sync {
     function removeAllListeners(name?: string): void;
     function removeListener(regex: string, name: string, changeCallback: (changeEvent: ChangeEvent) => void): void;
     function setLogLevel(logLevel: 'all' | 'trace' | 'debug' | 'detail' | 'info' | 'warn' | 'error' | 'fatal' | 'off'): void;
+    function setLogger(level: null): void;
+    function setLogger(level: 'all' | 'trace' | 'debug' | 'detail' | 'info' | 'warn' | 'error' | 'fatal' | 'off',
+                       callback: (entries: LogEntry[], dropped: number) => void, maxBufferedMessages?: number): void;
+
+    interface LogEntry {
+        level: string;
+        message: string;
+    }
     function setAccessToken(accessToken: string): void;
 
     type Instruction = {
@@ -393,6 +625,12 @@ declare namespace Realm.Sync {
 
 declare class Realm {
     static defaultPath: string;
+    static readonly lastOpenStats: Realm.OpenStats | undefined;
+    static collectCallStats: boolean;
+    static readonly callStats: { [name: string]: Realm.CallStats };
+    static collectionEnumerationLimit: number;
+    static keepOpenAcrossReloads: boolean;
+    static versionWarningThreshold: number;
 
     readonly empty: boolean;
     readonly path: string;
@@ -423,6 +661,28 @@ declare class Realm {
      */
     static openAsync(config: Realm.Configuration, callback: (error: any, realm: Realm) => void): void
 
+    /**
+     * Compact a Realm file that isn't open on a background thread, if enough of it is free space.
+     * @param {Configuration} config? only the path and encryption key are used
+     * @param {Object} options? the free space threshold and a progress callback
+     */
+    static compactAsync(config?: Realm.Configuration, options?: {
+        threshold?: number,
+        progress?: (totalBytes: number, usedBytes: number) => void
+    }): Promise<Realm.CompactResult>
+
+    /**
+     * Delete the Realm file described by the config, with its lock, note and management files.
+     * @param {Configuration} config? only the path is used
+     */
+    static deleteFile(config?: Realm.Configuration): void;
+
+    /**
+     * Delete all Realm files in a directory on a background thread.
+     * @param {string} directory? defaults to the directory of the default path
+     */
+    static deleteFilesAsync(directory?: string): Promise<void>;
+
     /**
      * @param  {Realm.Configuration} config?
      */
@@ -446,12 +706,42 @@ declare class Realm {
      */
     create<T>(type: string | Realm.ObjectClass | Function, properties: T & Realm.ObjectPropsType, update?: boolean): T;
 
+    /**
+     * @param  {string|Realm.ObjectClass|Function} type
+     * @param  {(T&Realm.ObjectPropsType)[]} objects
+     * @param  {boolean} update?
+     * @returns number
+     */
+    createMany<T>(type: string | Realm.ObjectClass | Function, objects: (T & Realm.ObjectPropsType)[], update?: boolean): number;
+
     /**
      * @param  {Realm.Object|Realm.Object[]|Realm.List<any>|Realm.Results<any>|any} object
      * @returns void
      */
     delete(object: Realm.Object | Realm.Object[] | Realm.List<any> | Realm.Results<any> | any): void;
 
+    /**
+     * @param  {string|Realm.ObjectClass|Function} type
+     * @param  {any[]} objects
+     * @returns number
+     */
+    upsertMany<T>(type: string | Realm.ObjectClass | Function, objects: (T & Realm.ObjectPropsType)[]): number;
+
+    /**
+     * @param  {string|Realm.ObjectClass|Function} type
+     * @param  {number[]|string[]} keys
+     * @returns (T & Realm.Object | undefined)[]
+     */
+    objectsForPrimaryKeys<T>(type: string | Realm.ObjectClass | Function, keys: (number | string)[]): (T & Realm.Object | undefined)[];
+
+    /**
+     * @param  {string|Realm.ObjectClass|Function} type
+     * @param  {string} query
+     * @param  {any[]} ...arg
+     * @returns number
+     */
+    deleteWhere(type: string | Realm.ObjectClass | Function, query: string, ...arg: any[]): number;
+
     /**
      * @returns void
      */
@@ -470,12 +760,41 @@ declare class Realm {
      */
     objects<T>(type: string | Realm.ObjectSchema | Function): Realm.Results<T>;
 
+    /**
+     * @param  {string|Realm.ObjectType|Function} type
+     * @param  {string} predicate?
+     * @param  {any[]} ...arg
+     * @returns number
+     */
+    count(type: string | Realm.ObjectSchema | Function, predicate?: string, ...arg: any[]): number;
+
+    /**
+     * @param  {string|Realm.ObjectType|Function} type
+     * @param  {string} predicate
+     * @returns Realm.CompiledQuery<T>
+     */
+    compileQuery<T>(type: string | Realm.ObjectSchema | Function, predicate: string): Realm.CompiledQuery<T>;
+
+    /**
+     * @param  {string} path
+     * @param  {string|Realm.ObjectType|Function} type
+     * @param  {Object} options?
+     * @returns Promise<{ rows: number }>
+     */
+    importFrom(path: string, type: string | Realm.ObjectSchema | Function, options?: {
+        format?: 'json' | 'csv',
+        batchSize?: number,
+        update?: boolean,
+        progress?: (rows: number, bytesRead: number, totalBytes: number) => void
+    }): Promise<{ rows: number }>;
+
     /**
      * @param  {string} name
      * @param  {()=>void} callback
      * @returns void
      */
     addListener(name: string, callback: (sender: Realm, event: 'change') => void): void;
+    addListener(name: 'changeset', callback: (sender: Realm, event: 'changeset', changes: { objectTypes: string[] }) => void): void;
 
     /**
      * @param  {string} name
@@ -483,6 +802,7 @@ declare class Realm {
      * @returns void
      */
     removeListener(name: string, callback: (sender: Realm, event: 'change') => void): void;
+    removeListener(name: 'changeset', callback: (sender: Realm, event: 'changeset', changes: { objectTypes: string[] }) => void): void;
 
     /**
      * @param  {string} name?
@@ -496,6 +816,18 @@ declare class Realm {
      */
     write(callback: () => void): void;
 
+    /**
+     * @param  {()=>T} callback
+     * @returns Promise<T>
+     */
+    deferWrite<T>(callback: () => T): Promise<T>;
+
+    /**
+     * @param  {{ delay?: number, maxWrites?: number } | null} options
+     * @returns void
+     */
+    setGroupCommit(options: { delay?: number, maxWrites?: number } | null): void;
+
     /**
      * @returns void
      */
@@ -515,6 +847,12 @@ declare class Realm {
      * @returns boolean
      */
     compact(): boolean;
+
+    /**
+     * @returns Realm.Stats
+     */
+    stats(): Realm.Stats;
+
 }
 
 declare module 'realm' {
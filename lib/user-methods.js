@@ -51,33 +51,77 @@ function auth_url(server) {
     return server + 'auth';
 }
 
+const refreshBuffer = 10 * 1000;
+
 function scheduleAccessTokenRefresh(user, localRealmPath, realmUrl, expirationDate) {
-    const refreshBuffer = 10 * 1000;
     const timeout = expirationDate - Date.now() - refreshBuffer;
     setTimeout(() => refreshAccessToken(user, localRealmPath, realmUrl), timeout);
 }
 
-function print_error() {
-    (console.error || console.log).apply(console, arguments);
-}
+// Access tokens are scoped to a Realm path on the server, so all the sessions of a user for the
+// same path share one request for a token, and reuse the token until it's about to expire.
+// Entries hold the promise of the server's response, which makes concurrent refreshes join the
+// request in flight.
+const accessTokenRequests = new Map();
+
+function fetchAccessToken(user, path) {
+    const key = JSON.stringify([user.server, user.token, path]);
+    const cached = accessTokenRequests.get(key);
+    if (cached && (!cached.expires || cached.expires - Date.now() > refreshBuffer)) {
+        return cached.promise;
+    }
 
-function refreshAccessToken(user, localRealmPath, realmUrl) {
-    let parsedRealmUrl = url_parse(realmUrl);
     const url = auth_url(user.server);
     const options = {
         method: 'POST',
         body: JSON.stringify({
             data: user.token,
-            path: parsedRealmUrl.pathname,
+            path: path,
             provider: 'realm',
             app_id: ''
         }),
         headers: postHeaders
     };
-    performFetch(url, options)
-        // in case something lower in the HTTP stack breaks, try again in 10 seconds
-        .catch(() => setTimeout(() => refreshAccessToken(user, localRealmPath, realmUrl), 10 * 1000))
-        .then((response) => response.json().then((json) => { return { response, json }; }))
+    const request = {
+        expires: null,
+        promise: performFetch(url, options)
+            .then((response) => response.json().then((json) => { return { response, json }; }))
+    };
+    accessTokenRequests.set(key, request);
+
+    request.promise.then((responseAndJson) => {
+        if (responseAndJson.response.status == 200) {
+            request.expires = responseAndJson.json.access_token.token_data.expires * 1000;
+
+            // Drop the entry once the token is no longer reused, so tokens of old users and paths don't pile up.
+            // The timer doesn't keep node running, and is capped at the longest delay setTimeout() allows.
+            const delay = Math.max(0, Math.min(request.expires - refreshBuffer - Date.now(), 0x7fffffff));
+            const timer = setTimeout(() => {
+                if (accessTokenRequests.get(key) === request) {
+                    accessTokenRequests.delete(key);
+                }
+            }, delay);
+            if (timer.unref) {
+                timer.unref();
+            }
+        } else if (accessTokenRequests.get(key) === request) {
+            accessTokenRequests.delete(key);
+        }
+    }, () => {
+        if (accessTokenRequests.get(key) === request) {
+            accessTokenRequests.delete(key);
+        }
+    });
+    return request.promise;
+}
+
+function print_error() {
+    (console.error || console.log).apply(console, arguments);
+}
+
+function refreshAccessToken(user, localRealmPath, realmUrl) {
+    let parsedRealmUrl = url_parse(realmUrl);
+    fetchAccessToken(user, parsedRealmUrl.pathname)
         .then((responseAndJson) => {
             const response = responseAndJson.response;
             const json = responseAndJson.json;
@@ -111,6 +155,9 @@ function refreshAccessToken(user, localRealmPath, realmUrl) {
                     print_error(`Unhandled session token refresh error: could not look up session at path ${localRealmPath}`);
                 }
             }
+        }, () => {
+            // in case something lower in the HTTP stack breaks, try again in 10 seconds
+            setTimeout(() => refreshAccessToken(user, localRealmPath, realmUrl), 10 * 1000);
         });
 }
 
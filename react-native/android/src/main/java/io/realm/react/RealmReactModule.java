@@ -9,6 +9,7 @@ import com.facebook.react.bridge.ReactContextBaseJavaModule;
 import com.facebook.soloader.SoLoader;
 
 import java.io.IOException;
+import java.io.InputStream;
 import java.net.InetAddress;
 import java.net.NetworkInterface;
 import java.net.SocketException;
@@ -149,21 +150,46 @@ class RealmReactModule extends ReactContextBaseJavaModule {
         @Override
         public Response serve(IHTTPSession session) {
             final String cmdUri = session.getUri();
-            final HashMap<String, String> map = new HashMap<String, String>();
+            final String json;
             try {
-                session.parseBody(map);
+                json = readBody(session);
             } catch (IOException e) {
                 e.printStackTrace();
-            } catch (ResponseException e) {
-                e.printStackTrace();
+                return newFixedLengthResponse(Response.Status.BAD_REQUEST, NanoHTTPD.MIME_PLAINTEXT, "Invalid RPC request");
             }
-            final String json = map.get("postData");
             final String jsonResponse = processChromeDebugCommand(cmdUri, json);
 
             Response response = newFixedLengthResponse(jsonResponse);
             response.addHeader("Access-Control-Allow-Origin", "http://localhost:8081");
             return response;
         }
+
+        // Reads the request body straight off the connection. parseBody() would also try to decode it as a form
+        // and spool bodies over 1KB to a temporary file, which made every larger RPC request touch the disk.
+        private String readBody(IHTTPSession session) throws IOException {
+            final String contentLength = session.getHeaders().get("content-length");
+            int length = 0;
+            if (contentLength != null) {
+                try {
+                    length = Integer.parseInt(contentLength.trim());
+                } catch (NumberFormatException e) {
+                    throw new IOException("Invalid Content-Length: " + contentLength);
+                }
+                if (length < 0) {
+                    throw new IOException("Invalid Content-Length: " + contentLength);
+                }
+            }
+            final byte[] body = new byte[length];
+            final InputStream input = session.getInputStream();
+            for (int offset = 0; offset < length; ) {
+                final int read = input.read(body, offset, length - offset);
+                if (read < 0) {
+                    throw new IOException("The RPC request ended after " + offset + " of " + length + " bytes");
+                }
+                offset += read;
+            }
+            return new String(body, "UTF-8");
+        }
     }
 
     // return true if the Realm API was injected (return false when running in Chrome Debug)
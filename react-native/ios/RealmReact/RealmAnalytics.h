@@ -39,7 +39,8 @@
 // without an email signup, we feel this is a necessary step so we can collect
 // relevant data to build a better product for you. If you truly, absolutely
 // feel compelled to not send this data back to Realm, then you can set an env
-// variable named REALM_DISABLE_ANALYTICS. Since Realm is free we believe
+// variable named REALM_DISABLE_ANALYTICS, or set RealmDisableAnalytics to YES in
+// your app's Info.plist. Since Realm is free we believe
 // letting these analytics run is a small price to pay for the product & support
 // we give you.
 //
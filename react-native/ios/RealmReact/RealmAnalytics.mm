@@ -39,7 +39,8 @@
 // without an email signup, we feel this is a necessary step so we can collect
 // relevant data to build a better product for you. If you truly, absolutely
 // feel compelled to not send this data back to Realm, then you can set an env
-// variable named REALM_DISABLE_ANALYTICS. Since Realm is free we believe
+// variable named REALM_DISABLE_ANALYTICS, or set RealmDisableAnalytics to YES in
+// your app's Info.plist. Since Realm is free we believe
 // letting these analytics run is a small price to pay for the product & support
 // we give you.
 //
@@ -219,8 +220,16 @@ static NSDictionary *RLMAnalyticsPayload() {
     };
 }
 
-void RLMSendAnalytics() {
-    if (getenv("REALM_DISABLE_ANALYTICS") || !RLMIsDebuggerAttached()) {
+static bool RLMAnalyticsDisabled() {
+    if (getenv("REALM_DISABLE_ANALYTICS")) {
+        return true;
+    }
+    id disabled = NSBundle.mainBundle.infoDictionary[@"RealmDisableAnalytics"];
+    return [disabled respondsToSelector:@selector(boolValue)] && [disabled boolValue];
+}
+
+static void RLMSubmitAnalytics() {
+    if (RLMAnalyticsDisabled() || !RLMIsDebuggerAttached()) {
         return;
     }
 
@@ -232,6 +241,22 @@ void RLMSendAnalytics() {
     [[NSURLSession.sharedSession dataTaskWithURL:[NSURL URLWithString:url]] resume];
 }
 
+void RLMSendAnalytics() {
+    if (getenv("REALM_DISABLE_ANALYTICS")) {
+        return;
+    }
+
+    // This is called while the module is being loaded, so wait until the main queue gets to run again (which is
+    // after the app has finished launching) and then a little longer, and gather the payload on a background
+    // queue so that none of it competes with the app's startup.
+    dispatch_async(dispatch_get_main_queue(), ^{
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(5 * NSEC_PER_SEC)),
+                       dispatch_get_global_queue(QOS_CLASS_BACKGROUND, 0), ^{
+            RLMSubmitAnalytics();
+        });
+    });
+}
+
 #else
 
 void RLMSendAnalytics() {}
@@ -209,7 +209,7 @@ RCT_REMAP_METHOD(emit, emitEvent:(NSString *)eventName withObject:(id)object) {
 - (void)startRPC {
     [GCDWebServer setLogLevel:3];
     _webServer = [[GCDWebServer alloc] init];
-    _rpcServer = std::make_unique<RPCServer>();
+    _rpcServer = std::make_unique<RPCServer>(true);
     __weak __typeof__(self) weakSelf = self;
 
     // Add a handler to respond to POST requests on any URL
@@ -222,19 +222,31 @@ RCT_REMAP_METHOD(emit, emitEvent:(NSString *)eventName withObject:(id)object) {
 
         try {
             NSData *responseData;
+            NSString *contentType = @"application/json";
 
             if (rpcServer) {
-                json args = json::parse([[(GCDWebServerDataRequest *)request text] UTF8String]);
-                std::string responseText = rpcServer->perform_request(request.path.UTF8String, args).dump();
-
-                responseData = [NSData dataWithBytes:responseText.c_str() length:responseText.length()];
+                NSData *requestData = [(GCDWebServerDataRequest *)request data];
+                std::string path = request.path.UTF8String;
+
+                // Sessions are always created with JSON, which then negotiates the encoding of later requests.
+                bool msgpack = path != "/create_session" && rpcServer->uses_msgpack();
+                const char *requestBytes = static_cast<const char *>(requestData.bytes);
+                json args = msgpack ? parse_msgpack(requestBytes, requestData.length)
+                                    : json::parse(std::string(requestBytes, requestData.length));
+                json result = rpcServer->perform_request(path, args);
+                std::string responseText = msgpack ? dump_msgpack(result) : result.dump();
+                if (msgpack) {
+                    contentType = @"application/msgpack";
+                }
+
+                responseData = [NSData dataWithBytes:responseText.data() length:responseText.length()];
             }
             else {
                 // we have been deallocated
                 responseData = [NSData data];
             }
 
-            response = [[GCDWebServerDataResponse alloc] initWithData:responseData contentType:@"application/json"];
+            response = [[GCDWebServerDataResponse alloc] initWithData:responseData contentType:contentType];
         }
         catch(std::exception &ex) {
             NSLog(@"Invalid RPC request - %@", [(GCDWebServerDataRequest *)request text]);
@@ -280,8 +292,8 @@ void _initializeOnJSThread(JSContextRefExtractor jsContextExtractor) {
     }
     s_currentJSThread = [NSThread currentThread];
 
-    // Close all cached Realms from the previous JS thread.
-    realm::_impl::RealmCoordinator::clear_all_caches();
+    // Close all Realms from the previous JS thread.
+    RJSCloseRealmsFromPreviousContexts();
 
     RJSInitializeInContext(jsContextExtractor());
 }
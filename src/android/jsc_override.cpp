@@ -49,8 +49,8 @@ static JSGlobalContextRef create_context(JSContextGroupRef group, JSClassRef glo
     // Reinstall the hook.
     swap_function();
 
-    // Clear cache from previous instances.
-    realm::_impl::RealmCoordinator::clear_all_caches();
+    // Close the Realms of previous instances.
+    RJSCloseRealmsFromPreviousContexts();
 
     RJSInitializeInContext(ctx);
     realmContextInjected = true;
@@ -19,7 +19,11 @@
 #include <string>
 #include <stdlib.h>
 #include <unistd.h>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <sys/stat.h>
 #include <android/asset_manager.h>
 
 #include "../platform.hpp"
@@ -87,6 +91,79 @@ namespace realm {
         AAssetDir_close(assetDir);
     }
 
+    // The Realm file header holds the refs of the latest commit, so with the size it tells copies of different
+    // versions of a bundled file apart without reading all of it.
+    static const size_t realm_file_header_size = 24;
+
+    static bool is_copy_of_asset(const std::string &path, AAsset* asset, const char* asset_header, size_t header_size)
+    {
+        struct stat file_stat;
+        if (stat(path.c_str(), &file_stat) != 0 || int64_t(file_stat.st_size) != int64_t(AAsset_getLength64(asset))) {
+            return false;
+        }
+
+        char file_header[realm_file_header_size];
+        FILE* in = fopen(path.c_str(), "r");
+        if (!in) {
+            return false;
+        }
+        size_t nb_read = fread(file_header, 1, header_size, in);
+        fclose(in);
+        return nb_read == header_size && memcmp(file_header, asset_header, header_size) == 0;
+    }
+
+    std::string bundled_realm_file_path(const std::string &name)
+    {
+        // Assets live inside the APK, where they can't be opened as files, so this one is copied out
+        // the first time it's used, leaving the other bundled files where they are. It is copied again
+        // when an update of the app bundles a different version of it.
+        AAsset* asset = AAssetManager_open(s_asset_manager, name.c_str(), AASSET_MODE_STREAMING);
+        if (!asset) {
+            throw std::runtime_error("No Realm file named '" + name + "' is bundled with the app.");
+        }
+
+        char header[realm_file_header_size];
+        int header_size = 0;
+        int nb_read = 0;
+        while (header_size < int(sizeof(header)) &&
+               (nb_read = AAsset_read(asset, header + header_size, sizeof(header) - header_size)) > 0) {
+            header_size += nb_read;
+        }
+        if (nb_read < 0) {
+            AAsset_close(asset);
+            throw std::runtime_error("Failed to read the bundled Realm file '" + name + "'");
+        }
+
+        std::string dest_filename = s_default_realm_directory + '/' + name;
+        if (is_copy_of_asset(dest_filename, asset, header, header_size)) {
+            AAsset_close(asset);
+            return dest_filename;
+        }
+
+        std::string temp_filename = dest_filename + ".tmp";
+        FILE* out = fopen(temp_filename.c_str(), "w");
+        if (!out) {
+            AAsset_close(asset);
+            throw std::runtime_error("Failed to create " + temp_filename);
+        }
+
+        char buf[BUFSIZ];
+        bool copied = fwrite(header, 1, header_size, out) == size_t(header_size);
+        while (copied && (nb_read = AAsset_read(asset, buf, BUFSIZ)) > 0) {
+            copied = fwrite(buf, 1, nb_read, out) == size_t(nb_read);
+        }
+        copied = copied && nb_read >= 0;
+        copied = fclose(out) == 0 && copied;
+        AAsset_close(asset);
+
+        // Renamed into place once complete, so that an interrupted copy isn't mistaken for the file.
+        if (!copied || rename(temp_filename.c_str(), dest_filename.c_str()) != 0) {
+            unlink(temp_filename.c_str());
+            throw std::runtime_error("Failed to copy the bundled Realm file '" + name + "'");
+        }
+        return dest_filename;
+    }
+
     void remove_realm_files_from_directory(const std::string &directory)
     {
         std::string cmd = "rm " + s_default_realm_directory + "/*.realm " +
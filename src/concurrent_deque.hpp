@@ -42,6 +42,27 @@ public:
         return m_deque.empty() ? util::none : util::make_optional(do_pop_back());
     }
 
+    // Blocks until an item is available or interrupt() has been called since `interrupt_count` was
+    // read, and returns none when interrupted. Reading the count before checking for other events
+    // ensures an interruption can't be missed between the check and the wait.
+    util::Optional<T> pop_back_interruptible(size_t interrupt_count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [&] { return !m_deque.empty() || m_interrupt_count != interrupt_count; });
+        return m_deque.empty() ? util::none : util::make_optional(do_pop_back());
+    }
+
+    size_t interrupt_count() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_interrupt_count;
+    }
+
+    void interrupt() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        ++m_interrupt_count;
+        lock.unlock();
+        m_condition.notify_all();
+    }
+
     void push_front(T&& item) {
         std::unique_lock<std::mutex> lock(m_mutex);
         m_deque.push_front(std::move(item));
@@ -65,6 +86,7 @@ private:
     std::condition_variable m_condition;
     std::mutex m_mutex;
     std::deque<T> m_deque;
+    size_t m_interrupt_count = 0;
 
     T do_pop_back() {
         T item = std::move(m_deque.back());
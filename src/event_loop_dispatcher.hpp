@@ -50,13 +50,15 @@ private:
 
     struct State {
     public:
-        State(std::function<void(Args...)> func) : 
+        State(std::function<void(Args...)> func, bool coalesce) :
             m_func(func),
+            m_coalesce(coalesce),
             m_signal(nullptr) 
         { 
         }
         
         const std::function<void(Args...)> m_func;
+        const bool m_coalesce;
         std::queue<Tuple> m_invocations;
         std::mutex m_mutex;
         std::shared_ptr<EventLoopSignal<Callback>> m_signal;
@@ -69,13 +71,26 @@ private:
     public:
         void operator()()
         {
-            std::unique_lock<std::mutex> lock(m_state->m_mutex);
-            while (!m_state->m_invocations.empty()) {
-                auto& tuple = m_state->m_invocations.front();
-                ::_apply_polyfill::apply(tuple, m_state->m_func);
-                m_state->m_invocations.pop();
+            // Keep the state alive even if resetting the signal below releases this callback.
+            auto state = m_state;
+            std::queue<Tuple> invocations;
+
+            // Take the pending invocations and run them without holding the lock, so that other threads
+            // adding invocations aren't blocked on the callbacks.
+            {
+                std::lock_guard<std::mutex> lock(state->m_mutex);
+                std::swap(invocations, state->m_invocations);
+            }
+            while (!invocations.empty()) {
+                ::_apply_polyfill::apply(invocations.front(), state->m_func);
+                invocations.pop();
+            }
+
+            // Anything added meanwhile has notified the signal again, which must then stay alive.
+            std::lock_guard<std::mutex> lock(state->m_mutex);
+            if (state->m_invocations.empty()) {
+                state->m_signal.reset();
             }
-            m_state->m_signal.reset();
         }
     };
     const std::shared_ptr<EventLoopSignal<Callback>> m_signal;
@@ -83,8 +98,10 @@ private:
     const std::thread::id m_thread = std::this_thread::get_id();
     
 public:
-    EventLoopDispatcher(std::function<void(Args...)> func)
-    : m_state(std::make_shared<State>(func))
+    // When `coalesce` is true, only the latest invocation made while the event loop is busy is delivered,
+    // which suits callbacks that report the current state of something, like progress.
+    EventLoopDispatcher(std::function<void(Args...)> func, bool coalesce = false)
+    : m_state(std::make_shared<State>(func, coalesce))
     , m_signal(std::make_shared<EventLoopSignal<Callback>>(Callback{m_state}))
     {
         
@@ -102,7 +119,12 @@ public:
         {
             std::unique_lock<std::mutex> lock(m_state->m_mutex);
             m_state->m_signal = m_signal;
-            m_state->m_invocations.push(std::make_tuple(args...));
+            if (m_state->m_coalesce && !m_state->m_invocations.empty()) {
+                m_state->m_invocations.back() = std::make_tuple(args...);
+            }
+            else {
+                m_state->m_invocations.push(std::make_tuple(args...));
+            }
         }
         m_signal->notify();
     }
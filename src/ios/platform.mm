@@ -86,7 +86,20 @@ void copy_bundled_realm_files()
         }
     }
 }
-    
+
+std::string bundled_realm_file_path(const std::string &name)
+{
+    // Resources are opened where they are, as read-only Realms don't create any files next to them.
+    NSFileManager *manager = [NSFileManager defaultManager];
+    for (NSBundle *bundle in [NSBundle allBundles]) {
+        NSString *path = [[bundle resourcePath] stringByAppendingPathComponent:@(name.c_str())];
+        if ([manager fileExistsAtPath:path]) {
+            return std::string(path.UTF8String);
+        }
+    }
+    throw std::runtime_error("No Realm file named '" + name + "' is bundled with the app.");
+}
+
 void remove_realm_files_from_directory(const std::string &directory)
 {
     NSFileManager *manager = [NSFileManager defaultManager];
@@ -18,8 +18,14 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <map>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "js_types.hpp"
@@ -89,5 +95,192 @@ struct ClassDefinition {
 template<typename T, typename ClassType>
 class ObjectWrap;
 
+// The most indices a collection reports when its properties are enumerated, such as by `Object.keys()`,
+// `for...in` or a debugger, so that enumerating a huge collection doesn't create a name for every object.
+// Unlimited unless set through `Realm.collectionEnumerationLimit`.
+inline std::atomic<uint32_t> &collection_enumeration_limit() {
+    static std::atomic<uint32_t> limit(std::numeric_limits<uint32_t>::max());
+    return limit;
+}
+
+struct CallStats {
+    // Bucket i counts the calls that took less than 2^i microseconds (and at least 2^(i-1)),
+    // the last bucket counts everything slower.
+    static constexpr size_t histogram_size = 16;
+
+    uint64_t calls = 0;
+    double total_time = 0;
+    double max_time = 0;
+    std::array<uint64_t, histogram_size> histogram = {};
+
+    void record(double milliseconds) {
+        calls++;
+        total_time += milliseconds;
+        if (milliseconds > max_time) {
+            max_time = milliseconds;
+        }
+
+        size_t bucket = 0;
+        double microseconds = milliseconds * 1000;
+        while (bucket < histogram_size - 1 && microseconds >= double(1 << bucket)) {
+            bucket++;
+        }
+        histogram[bucket]++;
+    }
+};
+
+// Per entry point call counters for the wrapped native methods and accessors. The entry points are
+// named ("Class.member") when the engine templates are created, and nothing is recorded unless
+// collection has been switched on (Realm.collectCallStats), so a disabled timer costs one load.
+class CallStatsRegistry {
+  public:
+    static CallStatsRegistry &shared() {
+        // Leaked on purpose so that calls made during static destruction can't touch a dead registry.
+        static CallStatsRegistry *registry = new CallStatsRegistry();
+        return *registry;
+    }
+
+    bool enabled() const {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    void set_enabled(bool enabled) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (enabled && !m_enabled) {
+            m_stats.clear();
+        }
+        m_enabled = enabled;
+    }
+
+    template<typename Callback>
+    void register_entry_point(Callback callback, std::string name) {
+        if (!callback) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_names.emplace(reinterpret_cast<const void *>(callback), std::move(name));
+    }
+
+    void record(const void *entry_point, double milliseconds) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats[entry_point].record(milliseconds);
+    }
+
+    std::map<std::string, CallStats> snapshot() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::map<std::string, CallStats> stats;
+        for (auto &pair : m_stats) {
+            auto name = m_names.find(pair.first);
+            if (name != m_names.end()) {
+                stats.emplace(name->second, pair.second);
+            }
+        }
+        return stats;
+    }
+
+  private:
+    std::atomic<bool> m_enabled = {false};
+    mutable std::mutex m_mutex;
+    std::unordered_map<const void *, std::string> m_names;
+    std::unordered_map<const void *, CallStats> m_stats;
+};
+
+// Times the enclosing wrap<F>() call and records it against that entry point, if collection is enabled.
+class CallTimer {
+    using Clock = std::chrono::steady_clock;
+
+  public:
+    template<typename Callback>
+    CallTimer(Callback callback) {
+        if (CallStatsRegistry::shared().enabled()) {
+            m_entry_point = reinterpret_cast<const void *>(callback);
+            m_start = Clock::now();
+        }
+    }
+
+    ~CallTimer() {
+        if (m_entry_point) {
+            std::chrono::duration<double, std::milli> elapsed = Clock::now() - m_start;
+            CallStatsRegistry::shared().record(m_entry_point, elapsed.count());
+        }
+    }
+
+  private:
+    const void *m_entry_point = nullptr;
+    Clock::time_point m_start;
+};
+
+// How many native objects, lists, results and listeners are alive for each Realm file, by kind, as reported
+// by realm.stats(). A count that only ever grows points at wrappers or listeners that are never released,
+// each of which keeps the version it was created at (or a notifier) alive.
+class LiveObjectRegistry {
+  public:
+    // The kind the notification tokens of listeners are counted as.
+    static const char *notification_token_kind() { return "Realm.NotificationToken"; }
+
+    static LiveObjectRegistry &shared() {
+        // Leaked for the same reason as the call stats registry.
+        static LiveObjectRegistry *registry = new LiveObjectRegistry();
+        return *registry;
+    }
+
+    void add(const std::string &path, const std::string &kind) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_counts[path][kind]++;
+    }
+
+    void remove(const std::string &path, const std::string &kind) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto counts = m_counts.find(path);
+        if (counts == m_counts.end()) {
+            return;
+        }
+        auto count = counts->second.find(kind);
+        if (count != counts->second.end() && --count->second == 0) {
+            counts->second.erase(count);
+        }
+        if (counts->second.empty()) {
+            m_counts.erase(counts);
+        }
+    }
+
+    std::map<std::string, size_t> counts_for(const std::string &path) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto counts = m_counts.find(path);
+        return counts == m_counts.end() ? std::map<std::string, size_t>() : counts->second;
+    }
+
+  private:
+    mutable std::mutex m_mutex;
+    std::map<std::string, std::map<std::string, size_t>> m_counts;
+};
+
+// Counts its owner in the LiveObjectRegistry for as long as it exists. Copies are counted too.
+class LiveObjectCounter {
+  public:
+    LiveObjectCounter(std::string path, std::string kind) : m_path(std::move(path)), m_kind(std::move(kind)) {
+        LiveObjectRegistry::shared().add(m_path, m_kind);
+    }
+    LiveObjectCounter(const LiveObjectCounter &other) : LiveObjectCounter(other.m_path, other.m_kind) {}
+
+    LiveObjectCounter &operator=(const LiveObjectCounter &other) {
+        if (this != &other) {
+            LiveObjectRegistry::shared().remove(m_path, m_kind);
+            m_path = other.m_path;
+            m_kind = other.m_kind;
+            LiveObjectRegistry::shared().add(m_path, m_kind);
+        }
+        return *this;
+    }
+
+    ~LiveObjectCounter() {
+        LiveObjectRegistry::shared().remove(m_path, m_kind);
+    }
+
+  private:
+    std::string m_path;
+    std::string m_kind;
+};
+
 } // js
 } // realm
@@ -18,11 +18,25 @@
 
 #pragma once
 
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "js_class.hpp"
 #include "js_types.hpp"
 #include "js_observable.hpp"
 
 #include "collection_notifications.hpp"
+#include "impl/collection_change_builder.hpp"
+#include "object_schema.hpp"
+#include "util/event_loop_signal.hpp"
+#include "util/format.hpp"
+
+#include <realm/group.hpp>
 
 namespace realm {
 namespace js {
@@ -30,44 +44,464 @@ namespace js {
 // Empty class that merely serves as useful type for now.
 class Collection {};
 
+// How the indices of a change set are handed to collection listeners.
+enum class ChangeSetFormat {
+    Indexes,    // Arrays of numbers.
+    Typed,      // Uint32Arrays.
+    Ranges,     // Arrays of [start, count] pairs, one per contiguous run of indices.
+};
+
+// When a collection listener is called after a change, relative to the other listeners of its Realm.
+enum class ListenerPriority {
+    High,       // Right away, before the default-priority listeners.
+    Default,    // Right away, unless there are high-priority listeners to let go first.
+    Low,        // Later, a little at a time, once the others have run.
+};
+
+struct CollectionListenerOptions {
+    ChangeSetFormat format = ChangeSetFormat::Indexes;
+    ListenerPriority priority = ListenerPriority::Default;
+
+    // The properties whose changes are reported, by name and table column. When `filter_properties`
+    // is set, modifications to other properties are left out and don't cause a notification on their own.
+    std::vector<std::pair<std::string, size_t>> properties;
+    bool filter_properties = false;
+};
+
+// Tracks the version counters of every table in a group, which move whenever a table (or a table it
+// links to) changes, to tell whether anything derived from the Realm may have become stale.
+class TableVersions {
+  public:
+    // Returns whether no table has changed since the last call.
+    bool update(const Group &group) {
+        size_t count = group.size();
+        bool unchanged = m_versions.size() == count;
+        m_versions.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            uint_fast64_t version = group.get_table(i)->get_version_counter();
+            unchanged = unchanged && m_versions[i] == version;
+            m_versions[i] = version;
+        }
+        return unchanged;
+    }
+
+  private:
+    std::vector<uint_fast64_t> m_versions;
+};
+
+// Maps the rows in a collection to their positions, so that repeatedly looking up the position of
+// objects, such as when checking the selection state of every rendered row, doesn't scan the whole
+// collection each time. The map is only built once a second lookup is made without the Realm having
+// changed in between, and is dropped as soon as any table's version counter moves, so a single lookup
+// after each change costs no more than the scan it replaces.
+class PositionIndex {
+  public:
+    template<typename Collection, typename Scan>
+    size_t find(Collection &collection, const Group &group, size_t row_index, Scan &&scan) {
+        if (!m_table_versions.update(group)) {
+            m_positions.clear();
+            m_built = false;
+            m_lookups = 0;
+        }
+        if (!m_built && ++m_lookups < 2) {
+            return scan();
+        }
+        if (!m_built) {
+            size_t size = collection.size();
+            m_positions.reserve(size);
+            for (size_t i = 0; i < size; i++) {
+                auto row = collection.get(i);
+                if (row.is_attached()) {
+                    // Lists can hold an object more than once, and its position is the first one.
+                    m_positions.emplace(row.get_index(), i);
+                }
+            }
+            m_built = true;
+        }
+
+        auto it = m_positions.find(row_index);
+        return it != m_positions.end() ? it->second : realm::not_found;
+    }
+
+  private:
+    TableVersions m_table_versions;
+    std::unordered_map<size_t, size_t> m_positions;
+    size_t m_lookups = 0;
+    bool m_built = false;
+};
+
+// Remembers counts computed while no table has changed, so that checking the size of a query for a
+// badge or an empty state on every render doesn't run the query again until the Realm changes.
+class CountCache {
+  public:
+    template<typename Count>
+    size_t get(const Group &group, const std::string &key, Count &&count) {
+        if (!m_table_versions.update(group)) {
+            m_counts.clear();
+        }
+        auto it = m_counts.find(key);
+        if (it == m_counts.end()) {
+            it = m_counts.emplace(key, count()).first;
+        }
+        return it->second;
+    }
+
+    void clear() {
+        m_counts.clear();
+    }
+
+  private:
+    TableVersions m_table_versions;
+    std::unordered_map<std::string, size_t> m_counts;
+};
+
+// Runs the collection listeners of a Realm in order of priority. Core calls all of them in one burst after
+// each change, in the order they were added, so on its own the listener of the list on screen may well be
+// the last one to run. High-priority listeners are still called right away. While any are registered,
+// default-priority listeners are instead called on the next turn of the event loop, and low-priority ones
+// always are, after those and only for as long as the frame budget allows per turn, leaving the rest for the
+// turns after. The changes for a listener that is still waiting when the next ones arrive are merged into one
+// change set, so that it always describes the collection as the listener then finds it. The changes made by a
+// write transaction on this thread only arrive after it is committed, so no listener may still be waiting when
+// it is: the waiting listeners are run both before the transaction begins and once it has.
+class ListenerScheduler {
+    struct State;
+
+  public:
+    using Callback = std::function<void(CollectionChangeSet)>;
+
+    // How long low-priority listeners may run in one turn of the event loop: half a frame at 60 fps.
+    static std::chrono::milliseconds low_priority_budget() {
+        return std::chrono::milliseconds(8);
+    }
+
+    class Listener {
+      public:
+        ~Listener() {
+            auto state = m_state.lock();
+            if (state && m_priority == ListenerPriority::High) {
+                state->high_priority_count--;
+            }
+        }
+
+      private:
+        friend class ListenerScheduler;
+
+        Listener(std::shared_ptr<State> state, ListenerPriority priority, Callback callback)
+        : m_state(std::move(state)), m_priority(priority), m_callback(std::move(callback)) {}
+
+        std::weak_ptr<State> m_state;
+        ListenerPriority m_priority;
+        Callback m_callback;
+        util::Optional<_impl::CollectionChangeBuilder> m_pending_changes;
+    };
+
+    ListenerScheduler() : m_state(std::make_shared<State>()) {
+        m_state->signal = std::make_shared<EventLoopSignal<Flush>>(Flush{m_state});
+    }
+
+    // The listener is unscheduled when the returned pointer, held by its notification token, is released.
+    std::shared_ptr<Listener> add(ListenerPriority priority, Callback callback) {
+        if (priority == ListenerPriority::High) {
+            m_state->high_priority_count++;
+        }
+        return std::shared_ptr<Listener>(new Listener(m_state, priority, std::move(callback)));
+    }
+
+    // Runs all the listeners that are waiting, in order of priority, without waiting for the event loop.
+    void flush_waiting() {
+        // A listener may close the Realm, and so destroy this scheduler, while it runs.
+        auto state = m_state;
+        flush(*state, false);
+    }
+
+    // Called by the listener's notification callback with the changes core delivered to it.
+    static void deliver(const std::shared_ptr<Listener> &listener, CollectionChangeSet change_set) {
+        auto state = listener->m_state.lock();
+        bool waiting = bool(listener->m_pending_changes);
+        if (!state || listener->m_priority == ListenerPriority::High ||
+            (listener->m_priority == ListenerPriority::Default && !waiting && state->high_priority_count == 0)) {
+            listener->m_callback(std::move(change_set));
+            return;
+        }
+
+        // The builder tracks modifications by their new indexes, and works out the old ones when finalized.
+        _impl::CollectionChangeBuilder changes(change_set.deletions, change_set.insertions, change_set.modifications_new, change_set.moves);
+        changes.columns = std::move(change_set.columns);
+        if (waiting) {
+            listener->m_pending_changes->merge(std::move(changes));
+            return;
+        }
+
+        listener->m_pending_changes = std::move(changes);
+        auto &queue = listener->m_priority == ListenerPriority::Default ? state->default_queue : state->low_queue;
+        queue.push_back(listener);
+        schedule(*state);
+    }
+
+  private:
+    struct Flush {
+        std::weak_ptr<State> state;
+
+        void operator()() {
+            if (auto locked = state.lock()) {
+                flush(*locked, true);
+            }
+        }
+    };
+
+    struct State {
+        size_t high_priority_count = 0;
+        std::deque<std::weak_ptr<Listener>> default_queue;
+        std::deque<std::weak_ptr<Listener>> low_queue;
+        std::shared_ptr<EventLoopSignal<Flush>> signal;
+        bool flush_scheduled = false;
+    };
+
+    const std::shared_ptr<State> m_state;
+
+    static void schedule(State &state) {
+        if (!state.flush_scheduled && (!state.default_queue.empty() || !state.low_queue.empty())) {
+            state.flush_scheduled = true;
+            state.signal->notify();
+        }
+    }
+
+    static void run(const std::shared_ptr<Listener> &listener) {
+        auto changes = std::move(*listener->m_pending_changes).finalize();
+        listener->m_pending_changes = util::none;
+        listener->m_callback(std::move(changes));
+    }
+
+    // Low-priority listeners are only held to their budget when flushing on a turn of the event loop.
+    static void flush(State &state, bool within_budget) {
+        state.flush_scheduled = false;
+        try {
+            // Listeners queued while these run wait for the next turn.
+            auto default_queue = std::move(state.default_queue);
+            state.default_queue.clear();
+            while (!default_queue.empty()) {
+                auto listener = default_queue.front().lock();
+                default_queue.pop_front();
+                if (listener) {
+                    run(listener);
+                }
+            }
+
+            auto deadline = std::chrono::steady_clock::now() + low_priority_budget();
+            size_t count = state.low_queue.size();
+            while (count-- && !state.low_queue.empty() && (!within_budget || std::chrono::steady_clock::now() < deadline)) {
+                auto listener = state.low_queue.front().lock();
+                state.low_queue.pop_front();
+                if (listener) {
+                    run(listener);
+                }
+            }
+        }
+        catch (...) {
+            // The listeners after the one that threw still get their turn.
+            schedule(state);
+            throw;
+        }
+        schedule(state);
+    }
+};
+
+// The notification token of a collection listener, counted in realm.stats() while it is registered, and its
+// place in the Realm's ListenerScheduler.
+struct CountedNotificationToken {
+    NotificationToken token;
+    LiveObjectCounter count;
+    std::shared_ptr<ListenerScheduler::Listener> listener;
+};
+
 template<typename T>
 struct CollectionClass : ClassDefinition<T, Collection, ObservableClass<T>> {
     using ContextType = typename T::Context;
     using ValueType = typename T::Value;
     using ObjectType = typename T::Object;
+    using FunctionType = typename T::Function;
     using Object = js::Object<T>;
     using Value = js::Value<T>;
+    using Function = js::Function<T>;
+    using String = js::String<T>;
 
     std::string const name = "Collection";
     
-    static inline ValueType create_collection_change_set(ContextType ctx, const CollectionChangeSet &change_set);
+    static inline CollectionListenerOptions validated_listener_options(ContextType ctx, const ObjectSchema &object_schema,
+                                                                       size_t argc, const ValueType arguments[]);
+    static inline bool should_notify(const CollectionChangeSet &change_set, const CollectionListenerOptions &options);
+    static inline ValueType create_collection_change_set(ContextType ctx, const CollectionChangeSet &change_set,
+                                                         const CollectionListenerOptions &options = {});
+    static inline ValueType create_index_set(ContextType ctx, const IndexSet &index_set, ChangeSetFormat format);
+    static inline ObjectType create_typed_array(ContextType ctx, const std::vector<uint32_t> &values);
+    static inline ObjectType create_typed_array(ContextType ctx, const std::vector<double> &values);
 };
 
 template<typename T>
-typename T::Value CollectionClass<T>::create_collection_change_set(ContextType ctx, const CollectionChangeSet &change_set)
+typename T::Object CollectionClass<T>::create_typed_array(ContextType ctx, const std::vector<uint32_t> &values)
+{
+    return Object::create_typed_array(ctx, TypedArrayType::Uint32, values.data(), values.size());
+}
+
+template<typename T>
+typename T::Object CollectionClass<T>::create_typed_array(ContextType ctx, const std::vector<double> &values)
+{
+    return Object::create_typed_array(ctx, TypedArrayType::Float64, values.data(), values.size());
+}
+
+template<typename T>
+CollectionListenerOptions CollectionClass<T>::validated_listener_options(ContextType ctx, const ObjectSchema &object_schema,
+                                                                        size_t argc, const ValueType arguments[])
+{
+    static const String format_string = "format";
+    static const String properties_string = "properties";
+    static const String priority_string = "priority";
+
+    CollectionListenerOptions options;
+    for (auto &prop : object_schema.persisted_properties) {
+        options.properties.emplace_back(prop.name, prop.table_column);
+    }
+
+    if (argc < 2 || Value::is_undefined(ctx, arguments[1])) {
+        return options;
+    }
+
+    ObjectType options_object = Value::validated_to_object(ctx, arguments[1], "options");
+    ValueType properties_value = Object::get_property(ctx, options_object, properties_string);
+    if (!Value::is_undefined(ctx, properties_value)) {
+        ObjectType properties_array = Value::validated_to_array(ctx, properties_value, "properties");
+        uint32_t count = Object::validated_get_length(ctx, properties_array);
+
+        options.properties.clear();
+        options.filter_properties = true;
+        for (uint32_t i = 0; i < count; i++) {
+            std::string name = Object::validated_get_string(ctx, properties_array, i);
+            auto prop = object_schema.property_for_name(name);
+            if (!prop || prop->type == PropertyType::LinkingObjects) {
+                throw std::invalid_argument(util::format("Property '%1' does not exist on object type '%2'", name, object_schema.name));
+            }
+            options.properties.emplace_back(prop->name, prop->table_column);
+        }
+    }
+
+    ValueType format_value = Object::get_property(ctx, options_object, format_string);
+    if (!Value::is_undefined(ctx, format_value)) {
+        std::string format = Value::validated_to_string(ctx, format_value, "format");
+        if (format == "indexes") {
+            options.format = ChangeSetFormat::Indexes;
+        }
+        else if (format == "typed") {
+            options.format = ChangeSetFormat::Typed;
+        }
+        else if (format == "ranges") {
+            options.format = ChangeSetFormat::Ranges;
+        }
+        else {
+            throw std::invalid_argument("Change set format must be 'indexes', 'typed' or 'ranges'.");
+        }
+    }
+
+    ValueType priority_value = Object::get_property(ctx, options_object, priority_string);
+    if (!Value::is_undefined(ctx, priority_value)) {
+        std::string priority = Value::validated_to_string(ctx, priority_value, "priority");
+        if (priority == "high") {
+            options.priority = ListenerPriority::High;
+        }
+        else if (priority == "default") {
+            options.priority = ListenerPriority::Default;
+        }
+        else if (priority == "low") {
+            options.priority = ListenerPriority::Low;
+        }
+        else {
+            throw std::invalid_argument("Listener priority must be 'high', 'default' or 'low'.");
+        }
+    }
+    return options;
+}
+
+template<typename T>
+bool CollectionClass<T>::should_notify(const CollectionChangeSet &change_set, const CollectionListenerOptions &options)
+{
+    // Without a filter, and for the initial (empty) change set, every notification is delivered.
+    if (!options.filter_properties || change_set.modifications.empty()) {
+        return true;
+    }
+    if (!change_set.insertions.empty() || !change_set.deletions.empty() || !change_set.moves.empty()) {
+        return true;
+    }
+    for (auto &prop : options.properties) {
+        if (prop.second < change_set.columns.size() && !change_set.columns[prop.second].empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T>
+typename T::Value CollectionClass<T>::create_index_set(ContextType ctx, const IndexSet &index_set, ChangeSetFormat format)
+{
+    switch (format) {
+        case ChangeSetFormat::Typed: {
+            std::vector<uint32_t> indexes;
+            indexes.reserve(index_set.count());
+            for (auto index : index_set.as_indexes()) {
+                indexes.push_back(uint32_t(index));
+            }
+            return create_typed_array(ctx, indexes);
+        }
+        case ChangeSetFormat::Ranges: {
+            std::vector<ValueType> ranges;
+            for (auto range : index_set) {
+                ValueType pair[2] = {Value::from_number(ctx, range.first), Value::from_number(ctx, range.second - range.first)};
+                ranges.push_back(Object::create_array(ctx, 2, pair));
+            }
+            return Object::create_array(ctx, ranges);
+        }
+        case ChangeSetFormat::Indexes:
+            break;
+    }
+
+    std::vector<ValueType> indexes;
+    for (auto index : index_set.as_indexes()) {
+        indexes.push_back(Value::from_number(ctx, index));
+    }
+    return Object::create_array(ctx, indexes);
+}
+
+template<typename T>
+typename T::Value CollectionClass<T>::create_collection_change_set(ContextType ctx, const CollectionChangeSet &change_set,
+                                                                   const CollectionListenerOptions &options)
 {
     ObjectType object = Object::create_empty(ctx);
-    std::vector<ValueType> deletions, insertions, modifications;
-    
+
     if (change_set.deletions.count() == std::numeric_limits<size_t>::max()) {
-        deletions.push_back(Value::from_null(ctx));
+        ValueType all_deleted = Value::from_null(ctx);
+        Object::set_property(ctx, object, "deletions", Object::create_array(ctx, 1, &all_deleted));
     }
     else {
-        for (auto index : change_set.deletions.as_indexes()) {
-            deletions.push_back(Value::from_number(ctx, index));
-        }
-    }
-    Object::set_property(ctx, object, "deletions", Object::create_array(ctx, deletions));
-    
-    for (auto index : change_set.insertions.as_indexes()) {
-        insertions.push_back(Value::from_number(ctx, index));
+        Object::set_property(ctx, object, "deletions", create_index_set(ctx, change_set.deletions, options.format));
     }
-    Object::set_property(ctx, object, "insertions", Object::create_array(ctx, insertions));
-    
-    for (auto index : change_set.modifications.as_indexes()) {
-        modifications.push_back(Value::from_number(ctx, index));
+    Object::set_property(ctx, object, "insertions", create_index_set(ctx, change_set.insertions, options.format));
+
+    // Report which rows changed in each of the listened-to properties, and restrict the modifications to
+    // those rows when filtering by property.
+    ObjectType modified_properties = Object::create_empty(ctx);
+    IndexSet filtered_modifications;
+    for (auto &prop : options.properties) {
+        if (prop.second < change_set.columns.size() && !change_set.columns[prop.second].empty()) {
+            auto &rows = change_set.columns[prop.second];
+            Object::set_property(ctx, modified_properties, prop.first, create_index_set(ctx, rows, options.format));
+            if (options.filter_properties) {
+                filtered_modifications.add(rows);
+            }
+        }
     }
-    Object::set_property(ctx, object, "modifications", Object::create_array(ctx, modifications));
+
+    auto &modifications = options.filter_properties ? filtered_modifications : change_set.modifications;
+    Object::set_property(ctx, object, "modifications", create_index_set(ctx, modifications, options.format));
+    Object::set_property(ctx, object, "modifiedProperties", modified_properties);
 
     return object;
 }
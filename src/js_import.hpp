@@ -0,0 +1,524 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2017 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "js_types.hpp"
+
+#include "base64.hpp"
+#include "json.hpp"
+
+#include "object_accessor.hpp"
+#include "object_store.hpp"
+#include "shared_realm.hpp"
+
+namespace realm {
+namespace js {
+
+using json = nlohmann::json;
+
+// The default values of each object type, converted to JSON on the JS thread so they can be used
+// by an import running without one.
+using ImportDefaults = std::map<std::string, std::map<std::string, json>>;
+
+namespace _impl {
+// Parses an ISO 8601 date and time such as "2017-06-01T12:30:00.000Z", with an optional fraction of
+// a second and either "Z" or an offset from UTC.
+inline Timestamp parse_iso_timestamp(const std::string &string) {
+    int year, month, day, hours, minutes, seconds, consumed = 0;
+    if (sscanf(string.c_str(), "%d-%d-%dT%d:%d:%d%n", &year, &month, &day, &hours, &minutes, &seconds, &consumed) != 6) {
+        throw std::invalid_argument(util::format("'%1' is not an ISO 8601 date.", string));
+    }
+
+    const char *rest = string.c_str() + consumed;
+    int64_t nanoseconds = 0;
+    if (*rest == '.') {
+        int64_t scale = 100000000;
+        for (rest++; *rest >= '0' && *rest <= '9'; rest++, scale /= 10) {
+            nanoseconds += (*rest - '0') * scale;
+        }
+    }
+
+    int64_t offset = 0;
+    if (*rest == '+' || *rest == '-') {
+        int offset_hours = 0, offset_minutes = 0;
+        if (sscanf(rest + 1, "%2d:%2d", &offset_hours, &offset_minutes) != 2) {
+            throw std::invalid_argument(util::format("'%1' is not an ISO 8601 date.", string));
+        }
+        offset = (*rest == '-' ? -1 : 1) * (offset_hours * 3600 + offset_minutes * 60);
+    }
+    else if (*rest != 'Z' && *rest != '\0') {
+        throw std::invalid_argument(util::format("'%1' is not an ISO 8601 date.", string));
+    }
+
+    // Days since the epoch of a civil date in the proleptic Gregorian calendar.
+    int64_t y = year - (month <= 2 ? 1 : 0);
+    int64_t era = (y >= 0 ? y : y - 399) / 400;
+    int64_t year_of_era = y - era * 400;
+    int64_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    int64_t days = era * 146097 + day_of_era - 719468;
+
+    int64_t total_seconds = days * 86400 + hours * 3600 + minutes * 60 + seconds - offset;
+    return Timestamp(total_seconds, static_cast<int32_t>(nanoseconds));
+}
+
+inline bool is_valid_json_for_property(const json &value, const Property &prop) {
+    if (value.is_null()) {
+        return prop.is_nullable || prop.type == PropertyType::Object;
+    }
+    switch (prop.type) {
+        case PropertyType::Bool:
+            return value.is_boolean();
+        case PropertyType::Int:
+        case PropertyType::Float:
+        case PropertyType::Double:
+            return value.is_number();
+        case PropertyType::String:
+        case PropertyType::Data:
+            return value.is_string();
+        case PropertyType::Date:
+            return value.is_string() || value.is_number();
+        case PropertyType::Object:
+            return value.is_object() || value.is_string() || value.is_number_integer();
+        case PropertyType::Array:
+            return value.is_array();
+        default:
+            return false;
+    }
+}
+} // namespace _impl
+
+// The accessor context used to create objects from parsed JSON values. Values are passed around as
+// pointers into the parsed record so that nothing is copied on the way to the table. Links may be
+// given either as a nested object, which is created, or as the primary key of an existing object.
+class JSONAccessor {
+  public:
+    using ValueType = const json *;
+    using OptionalValue = util::Optional<ValueType>;
+
+    JSONAccessor(std::shared_ptr<Realm> realm, const ObjectSchema &object_schema, const ImportDefaults &defaults)
+    : m_realm(std::move(realm)), m_object_schema(object_schema), m_defaults(defaults) { }
+
+    JSONAccessor(JSONAccessor &parent, const Property &prop)
+    : m_realm(parent.m_realm)
+    , m_object_schema(*m_realm->schema().find(prop.object_type))
+    , m_defaults(parent.m_defaults)
+    { }
+
+    OptionalValue value_for_property(ValueType dict, std::string const& prop_name, size_t prop_index) {
+        if (!dict->is_object()) {
+            throw std::invalid_argument(util::format("Value for '%1' must be an object.", m_object_schema.name));
+        }
+        auto it = dict->find(prop_name);
+        if (it == dict->end()) {
+            return util::none;
+        }
+        const auto &prop = m_object_schema.persisted_properties[prop_index];
+        if (!_impl::is_valid_json_for_property(*it, prop)) {
+            throw TypeErrorException(util::format("%1.%2", m_object_schema.name, prop.name),
+                                     js_type_name_for_property_type(prop.type));
+        }
+        return ValueType(&*it);
+    }
+
+    OptionalValue default_value_for_property(const ObjectSchema &object_schema, const std::string &prop_name) {
+        auto defaults = m_defaults.find(object_schema.name);
+        if (defaults == m_defaults.end()) {
+            return util::none;
+        }
+        auto it = defaults->second.find(prop_name);
+        return it != defaults->second.end() ? util::make_optional(ValueType(&it->second)) : util::none;
+    }
+
+    template<typename T>
+    T unbox(ValueType value, bool create = false, bool update = false);
+
+    bool is_null(ValueType const& value) {
+        return value->is_null();
+    }
+    ValueType null_value() {
+        static const json null_json;
+        return &null_json;
+    }
+
+    template<typename Fn>
+    void enumerate_list(ValueType& value, Fn&& func) {
+        for (auto &element : *value) {
+            func(ValueType(&element));
+        }
+    }
+
+    bool allow_missing(ValueType const&) const noexcept { return false; }
+    void will_change(realm::Object&, realm::Property const&) { }
+    void did_change() { }
+
+    std::string print(ValueType const& value) { return value->dump(); }
+
+  private:
+    std::shared_ptr<Realm> m_realm;
+    const ObjectSchema& m_object_schema;
+    const ImportDefaults& m_defaults;
+    std::string m_binary_buffer;
+
+    const std::string &string_value(ValueType value) {
+        return *value->get_ptr<const std::string *>();
+    }
+
+    RowExpr row_for_primary_key(ValueType value) {
+        auto primary_key = m_object_schema.primary_key_property();
+        if (!primary_key) {
+            throw std::invalid_argument(util::format("'%1' has no primary key, so links to it must be given as objects.", m_object_schema.name));
+        }
+
+        auto table = ObjectStore::table_for_object_type(m_realm->read_group(), m_object_schema.name);
+        size_t row_index;
+        if (primary_key->type == PropertyType::String) {
+            if (!value->is_string()) {
+                throw TypeErrorException(util::format("%1.%2", m_object_schema.name, primary_key->name), "string");
+            }
+            row_index = table->find_first_string(primary_key->table_column, string_value(value));
+        }
+        else {
+            if (!value->is_number_integer()) {
+                throw TypeErrorException(util::format("%1.%2", m_object_schema.name, primary_key->name), "number");
+            }
+            row_index = table->find_first_int(primary_key->table_column, value->get<int64_t>());
+        }
+        if (row_index == realm::not_found) {
+            throw std::invalid_argument(util::format("No '%1' object with primary key %2 exists.", m_object_schema.name, value->dump()));
+        }
+        return table->get(row_index);
+    }
+};
+
+template<>
+inline bool JSONAccessor::unbox<bool>(ValueType value, bool, bool) {
+    return value->get<bool>();
+}
+
+template<>
+inline int64_t JSONAccessor::unbox<int64_t>(ValueType value, bool, bool) {
+    return value->get<int64_t>();
+}
+
+template<>
+inline float JSONAccessor::unbox<float>(ValueType value, bool, bool) {
+    return value->get<float>();
+}
+
+template<>
+inline double JSONAccessor::unbox<double>(ValueType value, bool, bool) {
+    return value->get<double>();
+}
+
+template<>
+inline util::Optional<bool> JSONAccessor::unbox<util::Optional<bool>>(ValueType value, bool, bool) {
+    return value->is_null() ? util::none : util::make_optional(value->get<bool>());
+}
+
+template<>
+inline util::Optional<int64_t> JSONAccessor::unbox<util::Optional<int64_t>>(ValueType value, bool, bool) {
+    return value->is_null() ? util::none : util::make_optional(value->get<int64_t>());
+}
+
+template<>
+inline util::Optional<float> JSONAccessor::unbox<util::Optional<float>>(ValueType value, bool, bool) {
+    return value->is_null() ? util::none : util::make_optional(value->get<float>());
+}
+
+template<>
+inline util::Optional<double> JSONAccessor::unbox<util::Optional<double>>(ValueType value, bool, bool) {
+    return value->is_null() ? util::none : util::make_optional(value->get<double>());
+}
+
+template<>
+inline StringData JSONAccessor::unbox<StringData>(ValueType value, bool, bool) {
+    if (value->is_null()) {
+        return StringData();
+    }
+    // Points into the parsed record, which outlives the write.
+    return string_value(value);
+}
+
+template<>
+inline BinaryData JSONAccessor::unbox<BinaryData>(ValueType value, bool, bool) {
+    if (value->is_null()) {
+        return BinaryData();
+    }
+    if (!base64_decode(string_value(value), &m_binary_buffer)) {
+        throw std::invalid_argument("Binary data must be base64 encoded.");
+    }
+    return BinaryData(m_binary_buffer.data(), m_binary_buffer.size());
+}
+
+template<>
+inline Mixed JSONAccessor::unbox<Mixed>(ValueType, bool, bool) {
+    throw std::runtime_error("'Any' type is unsupported");
+}
+
+template<>
+inline Timestamp JSONAccessor::unbox<Timestamp>(ValueType value, bool, bool) {
+    if (value->is_null()) {
+        return Timestamp();
+    }
+    if (value->is_string()) {
+        return _impl::parse_iso_timestamp(string_value(value));
+    }
+    double milliseconds = value->get<double>();
+    int64_t seconds = milliseconds / 1000;
+    int32_t nanoseconds = ((int64_t)milliseconds % 1000) * 1000000;
+    return Timestamp(seconds, nanoseconds);
+}
+
+template<>
+inline RowExpr JSONAccessor::unbox<RowExpr>(ValueType value, bool create, bool try_update) {
+    if (!value->is_object()) {
+        return row_for_primary_key(value);
+    }
+    if (!create) {
+        throw std::runtime_error("object is not a Realm Object");
+    }
+    return realm::Object::create<ValueType>(*this, m_realm, m_object_schema, value, try_update).row();
+}
+
+// Reads records one at a time from a newline-delimited JSON file, one object (or array of values in
+// property order) per line, or from a CSV file whose header line names the properties of each column.
+// CSV cells are converted to the type of their property, and empty cells are read as null for
+// optional properties and left out otherwise, so that defaults apply.
+class RowImporter {
+  public:
+    enum class Format { JSON, CSV };
+
+    RowImporter(const std::string &path, Format format, const realm::Schema &schema, const ObjectSchema &object_schema)
+    : m_file(path, std::ios::in | std::ios::binary), m_format(format), m_object_schema(object_schema) {
+        if (!m_file) {
+            throw std::runtime_error(util::format("Cannot open '%1' for reading.", path));
+        }
+        m_file.seekg(0, std::ios::end);
+        m_total_bytes = m_file.tellg();
+        m_file.seekg(0, std::ios::beg);
+
+        if (m_format == Format::CSV) {
+            std::vector<std::string> names;
+            if (!read_csv_record(names)) {
+                throw std::invalid_argument(util::format("'%1' has no header line.", path));
+            }
+            for (auto &name : names) {
+                auto prop = m_object_schema.property_for_name(name);
+                if (!prop || prop->type == PropertyType::LinkingObjects) {
+                    throw std::invalid_argument(util::format("Column '%1' is not a property of '%2'.", name, m_object_schema.name));
+                }
+                bool string_key = false;
+                if (prop->type == PropertyType::Object) {
+                    auto primary_key = schema.find(prop->object_type)->primary_key_property();
+                    string_key = primary_key && primary_key->type == PropertyType::String;
+                }
+                m_columns.push_back({prop, string_key});
+            }
+        }
+    }
+
+    // Returns false once the end of the file is reached.
+    bool next(json &record) {
+        return m_format == Format::JSON ? next_json(record) : next_csv(record);
+    }
+
+    size_t line() const { return m_line; }
+    uint64_t total_bytes() const { return m_total_bytes; }
+    uint64_t bytes_read() {
+        auto position = m_file.tellg();
+        return position < 0 ? m_total_bytes : uint64_t(position);
+    }
+
+  private:
+    struct Column {
+        const Property *property;
+        bool string_key;
+    };
+
+    std::ifstream m_file;
+    Format m_format;
+    const ObjectSchema &m_object_schema;
+    std::vector<Column> m_columns;
+    std::vector<std::string> m_cells;
+    std::string m_buffer;
+    uint64_t m_total_bytes = 0;
+    size_t m_line = 0;
+
+    bool next_json(json &record) {
+        while (std::getline(m_file, m_buffer)) {
+            m_line++;
+            if (m_buffer.find_first_not_of(" \t\r") == std::string::npos) {
+                continue;
+            }
+            record = json::parse(m_buffer);
+            if (record.is_array()) {
+                record = record_for_property_array(record);
+            }
+            return true;
+        }
+        if (!m_file.eof()) {
+            throw std::runtime_error("Failed to read the file being imported.");
+        }
+        return false;
+    }
+
+    json record_for_property_array(const json &values) {
+        auto &properties = m_object_schema.persisted_properties;
+        if (values.size() != properties.size()) {
+            throw std::invalid_argument("Array must contain values for all object properties");
+        }
+        json record = json::object();
+        for (size_t i = 0; i < properties.size(); i++) {
+            record[properties[i].name] = values[i];
+        }
+        return record;
+    }
+
+    bool next_csv(json &record) {
+        if (!read_csv_record(m_cells)) {
+            return false;
+        }
+        if (m_cells.size() != m_columns.size()) {
+            throw std::invalid_argument(util::format("Expected %1 cells but found %2.", m_columns.size(), m_cells.size()));
+        }
+        record = json::object();
+        for (size_t i = 0; i < m_columns.size(); i++) {
+            const Property &prop = *m_columns[i].property;
+            std::string &cell = m_cells[i];
+            if (cell.empty()) {
+                if (prop.is_nullable || prop.type == PropertyType::Object) {
+                    record[prop.name] = nullptr;
+                }
+                else if (prop.type == PropertyType::String) {
+                    record[prop.name] = "";
+                }
+                else if (prop.type == PropertyType::Array) {
+                    record[prop.name] = json::array();
+                }
+                continue;
+            }
+            record[prop.name] = value_for_cell(m_columns[i], cell);
+        }
+        return true;
+    }
+
+    json value_for_cell(const Column &column, const std::string &cell) {
+        const Property &prop = *column.property;
+        switch (prop.type) {
+            case PropertyType::Bool:
+                if (cell == "true" || cell == "1") {
+                    return true;
+                }
+                if (cell == "false" || cell == "0") {
+                    return false;
+                }
+                break;
+            case PropertyType::Int:
+                return integer_for_cell(prop, cell);
+            case PropertyType::Float:
+            case PropertyType::Double: {
+                char *end;
+                double number = strtod(cell.c_str(), &end);
+                if (*end == '\0') {
+                    return number;
+                }
+                break;
+            }
+            case PropertyType::Object:
+                // A link is given by the primary key of the object it points to.
+                return column.string_key ? json(cell) : integer_for_cell(prop, cell);
+            case PropertyType::Array:
+                return json::parse(cell);
+            default:
+                return cell;
+        }
+        throw TypeErrorException(util::format("%1.%2", m_object_schema.name, prop.name),
+                                 js_type_name_for_property_type(prop.type));
+    }
+
+    json integer_for_cell(const Property &prop, const std::string &cell) {
+        char *end;
+        long long number = strtoll(cell.c_str(), &end, 10);
+        if (*end != '\0') {
+            throw TypeErrorException(util::format("%1.%2", m_object_schema.name, prop.name), "number");
+        }
+        return int64_t(number);
+    }
+
+    // Reads one record, whose quoted cells may contain separators, doubled quotes and line breaks.
+    bool read_csv_record(std::vector<std::string> &cells) {
+        cells.clear();
+        int c = m_file.get();
+        if (c == EOF) {
+            return false;
+        }
+        m_line++;
+
+        std::string cell;
+        bool quoted = false;
+        for (; c != EOF; c = m_file.get()) {
+            if (quoted) {
+                if (c == '"') {
+                    if (m_file.peek() == '"') {
+                        m_file.get();
+                        cell += '"';
+                    }
+                    else {
+                        quoted = false;
+                    }
+                }
+                else {
+                    if (c == '\n') {
+                        m_line++;
+                    }
+                    cell += char(c);
+                }
+            }
+            else if (c == '"') {
+                quoted = true;
+            }
+            else if (c == ',') {
+                cells.push_back(std::move(cell));
+                cell.clear();
+            }
+            else if (c == '\n') {
+                break;
+            }
+            else if (c != '\r') {
+                cell += char(c);
+            }
+        }
+        if (quoted) {
+            throw std::invalid_argument("Unterminated quoted cell.");
+        }
+        cells.push_back(std::move(cell));
+        return true;
+    }
+};
+
+} // js
+} // realm
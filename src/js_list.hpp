@@ -42,7 +42,12 @@ class List : public realm::List {
     List(std::shared_ptr<realm::Realm> r, const ObjectSchema& s, LinkViewRef l) noexcept : realm::List(r, l) {}
     List(const realm::List &l) : realm::List(l) {}
 
-    std::vector<std::pair<Protected<typename T::Function>, NotificationToken>> m_notification_tokens;
+    CallbackRegistry<T, CountedNotificationToken> m_notification_tokens;
+    ObjectWrapperCache<T> m_object_cache;
+    PositionIndex m_position_index;
+
+  private:
+    LiveObjectCounter m_live_count {get_realm() ? get_realm()->config().path : std::string(), "Realm.List"};
 };
 
 template<typename T>
@@ -57,6 +62,8 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
 
     static ObjectType create_instance(ContextType, realm::List);
 
+    static size_t row_for_value(ContextType, NativeAccessor<T> &, realm::List &, const ValueType &);
+
     // properties
     static void get_length(ContextType, ObjectType, ReturnValue &);
     static void get_index(ContextType, ObjectType, uint32_t, ReturnValue &);
@@ -68,11 +75,22 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
     static void unshift(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void shift(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void splice(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void push_many(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void replace_all(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void snapshot(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void is_empty(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void filtered(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void sorted(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void is_valid(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void index_of(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void to_columns(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+
+    template<AggregateFunction>
+    static void aggregate(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void group_by(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void slice(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void get_chunk(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void to_plain_array(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
 
     // observable
     static void add_listener(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
@@ -87,11 +105,24 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
         {"unshift", wrap<unshift>},
         {"shift", wrap<shift>},
         {"splice", wrap<splice>},
+        {"pushMany", wrap<push_many>},
+        {"replaceAll", wrap<replace_all>},
         {"snapshot", wrap<snapshot>},
+        {"isEmpty", wrap<is_empty>},
         {"filtered", wrap<filtered>},
         {"sorted", wrap<sorted>},
         {"isValid", wrap<is_valid>},
         {"indexOf", wrap<index_of>},
+        {"toColumns", wrap<to_columns>},
+        {"min", wrap<aggregate<AggregateFunction::Min>>},
+        {"max", wrap<aggregate<AggregateFunction::Max>>},
+        {"sum", wrap<aggregate<AggregateFunction::Sum>>},
+        {"avg", wrap<aggregate<AggregateFunction::Avg>>},
+        {"groupBy", wrap<group_by>},
+        {"slice", wrap<slice>},
+        {"toArray", wrap<slice>},
+        {"_getChunk", wrap<get_chunk>},
+        {"toPlainArray", wrap<to_plain_array>},
         {"addListener", wrap<add_listener>},
         {"removeListener", wrap<remove_listener>},
         {"removeAllListeners", wrap<remove_all_listeners>},
@@ -109,6 +140,27 @@ typename T::Object ListClass<T>::create_instance(ContextType ctx, realm::List li
     return create_object<T, ListClass<T>>(ctx, new realm::js::List<T>(std::move(list)));
 }
 
+// Resolves a value being added to the list to the row it refers to. Objects that already belong to the list's
+// Realm are checked against the list's type and used as they are, while anything else is created through the accessor.
+template<typename T>
+size_t ListClass<T>::row_for_value(ContextType ctx, NativeAccessor<T> &accessor, realm::List &list, const ValueType &value) {
+    if (Value::is_object(ctx, value)) {
+        ObjectType object = Value::to_object(ctx, value);
+        if (Object::template is_instance<RealmObjectClass<T>>(ctx, object)) {
+            auto realm_object = get_internal<T, RealmObjectClass<T>>(object);
+            if (realm_object->realm() == list.get_realm() && realm_object->is_valid()) {
+                auto &object_type = realm_object->get_object_schema().name;
+                if (object_type != list.get_object_schema().name) {
+                    throw std::runtime_error(util::format("Object of type (%1) does not match List type (%2)", object_type,
+                                                          list.get_object_schema().name));
+                }
+                return realm_object->row().get_index();
+            }
+        }
+    }
+    return accessor.template unbox<RowExpr>(value, true).get_index();
+}
+
 template<typename T>
 void ListClass<T>::get_length(ContextType, ObjectType object, ReturnValue &return_value) {
     auto list = get_internal<T, ListClass<T>>(object);
@@ -118,9 +170,9 @@ void ListClass<T>::get_length(ContextType, ObjectType object, ReturnValue &retur
 template<typename T>
 void ListClass<T>::get_index(ContextType ctx, ObjectType object, uint32_t index, ReturnValue &return_value) {
     auto list = get_internal<T, ListClass<T>>(object);
-    auto realm_object = realm::Object(list->get_realm(), list->get_object_schema(), list->get(index));
+    auto row = list->get(index);
 
-    return_value.set(RealmObjectClass<T>::create_instance(ctx, std::move(realm_object)));
+    return_value.set(list->m_object_cache.get(ctx, index, list->get_realm(), list->get_object_schema(), row));
 }
 
 template<typename T>
@@ -224,12 +276,80 @@ void ListClass<T>::splice(ContextType ctx, FunctionType, ObjectType this_object,
         list->remove(index);
     }
     for (size_t i = 2; i < argc; i++) {
-        list->insert(accessor, index + i - 2, arguments[i]);
+        list->insert(index + i - 2, row_for_value(ctx, accessor, *list, arguments[i]));
     }
 
     return_value.set(Object::create_array(ctx, removed_objects));
 }
 
+template<typename T>
+void ListClass<T>::push_many(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1);
+
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    ObjectType objects = Value::validated_to_array(ctx, arguments[0], "objects");
+    uint32_t length = Object::validated_get_length(ctx, objects);
+
+    NativeAccessor<T> accessor(ctx, list->get_realm(), list->get_object_schema());
+    for (uint32_t i = 0; i < length; i++) {
+        list->add(row_for_value(ctx, accessor, *list, Object::get_property(ctx, objects, i)));
+    }
+
+    return_value.set((uint32_t)list->size());
+}
+
+template<typename T>
+void ListClass<T>::replace_all(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1);
+
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    ObjectType objects = Value::validated_to_array(ctx, arguments[0], "objects");
+    uint32_t length = Object::validated_get_length(ctx, objects);
+
+    NativeAccessor<T> accessor(ctx, list->get_realm(), list->get_object_schema());
+    std::vector<size_t> rows;
+    rows.reserve(length);
+    for (uint32_t i = 0; i < length; i++) {
+        rows.push_back(row_for_value(ctx, accessor, *list, Object::get_property(ctx, objects, i)));
+    }
+
+    // Leave the common prefix and suffix alone and only touch what differs in between, so listeners are
+    // notified about the rows that actually changed rather than about every row being removed and re-added.
+    size_t old_size = list->size();
+    size_t new_size = rows.size();
+    size_t prefix = 0;
+    while (prefix < old_size && prefix < new_size && list->get(prefix).get_index() == rows[prefix]) {
+        prefix++;
+    }
+    size_t suffix = 0;
+    while (suffix < old_size - prefix && suffix < new_size - prefix
+            && list->get(old_size - suffix - 1).get_index() == rows[new_size - suffix - 1]) {
+        suffix++;
+    }
+
+    size_t old_end = old_size - suffix;
+    size_t new_end = new_size - suffix;
+    for (size_t i = prefix; i < std::min(old_end, new_end); i++) {
+        if (list->get(i).get_index() != rows[i]) {
+            list->set(i, rows[i]);
+        }
+    }
+    for (size_t i = old_end; i < new_end; i++) {
+        list->insert(i, rows[i]);
+    }
+    for (size_t i = new_end; i < old_end; i++) {
+        list->remove(new_end);
+    }
+}
+
+template<typename T>
+void ListClass<T>::is_empty(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 0);
+
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    return_value.set(list->size() == 0);
+}
+
 template<typename T>
 void ListClass<T>::snapshot(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 0);
@@ -271,7 +391,15 @@ void ListClass<T>::index_of(ContextType ctx, FunctionType, ObjectType this_objec
         }
 
         auto list = get_internal<T, ListClass<T>>(this_object);
-        size_t ndx = list->find(object->row());
+        size_t ndx;
+        if (object->realm() == list->get_realm() && &object->get_object_schema() == &list->get_object_schema()) {
+            ndx = list->m_position_index.find(*list, list->get_realm()->read_group(), object->row().get_index(), [&] {
+                return list->find(object->row());
+            });
+        }
+        else {
+            ndx = list->find(object->row());
+        }
 
         if (ndx == realm::not_found) {
             return_value.set(-1);
@@ -286,24 +414,85 @@ void ListClass<T>::index_of(ContextType ctx, FunctionType, ObjectType this_objec
 }
 
 template<typename T>
-void ListClass<T>::add_listener(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+void ListClass<T>::to_columns(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 1);
+
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    return_value.set(ResultsClass<T>::create_columns(ctx, *list, argc, arguments));
+}
+
+template<typename T>
+template<AggregateFunction function>
+void ListClass<T>::aggregate(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1);
+
+    // Aggregates are computed by Results, so run them over a snapshot of the list's rows.
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    auto results = list->snapshot();
+    return_value.set(ResultsClass<T>::compute_aggregate(ctx, results, function, arguments[0]));
+}
+
+template<typename T>
+void ListClass<T>::group_by(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1, 3);
+
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    return_value.set(ResultsClass<T>::create_groups(ctx, *list, argc, arguments));
+}
+
+template<typename T>
+void ListClass<T>::slice(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    // Extra arguments are ignored, as they are by Array.prototype.slice.
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    return_value.set(ResultsClass<T>::create_slice(ctx, *list, argc, arguments));
+}
+
+template<typename T>
+void ListClass<T>::get_chunk(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 2);
+
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    return_value.set(ResultsClass<T>::create_chunk(ctx, *list, argc, arguments));
+}
+
+template<typename T>
+void ListClass<T>::to_plain_array(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 0, 3);
+
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    return_value.set(ResultsClass<T>::create_plain_array(ctx, *list, argc, arguments));
+}
+
+template<typename T>
+void ListClass<T>::add_listener(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1, 2);
     
     auto list = get_internal<T, ListClass<T>>(this_object);
     auto callback = Value::validated_to_function(ctx, arguments[0]);
+    auto options = CollectionClass<T>::validated_listener_options(ctx, list->get_object_schema(), argc, arguments);
     Protected<FunctionType> protected_callback(ctx, callback);
     Protected<ObjectType> protected_this(ctx, this_object);
     Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
 
-    auto token = list->add_notification_callback([=](CollectionChangeSet change_set, std::exception_ptr exception) {
+    auto &scheduler = get_delegate<T>(list->get_realm().get())->m_listener_scheduler;
+    auto listener = scheduler.add(options.priority, [=](CollectionChangeSet change_set) {
         HANDLESCOPE
 
         ValueType arguments[2];
         arguments[0] = static_cast<ObjectType>(protected_this);
-        arguments[1] = CollectionClass<T>::create_collection_change_set(protected_ctx, change_set);
+        arguments[1] = CollectionClass<T>::create_collection_change_set(protected_ctx, change_set, options);
         Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, arguments);
     });
-    list->m_notification_tokens.emplace_back(protected_callback, std::move(token));
+
+    std::weak_ptr<ListenerScheduler::Listener> weak_listener = listener;
+    auto token = list->add_notification_callback([=](CollectionChangeSet change_set, std::exception_ptr exception) {
+        auto listener = weak_listener.lock();
+        if (listener && CollectionClass<T>::should_notify(change_set, options)) {
+            ListenerScheduler::deliver(listener, std::move(change_set));
+        }
+    });
+    LiveObjectCounter token_count(list->get_realm()->config().path, LiveObjectRegistry::notification_token_kind());
+    list->m_notification_tokens.add(protected_callback, {std::move(token), std::move(token_count), std::move(listener)});
 }
     
 template<typename T>
@@ -314,16 +503,7 @@ void ListClass<T>::remove_listener(ContextType ctx, FunctionType, ObjectType thi
     auto callback = Value::validated_to_function(ctx, arguments[0]);
     auto protected_function = Protected<FunctionType>(ctx, callback);
 
-    auto iter = list->m_notification_tokens.begin();
-    typename Protected<FunctionType>::Comparator compare;
-    while (iter != list->m_notification_tokens.end()) {
-        if(compare(iter->first, protected_function)) {
-            iter = list->m_notification_tokens.erase(iter);
-        }
-        else {
-            iter++;
-        }
-    }
+    list->m_notification_tokens.remove(protected_function);
 }
     
 template<typename T>
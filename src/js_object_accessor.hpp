@@ -84,7 +84,7 @@ public:
     ValueType box(int64_t number)    { return Value::from_number(m_ctx, number); }
     ValueType box(float number)      { return Value::from_number(m_ctx, number); }
     ValueType box(double number)     { return Value::from_number(m_ctx, number); }
-    ValueType box(StringData string) { return Value::from_string(m_ctx, string.data()); }
+    ValueType box(StringData string) { return Value::from_string_data(m_ctx, string); }
     ValueType box(BinaryData data)   { return Value::from_binary(m_ctx, data); }
     ValueType box(Mixed)             { throw std::runtime_error("'Any' type is unsupported"); }
 
@@ -194,16 +194,22 @@ struct Unbox<JSEngine, util::Optional<double>> {
 template<typename JSEngine>
 struct Unbox<JSEngine, StringData> {
     static StringData call(NativeAccessor<JSEngine> *ctx, typename JSEngine::Value const& value, bool, bool) {
-        ctx->m_string_buffer = js::Value<JSEngine>::validated_to_string(ctx->m_ctx, value, "Property");
-        return ctx->m_string_buffer;
+        if (!js::Value<JSEngine>::is_string(ctx->m_ctx, value)) {
+            throw TypeErrorException("'Property'", "string");
+        }
+        // Encoded straight into the accessor's buffer, whose capacity is reused across properties.
+        return js::Value<JSEngine>::to_string_data(ctx->m_ctx, value, ctx->m_string_buffer);
     }
 };
 
 template<typename JSEngine>
 struct Unbox<JSEngine, BinaryData> {
     static BinaryData call(NativeAccessor<JSEngine> *ctx, typename JSEngine::Value value, bool, bool) {
-        ctx->m_owned_binary_data = js::Value<JSEngine>::validated_to_binary(ctx->m_ctx, value, "Property");
-        return ctx->m_owned_binary_data.get();
+        if (!js::Value<JSEngine>::is_binary(ctx->m_ctx, value)) {
+            throw TypeErrorException("'Property'", "binary");
+        }
+        // The value outlives the write it is unboxed for, so its bytes don't need to be copied first.
+        return js::Value<JSEngine>::to_binary_data(ctx->m_ctx, value, ctx->m_owned_binary_data);
     }
 };
 
@@ -16,8 +16,14 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 #include "platform.hpp"
 #include "realm_coordinator.hpp"
+#include "shared_realm.hpp"
 
 #if REALM_ENABLE_SYNC
 #include "sync/sync_manager.hpp"
@@ -29,6 +35,11 @@ namespace js {
 
 static std::string s_default_path = "";
 
+static std::mutex s_js_realms_mutex;
+static std::vector<std::weak_ptr<realm::Realm>> s_js_realms;
+// Realms without a binding context that keep the files of the previous contexts open.
+static std::vector<SharedRealm> s_kept_realms;
+
 std::string default_path() {
     if (s_default_path.empty()) {
         s_default_path = realm::default_realm_file_directory() +
@@ -47,10 +58,84 @@ void set_default_path(std::string path) {
 }
 
 void delete_all_realms() {
+    {
+        std::lock_guard<std::mutex> lock(s_js_realms_mutex);
+        s_js_realms.clear();
+        s_kept_realms.clear();
+    }
     realm::_impl::RealmCoordinator::clear_all_caches();
     realm::remove_realm_files_from_directory(realm::default_realm_file_directory());
 }
 
+std::atomic<bool> &keep_realms_open_across_reloads() {
+    static std::atomic<bool> s_keep_open {false};
+    return s_keep_open;
+}
+
+void register_js_realm(const SharedRealm &realm) {
+    std::lock_guard<std::mutex> lock(s_js_realms_mutex);
+    s_js_realms.erase(std::remove_if(s_js_realms.begin(), s_js_realms.end(), [&](const std::weak_ptr<realm::Realm> &weak_realm) {
+        auto js_realm = weak_realm.lock();
+        return !js_realm || js_realm == realm;
+    }), s_js_realms.end());
+    s_js_realms.emplace_back(realm);
+}
+
+void release_kept_realm_if_incompatible(const realm::Realm::Config &config) {
+    std::lock_guard<std::mutex> lock(s_js_realms_mutex);
+
+    // A new version of the app may open the file with a different schema version, or otherwise differently,
+    // which the coordinator kept alive by the old Realm would reject.
+    s_kept_realms.erase(std::remove_if(s_kept_realms.begin(), s_kept_realms.end(), [&](const SharedRealm &kept_realm) {
+        auto &kept_config = kept_realm->config();
+        return kept_config.path == config.path && (kept_config.schema_version != config.schema_version
+            || kept_config.schema_mode != config.schema_mode || kept_config.encryption_key != config.encryption_key
+            || kept_config.in_memory != config.in_memory || bool(kept_config.sync_config) != bool(config.sync_config));
+    }), s_kept_realms.end());
+}
+
+void close_realms_for_reload() {
+    std::lock_guard<std::mutex> lock(s_js_realms_mutex);
+
+    if (!keep_realms_open_across_reloads()) {
+        s_js_realms.clear();
+        s_kept_realms.clear();
+        realm::_impl::RealmCoordinator::clear_all_caches();
+        return;
+    }
+
+    std::vector<SharedRealm> kept_realms;
+    for (auto &weak_realm : s_js_realms) {
+        auto js_realm = weak_realm.lock();
+        if (!js_realm || js_realm->is_closed()) {
+            continue;
+        }
+
+        bool already_kept = std::any_of(kept_realms.begin(), kept_realms.end(), [&](const SharedRealm &kept_realm) {
+            return kept_realm->config().path == js_realm->config().path;
+        });
+        if (!already_kept) {
+            // The functions in the config call into the old context, so they are left out.
+            realm::Realm::Config config = js_realm->config();
+            config.cache = false;
+            config.migration_function = nullptr;
+            config.should_compact_on_launch_function = nullptr;
+            try {
+                kept_realms.push_back(realm::Realm::get_shared_realm(config));
+            }
+            catch (std::exception &) {
+                // Keeping the file open is only an optimization, so it is simply reopened from scratch later.
+            }
+        }
+
+        // Closing the Realm also destroys its binding context, which belongs to the old JS context.
+        js_realm->close();
+    }
+
+    s_js_realms.clear();
+    s_kept_realms = std::move(kept_realms);
+}
+
 void clear_test_state() {
     delete_all_realms();
 #if REALM_ENABLE_SYNC
@@ -18,8 +18,11 @@
 
 #pragma once
 
+#include <chrono>
 #include <list>
 #include <map>
+#include <thread>
+#include <unordered_map>
 
 #include "js_class.hpp"
 #include "js_types.hpp"
@@ -27,6 +30,7 @@
 #include "js_realm_object.hpp"
 #include "js_list.hpp"
 #include "js_results.hpp"
+#include "js_import.hpp"
 #include "js_schema.hpp"
 #include "js_observable.hpp"
 
@@ -36,10 +40,16 @@
 #include "sync/sync_manager.hpp"
 #endif
 
+#include <realm/group_shared.hpp>
+#include <realm/history.hpp>
+#include <realm/util/file.hpp>
+
 #include "shared_realm.hpp"
+#include "realm_coordinator.hpp"
 #include "binding_context.hpp"
 #include "object_accessor.hpp"
 #include "platform.hpp"
+#include "event_loop_dispatcher.hpp"
 
 namespace realm {
 namespace js {
@@ -61,6 +71,42 @@ static std::string normalize_realm_path(std::string path) {
 template<typename T>
 class RealmClass;
 
+// Report a file that keeps more versions than this through console.warn(). Off (0) unless set through
+// `Realm.versionWarningThreshold`.
+inline std::atomic<uint64_t> &version_warning_threshold() {
+    static std::atomic<uint64_t> threshold(0);
+    return threshold;
+}
+
+// The number of versions kept in a Realm file and its space usage, which realm.stats() and the version warning
+// report. They are read through a SharedGroup of its own that is only open while reading them, as one that stayed
+// open would keep compact() and anything else that needs the file to itself from ever running.
+struct FileStats {
+    uint64_t versions = 0;
+    size_t free_space = 0;
+    size_t used_space = 0;
+
+    // Read-only files may not have a writable lock file, and synced files have a different history type.
+    static bool supports(const realm::Realm::Config &config) {
+        return config.schema_mode != SchemaMode::ReadOnly && !config.sync_config;
+    }
+
+    FileStats(const realm::Realm::Config &config, bool read_space) {
+        std::unique_ptr<Replication> history = realm::make_in_realm_history(config.path);
+        SharedGroupOptions options(config.encryption_key.empty() ? nullptr : config.encryption_key.data());
+        if (config.in_memory) {
+            options.durability = SharedGroupOptions::Durability::MemOnly;
+        }
+        SharedGroup group(*history, options);
+        versions = group.get_number_of_versions();
+        if (read_space) {
+            group.begin_read();
+            group.get_stats(free_space, used_space);
+            group.end_read();
+        }
+    }
+};
+
 template<typename T>
 class RealmDelegate : public BindingContext {
   public:
@@ -68,13 +114,60 @@ class RealmDelegate : public BindingContext {
     using FunctionType = typename T::Function;
     using ObjectType = typename T::Object;
     using ValueType = typename T::Value;
+    using Object = js::Object<T>;
     using Value = js::Value<T>;
 
     using ObjectDefaultsMap = typename Schema<T>::ObjectDefaultsMap;
     using ConstructorMap = typename Schema<T>::ConstructorMap;
+    using TextIndexMap = typename Schema<T>::TextIndexMap;
+    using PrototypeMap = std::map<std::string, Protected<ObjectType>>;
+    using NotificationRegistry = CallbackRegistry<T, std::nullptr_t>;
 
     virtual void did_change(std::vector<ObserverState> const& observers, std::vector<void*> const& invalidated, bool version_changed) {
-        notify("change");
+        if (version_changed) {
+            count_change();
+        }
+        if (version_warning_threshold()) {
+            if (SharedRealm realm = m_realm.lock()) {
+                check_version_count(*realm);
+            }
+        }
+        if (m_notifications.empty() && m_changeset_notifications.empty()) {
+            return;
+        }
+
+        HANDLESCOPE
+
+        SharedRealm realm = m_realm.lock();
+        if (!realm) {
+            throw std::runtime_error("Realm no longer exists");
+        }
+
+        // A single wrapper is handed to all listeners, and kept for as long as there are any.
+        if (!m_notification_object) {
+            m_notification_object.emplace(m_context, create_object<T, RealmClass<T>>(m_context, new SharedRealm(realm)));
+        }
+        ObjectType realm_object = *m_notification_object;
+        notify(m_notifications, realm_object, "change");
+
+        if (!m_changeset_notifications.empty()) {
+            auto changed_types = changed_object_types(*realm);
+            if (!changed_types.empty()) {
+                ObjectType changes = Object::create_empty(m_context);
+                Object::set_property(m_context, changes, "objectTypes", Object::create_array(m_context, changed_types));
+                notify(m_changeset_notifications, realm_object, "changeset", changes);
+            }
+        }
+    }
+
+    virtual void schema_did_change(realm::Schema const&) {
+        m_property_cache.clear();
+        m_property_setters.clear();
+        m_backlink_cache.clear();
+        m_text_index_cache.clear();
+        m_count_cache.clear();
+        // Accessor prototypes refer to properties by index, so they can't be used with a different schema.
+        m_accessor_prototypes.clear();
     }
 
     RealmDelegate(std::weak_ptr<realm::Realm> realm, GlobalContextType ctx) : m_context(ctx), m_realm(realm) {}
@@ -83,53 +176,184 @@ class RealmDelegate : public BindingContext {
         // All protected values need to be unprotected while the context is retained.
         m_defaults.clear();
         m_constructors.clear();
+        m_accessor_prototypes.clear();
         m_notifications.clear();
+        m_changeset_notifications.clear();
+        m_notification_object = util::none;
+        m_change_state = util::none;
     }
 
-    void add_notification(FunctionType notification) {
-        for (auto &handler : m_notifications) {
-            if (handler == notification) {
-                return;
-            }
+    void add_notification(const std::string &name, FunctionType notification) {
+        auto &notifications = notifications_for_name(name);
+        Protected<FunctionType> protected_notification(m_context, notification);
+        if (notifications.contains(protected_notification)) {
+            return;
         }
-        m_notifications.emplace_back(m_context, notification);
-    }
-    void remove_notification(FunctionType notification) {
-        for (auto iter = m_notifications.begin(); iter != m_notifications.end(); ++iter) {
-            if (*iter == notification) {
-                m_notifications.erase(iter);
-                return;
+
+        // Changesets are reported relative to the versions seen when the first listener was added.
+        if (&notifications == &m_changeset_notifications && notifications.empty()) {
+            if (SharedRealm realm = m_realm.lock()) {
+                m_table_versions.clear();
+                changed_object_types(*realm);
             }
         }
+        notifications.add(std::move(protected_notification), nullptr);
+    }
+    void remove_notification(const std::string &name, FunctionType notification) {
+        notifications_for_name(name).remove(Protected<FunctionType>(m_context, notification));
+        release_unused_notification_object();
     }
     void remove_all_notifications() {
         m_notifications.clear();
+        m_changeset_notifications.clear();
+        release_unused_notification_object();
+    }
+    void remove_all_notifications(const std::string &name) {
+        notifications_for_name(name).clear();
+        release_unused_notification_object();
+    }
+
+    size_t notification_count() const {
+        return m_notifications.size() + m_changeset_notifications.size();
+    }
+
+    // The wrapper handed to listeners refers back to the Realm, so it must not outlive them or the Realm being open.
+    void release_notification_object() {
+        m_notification_object = util::none;
+    }
+
+    // A plain object whose `version` goes up whenever the Realm may have changed on this thread: when it advances
+    // to a new version, begins a write transaction or is closed. Chunks of objects read from its collections
+    // refer to it, so that the JS code iterating over them can tell that a chunk is stale without a native call.
+    ObjectType change_state() {
+        if (!m_change_state) {
+            ObjectType state = Object::create_empty(m_context);
+            Object::set_property(m_context, state, "version", Value::from_number(m_context, double(m_change_count)));
+            m_change_state.emplace(m_context, state);
+        }
+        return *m_change_state;
+    }
+
+    uint64_t change_count() const {
+        return m_change_count;
+    }
+
+    void count_change() {
+        m_change_count++;
+        if (m_change_state) {
+            HANDLESCOPE
+            ObjectType state = *m_change_state;
+            Object::set_property(m_context, state, "version", Value::from_number(m_context, double(m_change_count)));
+        }
     }
 
     ObjectDefaultsMap m_defaults;
     ConstructorMap m_constructors;
+    TextIndexMap m_text_indexes;
+    PrototypeMap m_accessor_prototypes;
+    PropertyIndexCache m_property_cache;
+    PropertySetterTable<T> m_property_setters;
+    BacklinkCache m_backlink_cache;
+    PredicateCache m_predicate_cache;
+    TextIndexCache m_text_index_cache;
+    CountCache m_count_cache;
+    ListenerScheduler m_listener_scheduler;
+    // Set once any Realm object for this Realm is opened with `cacheObjects`, so that objects() only looks for
+    // the cache on the Realm object when there can be one.
+    bool m_cache_objects = false;
 
   private:
     Protected<GlobalContextType> m_context;
-    std::list<Protected<FunctionType>> m_notifications;
+    NotificationRegistry m_notifications;
+    NotificationRegistry m_changeset_notifications;
+    std::map<std::string, uint_fast64_t> m_table_versions;
     std::weak_ptr<realm::Realm> m_realm;
+    util::Optional<Protected<ObjectType>> m_notification_object;
+    util::Optional<Protected<ObjectType>> m_change_state;
+    uint64_t m_change_count = 0;
+    bool m_warned_about_versions = false;
+
+    // Warns once each time the number of versions kept in the file goes over the threshold, which usually
+    // means that a snapshot or a Realm on another thread is holding on to an old version.
+    void check_version_count(realm::Realm &realm) {
+        if (!FileStats::supports(realm.config())) {
+            return;
+        }
 
-    void notify(const char *notification_name) {
-        HANDLESCOPE
+        uint64_t threshold = version_warning_threshold();
+        uint64_t versions;
+        try {
+            versions = FileStats(realm.config(), false).versions;
+        }
+        catch (std::exception &) {
+            return;
+        }
 
-        SharedRealm realm = m_realm.lock();
-        if (!realm) {
-            throw std::runtime_error("Realm no longer exists");
+        bool too_many = threshold && versions > threshold;
+        if (too_many && !m_warned_about_versions) {
+            HANDLESCOPE
+
+            ValueType console = Object::get_global(m_context, "console");
+            if (Value::is_object(m_context, console)) {
+                ValueType warn = Object::get_property(m_context, Value::to_object(m_context, console), "warn");
+                if (Value::is_function(m_context, warn)) {
+                    ValueType arguments[1] = {Value::from_string(m_context, util::format(
+                        "The Realm at '%1' is keeping %2 versions, more than the versionWarningThreshold of %3. "
+                        "Old versions are kept alive by Realms and snapshots that are never closed or released.",
+                        realm.config().path, versions, threshold))};
+                    Function<T>::call(m_context, Value::to_function(m_context, warn), Value::to_object(m_context, console), 1, arguments);
+                }
+            }
+        }
+        m_warned_about_versions = too_many;
+    }
+
+    void release_unused_notification_object() {
+        if (m_notifications.empty() && m_changeset_notifications.empty()) {
+            m_notification_object = util::none;
+        }
+    }
+
+    NotificationRegistry &notifications_for_name(const std::string &name) {
+        return name == "changeset" ? m_changeset_notifications : m_notifications;
+    }
+
+    // Returns the object types whose tables changed since the last call, going by the table version counters.
+    std::vector<ValueType> changed_object_types(realm::Realm &realm) {
+        std::vector<ValueType> changed_types;
+        for (auto &object_schema : realm.schema()) {
+            auto table = ObjectStore::table_for_object_type(realm.read_group(), object_schema.name);
+            if (!table) {
+                continue;
+            }
+
+            auto version = table->get_version_counter();
+            auto it = m_table_versions.find(object_schema.name);
+            if (it == m_table_versions.end()) {
+                m_table_versions.emplace(object_schema.name, version);
+            }
+            else if (it->second != version) {
+                it->second = version;
+                changed_types.push_back(Value::from_string(m_context, object_schema.name));
+            }
+        }
+        return changed_types;
+    }
+
+    void notify(const NotificationRegistry &notifications, ObjectType realm_object,
+                const char *notification_name, ValueType payload = {}) {
+        if (notifications.empty()) {
+            return;
         }
 
-        ObjectType realm_object = create_object<T, RealmClass<T>>(m_context, new SharedRealm(realm));
-        ValueType arguments[2];
+        ValueType arguments[3];
         arguments[0] = realm_object;
         arguments[1] = Value::from_string(m_context, notification_name);
+        arguments[2] = payload;
+        size_t argument_count = Value::is_valid(payload) ? 3 : 2;
 
-        std::list<Protected<FunctionType>> notifications_copy(m_notifications);
-        for (auto &callback : notifications_copy) {
-            Function<T>::callback(m_context, callback, realm_object, 2, arguments);
+        for (auto &callback : notifications.callbacks()) {
+            Function<T>::callback(m_context, callback, realm_object, argument_count, arguments);
         }
     }
 
@@ -141,6 +365,36 @@ void set_default_path(std::string path);
 void delete_all_realms();
 void clear_test_state();
 
+// Realms opened from JS are registered so that they can be closed when their context goes away. Unless
+// `Realm.keepOpenAcrossReloads` is set, close_realms_for_reload() closes every Realm in the process. Otherwise
+// it only closes the Realms (and so the bindings) of the old contexts, and keeps a Realm without bindings open
+// for each file, so that the file stays mapped and opening it again from the new context is cheap.
+std::atomic<bool> &keep_realms_open_across_reloads();
+void register_js_realm(const SharedRealm &realm);
+void release_kept_realm_if_incompatible(const realm::Realm::Config &config);
+void close_realms_for_reload();
+
+// How long each phase of the most recent Realm construction took, in milliseconds.
+struct OpenStats {
+    using Clock = std::chrono::steady_clock;
+
+    bool recorded = false;
+    double config = 0;
+    double schema = 0;
+    double open = 0;
+    double migration = 0;
+    double datetime_conversion = 0;
+    double accessor_prototypes = 0;
+    double total = 0;
+
+    // Not part of constructing a Realm, but reported alongside since it usually runs right before the first one.
+    double copy_bundled_realm_files = 0;
+
+    static double milliseconds_since(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+};
+
 template<typename T>
 class RealmClass : public ClassDefinition<T, SharedRealm, ObservableClass<T>> {
     using GlobalContextType = typename T::GlobalContext;
@@ -157,6 +411,7 @@ class RealmClass : public ClassDefinition<T, SharedRealm, ObservableClass<T>> {
 public:
     using ObjectDefaultsMap = typename Schema<T>::ObjectDefaultsMap;
     using ConstructorMap = typename Schema<T>::ConstructorMap;
+    using TextIndexMap = typename Schema<T>::TextIndexMap;
     
     using WaitHandler = void(std::error_code);
     using ProgressHandler = void(uint64_t transferred_bytes, uint64_t transferrable_bytes);
@@ -166,9 +421,14 @@ public:
 
     // methods
     static void objects(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void count(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void object_for_primary_key(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void create(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void create_many(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void upsert_many(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void objects_for_primary_keys(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void delete_one(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void delete_where(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void delete_all(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void write(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void begin_transaction(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue&);
@@ -180,6 +440,8 @@ public:
     static void remove_all_listeners(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void close(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void compact(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void stats(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void import_from(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     
 
     // properties
@@ -195,15 +457,31 @@ public:
 
     // static methods
     static void constructor(ContextType, ObjectType, size_t, const ValueType[]);
-    static SharedRealm create_shared_realm(ContextType, realm::Realm::Config, bool, ObjectDefaultsMap &&, ConstructorMap &&);
+    static SharedRealm create_shared_realm(ContextType, realm::Realm::Config, bool, ObjectDefaultsMap &&, ConstructorMap &&, TextIndexMap &&);
+    static void create_accessor_prototypes(ContextType, ObjectType, const SharedRealm &);
+    static void begin_write(const SharedRealm &);
 
     static void schema_version(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void clear_test_state(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void copy_bundled_realm_files(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void compact_async(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void prepare_open(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void delete_file(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void delete_files_async(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
 
     // static properties
     static void get_default_path(ContextType, ObjectType, ReturnValue &);
     static void set_default_path(ContextType, ObjectType, ValueType value);
+    static void get_last_open_stats(ContextType, ObjectType, ReturnValue &);
+    static void get_collect_call_stats(ContextType, ObjectType, ReturnValue &);
+    static void set_collect_call_stats(ContextType, ObjectType, ValueType value);
+    static void get_call_stats(ContextType, ObjectType, ReturnValue &);
+    static void get_collection_enumeration_limit(ContextType, ObjectType, ReturnValue &);
+    static void get_keep_open_across_reloads(ContextType, ObjectType, ReturnValue &);
+    static void get_version_warning_threshold(ContextType, ObjectType, ReturnValue &);
+    static void set_version_warning_threshold(ContextType, ObjectType, ValueType value);
+    static void set_keep_open_across_reloads(ContextType, ObjectType, ValueType value);
+    static void set_collection_enumeration_limit(ContextType, ObjectType, ValueType value);
 
     std::string const name = "Realm";
 
@@ -212,17 +490,32 @@ public:
         {"clearTestState", wrap<clear_test_state>},
         {"copyBundledRealmFiles", wrap<copy_bundled_realm_files>},
         {"_waitForDownload", wrap<wait_for_download_completion>},
+        {"_compactAsync", wrap<compact_async>},
+        {"_prepareOpen", wrap<prepare_open>},
+        {"deleteFile", wrap<delete_file>},
+        {"_deleteFilesAsync", wrap<delete_files_async>},
     };
 
     PropertyMap<T> const static_properties = {
         {"defaultPath", {wrap<get_default_path>, wrap<set_default_path>}},
+        {"lastOpenStats", {wrap<get_last_open_stats>, nullptr}},
+        {"collectCallStats", {wrap<get_collect_call_stats>, wrap<set_collect_call_stats>}},
+        {"callStats", {wrap<get_call_stats>, nullptr}},
+        {"collectionEnumerationLimit", {wrap<get_collection_enumeration_limit>, wrap<set_collection_enumeration_limit>}},
+        {"keepOpenAcrossReloads", {wrap<get_keep_open_across_reloads>, wrap<set_keep_open_across_reloads>}},
+        {"versionWarningThreshold", {wrap<get_version_warning_threshold>, wrap<set_version_warning_threshold>}},
     };
 
     MethodMap<T> const methods = {
         {"objects", wrap<objects>},
+        {"count", wrap<count>},
         {"objectForPrimaryKey", wrap<object_for_primary_key>},
         {"create", wrap<create>},
+        {"createMany", wrap<create_many>},
+        {"upsertMany", wrap<upsert_many>},
+        {"objectsForPrimaryKeys", wrap<objects_for_primary_keys>},
         {"delete", wrap<delete_one>},
+        {"deleteWhere", wrap<delete_where>},
         {"deleteAll", wrap<delete_all>},
         {"write", wrap<write>},
         {"beginTransaction", wrap<begin_transaction>},
@@ -231,8 +524,10 @@ public:
         {"addListener", wrap<add_listener>},
         {"removeListener", wrap<remove_listener>},
         {"removeAllListeners", wrap<remove_all_listeners>},
-        {"close", wrap<close>},
+        {"_close", wrap<close>},
         {"compact", wrap<compact>},
+        {"stats", wrap<stats>},
+        {"_importFrom", wrap<import_from>},
     };
 
     PropertyMap<T> const properties = {
@@ -250,12 +545,29 @@ public:
   private:
     static std::string validated_notification_name(ContextType ctx, const ValueType &value) {
         std::string name = Value::validated_to_string(ctx, value, "notification name");
-        if (name != "change") {
-            throw std::runtime_error("Only the 'change' notification name is supported.");
+        if (name != "change" && name != "changeset") {
+            throw std::runtime_error("Only the 'change' and 'changeset' notification names are supported.");
         }
         return name;
     }
 
+    static OpenStats &last_open_stats() {
+        static OpenStats stats;
+        return stats;
+    }
+
+    static uint32_t create_objects(ContextType, SharedRealm &, const ObjectSchema &, const ValueType &, bool update, const char *method);
+    static json json_for_default_value(ContextType, const ValueType &);
+
+    static std::string path_for_config(ContextType ctx, ObjectType config_object) {
+        std::string path = js::default_path();
+        ValueType path_value = Object::get_property(ctx, config_object, "path");
+        if (!Value::is_undefined(ctx, path_value)) {
+            path = Value::validated_to_string(ctx, path_value, "path");
+        }
+        return normalize_realm_path(path);
+    }
+
     static const ObjectSchema& validated_object_schema_for_value(ContextType ctx, const SharedRealm &realm, const ValueType &value, std::string& object_type) {
         if (Value::is_constructor(ctx, value)) {
             FunctionType constructor = Value::to_constructor(ctx, value);
@@ -312,6 +624,30 @@ inline typename T::Function RealmClass<T>::create_constructor(ContextType ctx) {
     return realm_constructor;
 }
 
+// Changes the object store applies by itself without touching the existing rows' values: new tables,
+// new optional (or list) properties and index changes. Anything else may need the migration function.
+struct AdditiveSchemaChange {
+    bool operator()(schema_change::AddTable) const { return true; }
+    bool operator()(schema_change::AddInitialProperties) const { return true; }
+    bool operator()(schema_change::AddIndex) const { return true; }
+    bool operator()(schema_change::RemoveIndex) const { return true; }
+    bool operator()(schema_change::AddProperty change) const {
+        return change.property->is_nullable || change.property->type == realm::PropertyType::Array;
+    }
+
+    template<typename Change>
+    bool operator()(Change) const { return false; }
+};
+
+static inline bool is_additive_schema_change(const realm::Schema &old_schema, const realm::Schema &new_schema) {
+    for (auto &change : old_schema.compare(new_schema)) {
+        if (!change.visit(AdditiveSchemaChange())) {
+            return false;
+        }
+    }
+    return true;
+}
+
 static inline void convert_outdated_datetime_columns(const SharedRealm &realm) {
     realm::util::Optional<int> old_file_format_version = realm->file_format_upgraded_from_version();
     if (old_file_format_version && old_file_format_version < 5) {
@@ -342,10 +678,18 @@ static inline void convert_outdated_datetime_columns(const SharedRealm &realm) {
 
 template<typename T>
 void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, size_t argc, const ValueType arguments[]) {
+    auto start = OpenStats::Clock::now();
+    OpenStats stats;
+    auto migration_time = std::make_shared<double>(0);
+
     realm::Realm::Config config;
     ObjectDefaultsMap defaults;
     ConstructorMap constructors;
+    TextIndexMap text_indexes;
     bool schema_updated = false;
+    bool prototype_accessors = false;
+    bool cache_objects = false;
+    bool bundled = false;
 
     if (argc == 0) {
         config.path = default_path();
@@ -384,14 +728,57 @@ void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, size_t
                 config.schema_mode = SchemaMode::ReadOnly;
             }
 
+            static const String bundled_string = "bundled";
+            ValueType bundled_value = Object::get_property(ctx, object, bundled_string);
+            if (!Value::is_undefined(ctx, bundled_value) && Value::validated_to_boolean(ctx, bundled_value, "bundled")) {
+                if (config.schema_mode != SchemaMode::ReadOnly) {
+                    throw std::invalid_argument("Cannot set 'bundled' without setting 'readOnly'.");
+                }
+                if (config.sync_config) {
+                    throw std::invalid_argument("Cannot set 'bundled' when 'sync' is set.");
+                }
+                if (Value::is_undefined(ctx, path_value)) {
+                    throw std::invalid_argument("The 'path' of a bundled Realm must be set to the name of its file.");
+                }
+                bundled = true;
+            }
+
+            // In-memory Realms with the same path share their data, which is discarded once the last one closes.
+            // The path still names the lock files that coordinate them.
+            static const String in_memory_string = "inMemory";
+            ValueType in_memory_value = Object::get_property(ctx, object, in_memory_string);
+            if (!Value::is_undefined(ctx, in_memory_value) && Value::validated_to_boolean(ctx, in_memory_value, "inMemory")) {
+                if (config.schema_mode == SchemaMode::ReadOnly) {
+                    throw std::invalid_argument("Cannot set 'inMemory' when 'readOnly' is set.");
+                }
+                if (config.sync_config) {
+                    throw std::invalid_argument("Cannot set 'inMemory' when 'sync' is set.");
+                }
+                config.in_memory = true;
+            }
+
             static const String schema_string = "schema";
             ValueType schema_value = Object::get_property(ctx, object, schema_string);
             if (!Value::is_undefined(ctx, schema_value)) {
                 ObjectType schema_object = Value::validated_to_object(ctx, schema_value, "schema");
-                config.schema.emplace(Schema<T>::parse_schema(ctx, schema_object, defaults, constructors));
+                auto schema_start = OpenStats::Clock::now();
+                config.schema.emplace(Schema<T>::parse_schema_cached(ctx, schema_object, defaults, constructors, text_indexes));
+                stats.schema = OpenStats::milliseconds_since(schema_start);
                 schema_updated = true;
             }
 
+            static const String prototype_accessors_string = "prototypeAccessors";
+            ValueType prototype_accessors_value = Object::get_property(ctx, object, prototype_accessors_string);
+            if (!Value::is_undefined(ctx, prototype_accessors_value)) {
+                prototype_accessors = Value::validated_to_boolean(ctx, prototype_accessors_value, "prototypeAccessors");
+            }
+
+            static const String cache_objects_string = "cacheObjects";
+            ValueType cache_objects_value = Object::get_property(ctx, object, cache_objects_string);
+            if (!Value::is_undefined(ctx, cache_objects_value)) {
+                cache_objects = Value::validated_to_boolean(ctx, cache_objects_value, "cacheObjects");
+            }
+
             static const String schema_version_string = "schemaVersion";
             ValueType version_value = Object::get_property(ctx, object, schema_version_string);
             if (!Value::is_undefined(ctx, version_value)) {
@@ -423,11 +810,32 @@ void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, size_t
                 };
             }
 
+            static const String skip_additive_migrations_string = "skipMigrationForAdditiveChanges";
+            ValueType skip_additive_migrations_value = Object::get_property(ctx, object, skip_additive_migrations_string);
+            bool skip_additive_migrations = false;
+            if (!Value::is_undefined(ctx, skip_additive_migrations_value)) {
+                skip_additive_migrations = Value::validated_to_boolean(ctx, skip_additive_migrations_value, "skipMigrationForAdditiveChanges");
+            }
+
             static const String migration_string = "migration";
             ValueType migration_value = Object::get_property(ctx, object, migration_string);
             if (!Value::is_undefined(ctx, migration_value)) {
                 FunctionType migration_function = Value::validated_to_function(ctx, migration_value, "migration");
+
+                // Without a new schema the file's own schema is kept, so there is nothing to diff against.
+                std::shared_ptr<realm::Schema> additive_target;
+                if (skip_additive_migrations && config.schema) {
+                    additive_target = std::make_shared<realm::Schema>(*config.schema);
+                }
+
                 config.migration_function = [=](SharedRealm old_realm, SharedRealm realm, realm::Schema&) {
+                    if (additive_target && is_additive_schema_change(old_realm->schema(), *additive_target)) {
+                        // The new tables and columns have already been added, so there's nothing left for JS to do.
+                        old_realm->close();
+                        return;
+                    }
+
+                    auto migration_start = OpenStats::Clock::now();
                     auto old_realm_ptr = new SharedRealm(old_realm);
                     auto realm_ptr = new SharedRealm(realm);
                     ValueType arguments[2] = {
@@ -448,6 +856,7 @@ void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, size_t
                     old_realm->close();
                     old_realm_ptr->reset();
                     realm_ptr->reset();
+                    *migration_time += OpenStats::milliseconds_since(migration_start);
                 };
             }
         }
@@ -456,20 +865,54 @@ void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, size_t
         throw std::runtime_error("Invalid arguments when constructing 'Realm'");
     }
 
-    config.path = normalize_realm_path(config.path);
-    ensure_directory_exists_for_file(config.path);
+    if (bundled) {
+        config.path = bundled_realm_file_path(config.path);
+    }
+    else {
+        config.path = normalize_realm_path(config.path);
+        ensure_directory_exists_for_file(config.path);
+    }
+    stats.config = OpenStats::milliseconds_since(start) - stats.schema;
 
-    auto realm = create_shared_realm(ctx, config, schema_updated, std::move(defaults), std::move(constructors));
+    auto open_start = OpenStats::Clock::now();
+    release_kept_realm_if_incompatible(config);
+    auto realm = create_shared_realm(ctx, config, schema_updated, std::move(defaults), std::move(constructors), std::move(text_indexes));
+    register_js_realm(realm);
+    stats.open = OpenStats::milliseconds_since(open_start);
+    stats.migration = *migration_time;
 
     // Fix for datetime -> timestamp conversion
+    auto conversion_start = OpenStats::Clock::now();
     convert_outdated_datetime_columns(realm);
+    stats.datetime_conversion = OpenStats::milliseconds_since(conversion_start);
+
+    auto prototypes_start = OpenStats::Clock::now();
+    if (prototype_accessors && Object::has_instances_without_interceptors()) {
+        create_accessor_prototypes(ctx, this_object, realm);
+    }
+    else if (schema_updated) {
+        get_delegate<T>(realm.get())->m_accessor_prototypes.clear();
+    }
+    stats.accessor_prototypes = OpenStats::milliseconds_since(prototypes_start);
 
     set_internal<T, RealmClass<T>>(this_object, new SharedRealm(realm));
+
+    // The Results of each type are kept on the Realm object rather than by the delegate, as they refer back
+    // to the Realm and would otherwise keep it alive after its object is collected.
+    if (cache_objects) {
+        Object::set_property(ctx, this_object, "_objectsCache", Object::create_empty(ctx), PropertyAttributes(ReadOnly | DontEnum | DontDelete));
+        get_delegate<T>(realm.get())->m_cache_objects = true;
+    }
+
+    stats.total = OpenStats::milliseconds_since(start);
+    stats.recorded = true;
+    stats.copy_bundled_realm_files = last_open_stats().copy_bundled_realm_files;
+    last_open_stats() = stats;
 }
 
 template<typename T>
 SharedRealm RealmClass<T>::create_shared_realm(ContextType ctx, realm::Realm::Config config, bool schema_updated,
-                                        ObjectDefaultsMap && defaults, ConstructorMap && constructors) {
+                                        ObjectDefaultsMap && defaults, ConstructorMap && constructors, TextIndexMap && text_indexes) {
     config.execution_context = Context<T>::get_execution_context_id(ctx);
 
     SharedRealm realm = realm::Realm::get_shared_realm(config);
@@ -487,11 +930,50 @@ SharedRealm RealmClass<T>::create_shared_realm(ContextType ctx, realm::Realm::Co
     if (schema_updated) {
         js_binding_context->m_defaults = std::move(defaults);
         js_binding_context->m_constructors = std::move(constructors);
+        js_binding_context->m_text_indexes = std::move(text_indexes);
     }
 
     return realm;
 }
 
+template<typename T>
+void RealmClass<T>::create_accessor_prototypes(ContextType ctx, ObjectType realm_object, const SharedRealm &realm) {
+    static const String constructor_string = "constructor";
+    static const String create_prototype_string = "_createAccessorPrototype";
+    static const String object_string = "Object";
+    static const String prototype_string = "prototype";
+
+    // The Realm constructor isn't necessarily a global, so it is found through the Realm being constructed.
+    auto delegate = get_delegate<T>(realm.get());
+    ObjectType realm_constructor = Object::validated_get_object(ctx, realm_object, constructor_string);
+    FunctionType create_prototype = Object::validated_get_function(ctx, realm_constructor, create_prototype_string);
+    ObjectType object_constructor = Object::validated_get_object(ctx, realm_constructor, object_string);
+    ObjectType object_prototype = Object::validated_get_object(ctx, object_constructor, prototype_string);
+
+    PrototypeMap prototypes;
+    for (auto &object_schema : realm->schema()) {
+        ObjectType base_prototype = object_prototype;
+        if (delegate->m_constructors.count(object_schema.name)) {
+            FunctionType constructor = delegate->m_constructors.at(object_schema.name);
+            base_prototype = Object::validated_get_object(ctx, constructor, prototype_string);
+        }
+
+        std::vector<ValueType> property_names;
+        for (auto &property : object_schema.persisted_properties) {
+            property_names.push_back(Value::from_string(ctx, property.name));
+        }
+        for (auto &property : object_schema.computed_properties) {
+            property_names.push_back(Value::from_string(ctx, property.name));
+        }
+
+        ValueType arguments[2] = {base_prototype, Object::create_array(ctx, property_names)};
+        ValueType prototype = Function<T>::call(ctx, create_prototype, realm_constructor, 2, arguments);
+        prototypes.emplace(object_schema.name, Protected<ObjectType>(ctx, Value::validated_to_object(ctx, prototype)));
+    }
+
+    delegate->m_accessor_prototypes = std::move(prototypes);
+}
+
 template<typename T>
 void RealmClass<T>::schema_version(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 1, 2);
@@ -523,7 +1005,409 @@ void RealmClass<T>::clear_test_state(ContextType ctx, FunctionType, ObjectType t
 template<typename T>
 void RealmClass<T>::copy_bundled_realm_files(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 0);
+
+    auto start = OpenStats::Clock::now();
     realm::copy_bundled_realm_files();
+    last_open_stats().copy_bundled_realm_files = OpenStats::milliseconds_since(start);
+}
+
+template<typename T>
+json RealmClass<T>::json_for_default_value(ContextType ctx, const ValueType &value) {
+    if (Value::is_null(ctx, value) || Value::is_undefined(ctx, value)) {
+        return nullptr;
+    }
+    if (Value::is_boolean(ctx, value)) {
+        return Value::to_boolean(ctx, value);
+    }
+    if (Value::is_number(ctx, value)) {
+        return Value::to_number(ctx, value);
+    }
+    if (Value::is_string(ctx, value)) {
+        return std::string(Value::to_string(ctx, value));
+    }
+    if (Value::is_date(ctx, value)) {
+        return Value::to_number(ctx, value);
+    }
+    if (Value::is_binary(ctx, value)) {
+        auto data = Value::to_binary(ctx, value);
+        return base64_encode(reinterpret_cast<const unsigned char *>(data.data()), data.size());
+    }
+
+    ObjectType object = Value::validated_to_object(ctx, value);
+    if (Value::is_array(ctx, value)) {
+        json array = json::array();
+        uint32_t length = Object::validated_get_length(ctx, object);
+        for (uint32_t i = 0; i < length; i++) {
+            array.push_back(json_for_default_value(ctx, Object::get_property(ctx, object, i)));
+        }
+        return array;
+    }
+    json dict = json::object();
+    for (auto &name : Object::get_property_names(ctx, object)) {
+        dict[std::string(name)] = json_for_default_value(ctx, Object::get_property(ctx, object, name));
+    }
+    return dict;
+}
+
+template<typename T>
+void RealmClass<T>::compact_async(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 4);
+
+    ObjectType config_object = Value::validated_to_object(ctx, arguments[0], "config");
+    double threshold = Value::validated_to_number(ctx, arguments[1], "threshold");
+    if (threshold < 0 || threshold >= 1) {
+        throw std::invalid_argument("'threshold' must be at least 0 and less than 1.");
+    }
+    FunctionType callback = Value::validated_to_function(ctx, arguments[3], "callback");
+
+    if (!Value::is_undefined(ctx, Object::get_property(ctx, config_object, "sync"))) {
+        throw std::invalid_argument("Cannot compact a synced Realm with 'compactAsync'.");
+    }
+
+    std::string path = path_for_config(ctx, config_object);
+    if (!util::File::exists(path)) {
+        throw std::invalid_argument(util::format("No Realm file exists at '%1'.", path));
+    }
+
+    std::vector<char> encryption_key;
+    ValueType encryption_key_value = Object::get_property(ctx, config_object, "encryptionKey");
+    if (!Value::is_undefined(ctx, encryption_key_value)) {
+        auto key = Value::validated_to_binary(ctx, encryption_key_value, "encryptionKey");
+        encryption_key.assign(key.data(), key.data() + key.size());
+    }
+
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<FunctionType> protected_callback(ctx, callback);
+
+    util::Optional<Protected<FunctionType>> protected_progress;
+    if (!Value::is_undefined(ctx, arguments[2])) {
+        protected_progress.emplace(ctx, Value::validated_to_function(ctx, arguments[2], "progress"));
+    }
+
+    // Progress and completion go through the same dispatcher so that they are delivered in order.
+    using CompactHandler = void(bool finished, std::string error, bool compacted, uint64_t total_bytes, uint64_t used_bytes, uint64_t compacted_bytes);
+    std::function<CompactHandler> report = EventLoopDispatcher<CompactHandler>([=](bool finished, std::string error, bool compacted, uint64_t total_bytes, uint64_t used_bytes, uint64_t compacted_bytes) {
+        HANDLESCOPE
+        if (!finished) {
+            ValueType callback_arguments[2] = {
+                Value::from_number(protected_ctx, total_bytes),
+                Value::from_number(protected_ctx, used_bytes),
+            };
+            Function<T>::callback(protected_ctx, *protected_progress, protected_this, 2, callback_arguments);
+            return;
+        }
+
+        ValueType callback_arguments[2];
+        if (!error.empty()) {
+            callback_arguments[0] = Value::from_string(protected_ctx, error);
+            callback_arguments[1] = Value::from_undefined(protected_ctx);
+        }
+        else {
+            ObjectType result = Object::create_empty(protected_ctx);
+            Object::set_property(protected_ctx, result, "compacted", Value::from_boolean(protected_ctx, compacted));
+            Object::set_property(protected_ctx, result, "totalBytes", Value::from_number(protected_ctx, total_bytes));
+            Object::set_property(protected_ctx, result, "usedBytes", Value::from_number(protected_ctx, used_bytes));
+            Object::set_property(protected_ctx, result, "compactedBytes", Value::from_number(protected_ctx, compacted_bytes));
+            callback_arguments[0] = Value::from_null(protected_ctx);
+            callback_arguments[1] = result;
+        }
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
+    });
+    bool has_progress = bool(protected_progress);
+
+    // The file is opened directly with core on the worker thread. Compacting only succeeds if that is the
+    // only session on the file, so a Realm open elsewhere makes this report `compacted: false`.
+    std::thread([=]() {
+        uint64_t total_bytes = 0, used_bytes = 0, compacted_bytes = 0;
+        bool compacted = false;
+        try {
+            auto history = realm::make_in_realm_history(path);
+            SharedGroupOptions options(encryption_key.empty() ? nullptr : encryption_key.data());
+            SharedGroup shared_group(*history, options);
+
+            size_t free_space = 0, used_space = 0;
+            shared_group.begin_read();
+            shared_group.get_stats(free_space, used_space);
+            shared_group.end_read();
+            total_bytes = free_space + used_space;
+            used_bytes = used_space;
+            compacted_bytes = total_bytes;
+
+            if (total_bytes > 0 && double(free_space) / total_bytes > threshold) {
+                if (has_progress) {
+                    report(false, "", false, total_bytes, used_bytes, compacted_bytes);
+                }
+                compacted = shared_group.compact();
+                if (compacted) {
+                    shared_group.begin_read();
+                    shared_group.get_stats(free_space, used_space);
+                    shared_group.end_read();
+                    compacted_bytes = free_space + used_space;
+                }
+            }
+        }
+        catch (std::exception &e) {
+            report(true, e.what(), false, total_bytes, used_bytes, compacted_bytes);
+            return;
+        }
+        report(true, "", compacted, total_bytes, used_bytes, compacted_bytes);
+    }).detach();
+}
+
+template<typename T>
+void RealmClass<T>::prepare_open(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 2);
+
+    ObjectType config_object = Value::validated_to_object(ctx, arguments[0], "config");
+    FunctionType callback = Value::validated_to_function(ctx, arguments[1], "callback");
+
+    // New files, in-memory Realms and Realms that are already open have nothing to prepare, and synced Realms
+    // are waited for instead.
+    std::string path = path_for_config(ctx, config_object);
+    bool read_only = false;
+    ValueType read_only_value = Object::get_property(ctx, config_object, "readOnly");
+    if (!Value::is_undefined(ctx, read_only_value)) {
+        read_only = Value::validated_to_boolean(ctx, read_only_value, "readOnly");
+    }
+    if (!Value::is_undefined(ctx, Object::get_property(ctx, config_object, "sync"))
+        || !Value::is_undefined(ctx, Object::get_property(ctx, config_object, "bundled"))
+        || !Value::is_undefined(ctx, Object::get_property(ctx, config_object, "inMemory"))
+        || !util::File::exists(path) || realm::_impl::RealmCoordinator::get_existing_coordinator(path)) {
+        ValueType callback_arguments[1] = {Value::from_null(ctx)};
+        Function<T>::callback(ctx, callback, this_object, 1, callback_arguments);
+        return;
+    }
+
+    realm::Realm::Config config;
+    config.path = path;
+    config.cache = false;
+    if (read_only) {
+        config.schema_mode = SchemaMode::ReadOnly;
+    }
+    ValueType encryption_key_value = Object::get_property(ctx, config_object, "encryptionKey");
+    if (!Value::is_undefined(ctx, encryption_key_value)) {
+        auto key = Value::validated_to_binary(ctx, encryption_key_value, "encryptionKey");
+        config.encryption_key.assign(key.data(), key.data() + key.size());
+    }
+
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<FunctionType> protected_callback(ctx, callback);
+
+    std::function<void(std::string)> report = EventLoopDispatcher<void(std::string)>([=](std::string error) {
+        HANDLESCOPE
+        ValueType callback_arguments[1];
+        callback_arguments[0] = error.empty() ? Value::from_null(protected_ctx) : Value::from_string(protected_ctx, error);
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 1, callback_arguments);
+    });
+
+    // Opening the file without a schema upgrades the file format if needed, which is only ever done once, and
+    // leaves the file in the OS's cache for the open on the JS thread. Nothing else carries over: the worker's
+    // Realm is confined to its thread and its coordinator goes away with it, so the JS thread checks the
+    // encryption key and reads the schema again. Migrations need the schema and migration function from JS, so
+    // they still run there.
+    std::thread([=]() {
+        try {
+            SharedRealm worker_realm = realm::Realm::get_shared_realm(config);
+            worker_realm->close();
+        }
+        catch (std::exception &e) {
+            report(e.what());
+            return;
+        }
+        report("");
+    }).detach();
+}
+
+template<typename T>
+void RealmClass<T>::delete_file(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 0, 1);
+
+    ObjectType config_object = argc ? Value::validated_to_object(ctx, arguments[0], "config") : Object::create_empty(ctx);
+    std::string path = path_for_config(ctx, config_object);
+    if (realm::_impl::RealmCoordinator::get_existing_coordinator(path)) {
+        throw std::runtime_error(util::format("Cannot delete the files of the Realm at '%1', which is open.", path));
+    }
+
+    util::File::try_remove(path);
+    util::File::try_remove(path + ".lock");
+    util::File::try_remove(path + ".note");
+    util::try_remove_dir_recursive(path + ".management");
+}
+
+template<typename T>
+void RealmClass<T>::delete_files_async(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 2);
+
+    std::string directory = default_realm_file_directory();
+    if (!Value::is_undefined(ctx, arguments[0])) {
+        directory = Value::validated_to_string(ctx, arguments[0], "directory");
+    }
+    FunctionType callback = Value::validated_to_function(ctx, arguments[1], "callback");
+
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<FunctionType> protected_callback(ctx, callback);
+
+    std::function<void(std::string)> report = EventLoopDispatcher<void(std::string)>([=](std::string error) {
+        HANDLESCOPE
+        ValueType callback_arguments[1] = {
+            error.empty() ? Value::from_null(protected_ctx) : Value::from_string(protected_ctx, error),
+        };
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 1, callback_arguments);
+    });
+
+    std::thread([=]() {
+        try {
+            realm::remove_realm_files_from_directory(directory);
+        }
+        catch (std::exception &e) {
+            report(e.what());
+            return;
+        }
+        report("");
+    }).detach();
+}
+
+template<typename T>
+void RealmClass<T>::import_from(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 7);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    std::string path = Value::validated_to_string(ctx, arguments[0], "path");
+    std::string object_type;
+    validated_object_schema_for_value(ctx, realm, arguments[1], object_type);
+
+    std::string format_name = Value::validated_to_string(ctx, arguments[2], "format");
+    RowImporter::Format format;
+    if (format_name == "json") {
+        format = RowImporter::Format::JSON;
+    }
+    else if (format_name == "csv") {
+        format = RowImporter::Format::CSV;
+    }
+    else {
+        throw std::invalid_argument(util::format("Unsupported import format '%1'.", format_name));
+    }
+
+    double batch_size = Value::validated_to_number(ctx, arguments[3], "batchSize");
+    if (batch_size < 1) {
+        throw std::invalid_argument("'batchSize' must be at least 1.");
+    }
+    bool update = Value::validated_to_boolean(ctx, arguments[4], "update");
+    FunctionType callback = Value::validated_to_function(ctx, arguments[6], "callback");
+
+    if (realm->config().read_only()) {
+        throw std::runtime_error("Cannot import objects into a read-only Realm.");
+    }
+
+    ImportDefaults defaults;
+    for (auto &object_defaults : get_delegate<T>(realm.get())->m_defaults) {
+        auto &converted = defaults[object_defaults.first];
+        for (auto &value : object_defaults.second) {
+            converted[value.first] = json_for_default_value(ctx, value.second);
+        }
+    }
+
+    realm::Realm::Config config = realm->config();
+    config.migration_function = nullptr;
+    config.should_compact_on_launch_function = nullptr;
+    config.cache = false;
+
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<FunctionType> protected_callback(ctx, callback);
+
+    util::Optional<Protected<FunctionType>> protected_progress;
+    if (!Value::is_undefined(ctx, arguments[5])) {
+        protected_progress.emplace(ctx, Value::validated_to_function(ctx, arguments[5], "progress"));
+    }
+
+    // Progress and completion go through the same dispatcher so that they are delivered in order.
+    using ImportHandler = void(bool finished, std::string error, uint64_t rows, uint64_t bytes_read, uint64_t total_bytes);
+    std::function<ImportHandler> report = EventLoopDispatcher<ImportHandler>([=](bool finished, std::string error, uint64_t rows, uint64_t bytes_read, uint64_t total_bytes) {
+        HANDLESCOPE
+        // Advance this Realm so the callbacks see the objects created so far.
+        SharedRealm realm = *get_internal<T, RealmClass<T>>(protected_this);
+        if (!realm->is_closed() && !realm->is_in_transaction()) {
+            realm->refresh();
+        }
+
+        if (!finished) {
+            ValueType callback_arguments[3] = {
+                Value::from_number(protected_ctx, rows),
+                Value::from_number(protected_ctx, bytes_read),
+                Value::from_number(protected_ctx, total_bytes),
+            };
+            Function<T>::callback(protected_ctx, *protected_progress, protected_this, 3, callback_arguments);
+            return;
+        }
+
+        ValueType callback_arguments[2];
+        if (!error.empty()) {
+            callback_arguments[0] = Value::from_string(protected_ctx, error);
+            callback_arguments[1] = Value::from_undefined(protected_ctx);
+        }
+        else {
+            ObjectType result = Object::create_empty(protected_ctx);
+            Object::set_property(protected_ctx, result, "rows", Value::from_number(protected_ctx, rows));
+            callback_arguments[0] = Value::from_null(protected_ctx);
+            callback_arguments[1] = result;
+        }
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
+    });
+    bool has_progress = bool(protected_progress);
+
+    // The records are parsed and written by a Realm of the worker's own, one batch per write transaction.
+    // Batches written before a failing record stay committed.
+    std::thread([=]() {
+        uint64_t rows = 0;
+        SharedRealm worker_realm;
+        try {
+            worker_realm = realm::Realm::get_shared_realm(config);
+            auto &object_schema = *worker_realm->schema().find(object_type);
+            RowImporter importer(path, format, worker_realm->schema(), object_schema);
+            JSONAccessor accessor(worker_realm, object_schema, defaults);
+
+            json record;
+            bool more = true;
+            while (more) {
+                size_t batch_rows = 0;
+                worker_realm->begin_transaction();
+                while (more && batch_rows < batch_size) {
+                    try {
+                        more = importer.next(record);
+                        if (more) {
+                            realm::Object::create<JSONAccessor::ValueType>(accessor, worker_realm, object_schema, &record, update);
+                            batch_rows++;
+                        }
+                    }
+                    catch (std::exception &e) {
+                        throw std::runtime_error(util::format("Line %1: %2", importer.line(), e.what()));
+                    }
+                }
+                worker_realm->commit_transaction();
+                rows += batch_rows;
+
+                if (has_progress && more) {
+                    report(false, "", rows, importer.bytes_read(), importer.total_bytes());
+                }
+            }
+            worker_realm->close();
+        }
+        catch (std::exception &e) {
+            if (worker_realm) {
+                if (worker_realm->is_in_transaction()) {
+                    worker_realm->cancel_transaction();
+                }
+                worker_realm->close();
+            }
+            report(true, e.what(), rows, 0, 0);
+            return;
+        }
+        report(true, "", rows, 0, 0);
+    }).detach();
 }
 
 template<typename T>
@@ -531,6 +1415,102 @@ void RealmClass<T>::get_default_path(ContextType ctx, ObjectType object, ReturnV
     return_value.set(realm::js::default_path());
 }
 
+template<typename T>
+void RealmClass<T>::get_last_open_stats(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    auto &stats = last_open_stats();
+    if (!stats.recorded) {
+        return_value.set_undefined();
+        return;
+    }
+
+    ObjectType stats_object = Object::create_empty(ctx);
+    Object::set_property(ctx, stats_object, "config", Value::from_number(ctx, stats.config));
+    Object::set_property(ctx, stats_object, "schema", Value::from_number(ctx, stats.schema));
+    Object::set_property(ctx, stats_object, "open", Value::from_number(ctx, stats.open));
+    Object::set_property(ctx, stats_object, "migration", Value::from_number(ctx, stats.migration));
+    Object::set_property(ctx, stats_object, "datetimeConversion", Value::from_number(ctx, stats.datetime_conversion));
+    Object::set_property(ctx, stats_object, "accessorPrototypes", Value::from_number(ctx, stats.accessor_prototypes));
+    Object::set_property(ctx, stats_object, "total", Value::from_number(ctx, stats.total));
+    Object::set_property(ctx, stats_object, "copyBundledRealmFiles", Value::from_number(ctx, stats.copy_bundled_realm_files));
+    return_value.set(stats_object);
+}
+
+template<typename T>
+void RealmClass<T>::get_collect_call_stats(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    return_value.set(CallStatsRegistry::shared().enabled());
+}
+
+template<typename T>
+void RealmClass<T>::set_collect_call_stats(ContextType ctx, ObjectType object, ValueType value) {
+    CallStatsRegistry::shared().set_enabled(Value::validated_to_boolean(ctx, value, "collectCallStats"));
+}
+
+template<typename T>
+void RealmClass<T>::get_collection_enumeration_limit(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    uint32_t limit = collection_enumeration_limit();
+    if (limit == std::numeric_limits<uint32_t>::max()) {
+        return_value.set(Value::from_number(ctx, std::numeric_limits<double>::infinity()));
+    }
+    else {
+        return_value.set(Value::from_number(ctx, double(limit)));
+    }
+}
+
+template<typename T>
+void RealmClass<T>::set_collection_enumeration_limit(ContextType ctx, ObjectType object, ValueType value) {
+    double limit = Value::validated_to_number(ctx, value, "collectionEnumerationLimit");
+    if (!(limit >= 0)) {
+        throw std::invalid_argument("collectionEnumerationLimit must be a non-negative number.");
+    }
+    collection_enumeration_limit() = limit >= std::numeric_limits<uint32_t>::max() ? std::numeric_limits<uint32_t>::max() : uint32_t(limit);
+}
+
+template<typename T>
+void RealmClass<T>::get_keep_open_across_reloads(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    return_value.set(keep_realms_open_across_reloads().load());
+}
+
+template<typename T>
+void RealmClass<T>::set_keep_open_across_reloads(ContextType ctx, ObjectType object, ValueType value) {
+    keep_realms_open_across_reloads() = Value::validated_to_boolean(ctx, value, "keepOpenAcrossReloads");
+}
+
+template<typename T>
+void RealmClass<T>::get_version_warning_threshold(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    return_value.set(Value::from_number(ctx, double(version_warning_threshold().load())));
+}
+
+template<typename T>
+void RealmClass<T>::set_version_warning_threshold(ContextType ctx, ObjectType object, ValueType value) {
+    double threshold = Value::validated_to_number(ctx, value, "versionWarningThreshold");
+    if (!(threshold >= 0)) {
+        throw std::invalid_argument("versionWarningThreshold must be a non-negative number.");
+    }
+    version_warning_threshold() = uint64_t(threshold);
+}
+
+template<typename T>
+void RealmClass<T>::get_call_stats(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    ObjectType stats_object = Object::create_empty(ctx);
+    for (auto &pair : CallStatsRegistry::shared().snapshot()) {
+        auto &stats = pair.second;
+
+        std::vector<ValueType> histogram;
+        histogram.reserve(stats.histogram.size());
+        for (auto count : stats.histogram) {
+            histogram.push_back(Value::from_number(ctx, double(count)));
+        }
+
+        ObjectType entry = Object::create_empty(ctx);
+        Object::set_property(ctx, entry, "calls", Value::from_number(ctx, double(stats.calls)));
+        Object::set_property(ctx, entry, "totalTime", Value::from_number(ctx, stats.total_time));
+        Object::set_property(ctx, entry, "maxTime", Value::from_number(ctx, stats.max_time));
+        Object::set_property(ctx, entry, "histogram", Object::create_array(ctx, histogram));
+        Object::set_property(ctx, stats_object, pair.first, entry);
+    }
+    return_value.set(stats_object);
+}
+
 template<typename T>
 void RealmClass<T>::set_default_path(ContextType ctx, ObjectType object, ValueType value) {
     js::set_default_path(Value::validated_to_string(ctx, value, "defaultPath"));
@@ -652,7 +1632,7 @@ void RealmClass<T>::wait_for_download_completion(ContextType ctx, FunctionType,
                         callback_arguments[1] = Value::from_number(protected_ctx, transferrable_bytes);
 
                         Function<T>::callback(protected_ctx, protected_progressCallback, protected_this, 2, callback_arguments);
-                    });
+                    }, true);
 
                     progressFunc = std::move(progress_handler);
                 }
@@ -694,11 +1674,71 @@ template<typename T>
 void RealmClass<T>::objects(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 1);
 
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    std::string object_type;
+    auto &object_schema = validated_object_schema_for_value(ctx, realm, arguments[0], object_type);
+
+    // Only Realms opened with `cacheObjects` share one Results (and so its listeners) between calls.
+    auto delegate = get_delegate<T>(realm.get());
+    if (!delegate || !delegate->m_cache_objects) {
+        return_value.set(ResultsClass<T>::create_instance(ctx, realm, object_type));
+        return;
+    }
+    ValueType cache_value = Object::get_property(ctx, this_object, "_objectsCache");
+    if (Value::is_undefined(ctx, cache_value)) {
+        return_value.set(ResultsClass<T>::create_instance(ctx, realm, object_type));
+        return;
+    }
+
+    ObjectType cache = Value::validated_to_object(ctx, cache_value);
+    ValueType cached_value = Object::get_property(ctx, cache, object_type);
+    if (Value::is_object(ctx, cached_value)) {
+        ObjectType cached = Value::to_object(ctx, cached_value);
+        if (Object::template is_instance<ResultsClass<T>>(ctx, cached)) {
+            // A schema change replaces the object schemas, which the cached Results would still refer to.
+            auto results = get_internal<T, ResultsClass<T>>(cached);
+            if (results->is_valid() && &results->get_object_schema() == &object_schema) {
+                return_value.set(cached);
+                return;
+            }
+        }
+    }
+
+    ObjectType results = ResultsClass<T>::create_instance(ctx, realm, object_type);
+    Object::set_property(ctx, cache, object_type, results);
+    return_value.set(results);
+}
+
+template<typename T>
+void RealmClass<T>::count(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count_at_least(argc, 1);
+
     SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
     std::string object_type;
     validated_object_schema_for_value(ctx, realm, arguments[0], object_type);
+    auto table = ObjectStore::table_for_object_type(realm->read_group(), object_type);
+    if (argc == 1) {
+        return_value.set((uint32_t)table->size());
+        return;
+    }
 
-    return_value.set(ResultsClass<T>::create_instance(ctx, realm, object_type));
+    // Counting the query doesn't build a TableView.
+    auto count_matches = [&] {
+        realm::Results results(realm, *table);
+        return ResultsClass<T>::filter_collection(ctx, results, argc - 1, &arguments[1]).size();
+    };
+
+    size_t count;
+    auto delegate = get_delegate<T>(realm.get());
+    if (argc == 2 && delegate) {
+        // Without arguments for its placeholders the predicate alone identifies the count.
+        std::string predicate = Value::validated_to_string(ctx, arguments[1], "predicate");
+        count = delegate->m_count_cache.get(realm->read_group(), object_type + '\0' + predicate, count_matches);
+    }
+    else {
+        count = count_matches();
+    }
+    return_value.set((uint32_t)count);
 }
 
 template<typename T>
@@ -742,6 +1782,148 @@ void RealmClass<T>::create(ContextType ctx, FunctionType, ObjectType this_object
     return_value.set(RealmObjectClass<T>::create_instance(ctx, std::move(realm_object)));
 }
 
+template<typename T>
+uint32_t RealmClass<T>::create_objects(ContextType ctx, SharedRealm &realm, const ObjectSchema &object_schema, const ValueType &value,
+                                       bool update, const char *method) {
+    ObjectType objects = Value::validated_to_object(ctx, value, "objects");
+    if (!Value::is_array(ctx, value)) {
+        throw std::runtime_error(util::format("Argument to '%1' must be an array of objects.", method));
+    }
+
+    // Resolve the property names once so array-form rows don't convert them again for every object.
+    size_t property_count = object_schema.persisted_properties.size();
+    std::vector<String> property_names;
+    property_names.reserve(property_count);
+    for (auto &property : object_schema.persisted_properties) {
+        property_names.push_back(property.name);
+    }
+
+    NativeAccessor accessor(ctx, realm, object_schema);
+    uint32_t length = Object::validated_get_length(ctx, objects);
+
+    for (uint32_t i = 0; i < length; i++) {
+        ValueType value = Object::get_property(ctx, objects, i);
+        ObjectType object = Value::validated_to_object(ctx, value, "properties");
+
+        if (Value::is_array(ctx, value)) {
+            if (property_count != Object::validated_get_length(ctx, object)) {
+                throw std::runtime_error("Array must contain values for all object properties");
+            }
+
+            ObjectType dict = Object::create_empty(ctx);
+            for (uint32_t j = 0; j < property_count; j++) {
+                Object::set_property(ctx, dict, property_names[j], Object::get_property(ctx, object, j));
+            }
+            object = dict;
+        }
+
+        realm::Object::create<ValueType>(accessor, realm, object_schema, object, update);
+    }
+
+    return length;
+}
+
+template<typename T>
+void RealmClass<T>::create_many(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 2, 3);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    std::string object_type;
+    auto &object_schema = validated_object_schema_for_value(ctx, realm, arguments[0], object_type);
+
+    bool update = false;
+    if (argc == 3) {
+        update = Value::validated_to_boolean(ctx, arguments[2], "update");
+    }
+
+    return_value.set(create_objects(ctx, realm, object_schema, arguments[1], update, "createMany"));
+}
+
+template<typename T>
+void RealmClass<T>::upsert_many(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    std::string object_type;
+    auto &object_schema = validated_object_schema_for_value(ctx, realm, arguments[0], object_type);
+    if (!object_schema.primary_key_property()) {
+        throw std::runtime_error(util::format("'%1' does not have a primary key defined", object_schema.name));
+    }
+
+    return_value.set(create_objects(ctx, realm, object_schema, arguments[1], true, "upsertMany"));
+}
+
+template<typename T>
+void RealmClass<T>::objects_for_primary_keys(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    std::string object_type;
+    auto &object_schema = validated_object_schema_for_value(ctx, realm, arguments[0], object_type);
+    auto primary_key = object_schema.primary_key_property();
+    if (!primary_key) {
+        throw std::runtime_error(util::format("'%1' does not have a primary key defined", object_schema.name));
+    }
+
+    ObjectType keys = Value::validated_to_array(ctx, arguments[1], "keys");
+    uint32_t length = Object::validated_get_length(ctx, keys);
+    auto table = ObjectStore::table_for_object_type(realm->read_group(), object_schema.name);
+    size_t column = primary_key->table_column;
+
+    // Each distinct key is looked up once, and repeated keys share the object created for the first one.
+    std::unordered_map<int64_t, ValueType> int_objects;
+    std::unordered_map<std::string, ValueType> string_objects;
+    util::Optional<ValueType> null_object;
+
+    auto object_for_row = [&](size_t row_index) -> ValueType {
+        if (row_index == realm::not_found) {
+            return Value::from_undefined(ctx);
+        }
+        return RealmObjectClass<T>::create_instance(ctx, realm::Object(realm, object_schema, table->get(row_index)));
+    };
+
+    std::vector<ValueType> objects;
+    objects.reserve(length);
+
+    for (uint32_t i = 0; i < length; i++) {
+        ValueType key = Object::get_property(ctx, keys, i);
+
+        if (Value::is_null(ctx, key) || Value::is_undefined(ctx, key)) {
+            if (!primary_key->is_nullable) {
+                throw std::invalid_argument(util::format("Invalid null value for non-nullable primary key '%1.%2'.",
+                                                         object_schema.name, primary_key->name));
+            }
+            if (!null_object) {
+                null_object = object_for_row(table->find_first_null(column));
+            }
+            objects.push_back(*null_object);
+        }
+        else if (primary_key->type == PropertyType::Int) {
+            // Fractional keys would otherwise be truncated into a different key.
+            double number = Value::validated_to_number(ctx, key, "key");
+            if (std::trunc(number) != number || !(std::abs(number) < 9223372036854775808.0)) {
+                throw TypeErrorException(util::format("%1.%2", object_schema.name, primary_key->name), "integer");
+            }
+            int64_t value = int64_t(number);
+            auto it = int_objects.find(value);
+            if (it == int_objects.end()) {
+                it = int_objects.emplace(value, object_for_row(table->find_first_int(column, value))).first;
+            }
+            objects.push_back(it->second);
+        }
+        else {
+            std::string value = Value::validated_to_string(ctx, key, "key");
+            auto it = string_objects.find(value);
+            if (it == string_objects.end()) {
+                it = string_objects.emplace(value, object_for_row(table->find_first_string(column, value))).first;
+            }
+            objects.push_back(it->second);
+        }
+    }
+
+    return_value.set(Object::create_array(ctx, objects));
+}
+
 template<typename T>
 void RealmClass<T>::delete_one(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 1);
@@ -763,6 +1945,10 @@ void RealmClass<T>::delete_one(ContextType ctx, FunctionType, ObjectType this_ob
         table->move_last_over(object->row().get_index());
     }
     else if (Value::is_array(ctx, arg)) {
+        // Arrays almost always hold objects of a single type, so only look the table up again when the type changes.
+        const ObjectSchema *object_schema = nullptr;
+        realm::TableRef table;
+
         uint32_t length = Object::validated_get_length(ctx, arg);
         for (uint32_t i = length; i--;) {
             ObjectType object = Object::validated_get_object(ctx, arg, i);
@@ -772,7 +1958,10 @@ void RealmClass<T>::delete_one(ContextType ctx, FunctionType, ObjectType this_ob
             }
 
             auto realm_object = get_internal<T, RealmObjectClass<T>>(object);
-            realm::TableRef table = ObjectStore::table_for_object_type(realm->read_group(), realm_object->get_object_schema().name);
+            if (&realm_object->get_object_schema() != object_schema) {
+                object_schema = &realm_object->get_object_schema();
+                table = ObjectStore::table_for_object_type(realm->read_group(), object_schema->name);
+            }
             table->move_last_over(realm_object->row().get_index());
         }
     }
@@ -789,6 +1978,27 @@ void RealmClass<T>::delete_one(ContextType ctx, FunctionType, ObjectType this_ob
     }
 }
 
+template<typename T>
+void RealmClass<T>::delete_where(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count_at_least(argc, 2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    if (!realm->is_in_transaction()) {
+        throw std::runtime_error("Can only delete objects within a transaction.");
+    }
+
+    std::string object_type;
+    auto &object_schema = validated_object_schema_for_value(ctx, realm, arguments[0], object_type);
+    auto table = ObjectStore::table_for_object_type(realm->read_group(), object_schema.name);
+
+    // The matching rows are found and removed by core without creating any objects for them.
+    auto results = ResultsClass<T>::filter_collection(ctx, realm::Results(realm, *table), argc - 1, arguments + 1);
+    size_t count = results.size();
+    results.clear();
+
+    return_value.set((uint32_t)count);
+}
+
 template<typename T>
 void RealmClass<T>::delete_all(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 0);
@@ -804,6 +2014,29 @@ void RealmClass<T>::delete_all(ContextType ctx, FunctionType, ObjectType this_ob
     }
 }
 
+// Begins a write transaction without leaving any collection listener waiting for changes. Those still waiting
+// once it is committed would be called with changes that leave out the transaction's own, which only arrive
+// later. Beginning it advances the Realm to the latest version, notifying the listeners again.
+template<typename T>
+void RealmClass<T>::begin_write(const SharedRealm &realm) {
+    auto delegate = get_delegate<T>(realm.get());
+    if (delegate) {
+        delegate->count_change();
+        delegate->m_listener_scheduler.flush_waiting();
+    }
+
+    realm->begin_transaction();
+    if (delegate) {
+        try {
+            delegate->m_listener_scheduler.flush_waiting();
+        }
+        catch (...) {
+            realm->cancel_transaction();
+            throw;
+        }
+    }
+}
+
 template<typename T>
 void RealmClass<T>::write(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 1);
@@ -811,7 +2044,7 @@ void RealmClass<T>::write(ContextType ctx, FunctionType, ObjectType this_object,
     SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
     FunctionType callback = Value::validated_to_function(ctx, arguments[0]);
 
-    realm->begin_transaction();
+    begin_write(realm);
 
     try {
         Function<T>::call(ctx, callback, this_object, 0, nullptr);
@@ -829,7 +2062,7 @@ void RealmClass<T>::begin_transaction(ContextType ctx, FunctionType, ObjectType
     validate_argument_count(argc, 0);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
-    realm->begin_transaction();
+    begin_write(realm);
 }
 
 template<typename T>
@@ -852,42 +2085,48 @@ template<typename T>
 void RealmClass<T>::add_listener(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 2);
 
-    validated_notification_name(ctx, arguments[0]);
+    auto name = validated_notification_name(ctx, arguments[0]);
     auto callback = Value::validated_to_function(ctx, arguments[1]);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
     if (realm->is_closed()) {
         throw ClosedRealmException();
     }
-    get_delegate<T>(realm.get())->add_notification(callback);
+    get_delegate<T>(realm.get())->add_notification(name, callback);
 }
 
 template<typename T>
 void RealmClass<T>::remove_listener(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 2);
 
-    validated_notification_name(ctx, arguments[0]);
+    auto name = validated_notification_name(ctx, arguments[0]);
     auto callback = Value::validated_to_function(ctx, arguments[1]);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
     if (realm->is_closed()) {
         throw ClosedRealmException();
     }
-    get_delegate<T>(realm.get())->remove_notification(callback);
+    get_delegate<T>(realm.get())->remove_notification(name, callback);
 }
 
 template<typename T>
 void RealmClass<T>::remove_all_listeners(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 0, 1);
+    std::string name;
     if (argc) {
-        validated_notification_name(ctx, arguments[0]);
+        name = validated_notification_name(ctx, arguments[0]);
     }
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
     if (realm->is_closed()) {
         throw ClosedRealmException();
     }
-    get_delegate<T>(realm.get())->remove_all_notifications();
+    if (argc) {
+        get_delegate<T>(realm.get())->remove_all_notifications(name);
+    }
+    else {
+        get_delegate<T>(realm.get())->remove_all_notifications();
+    }
 }
 
 template<typename T>
@@ -895,9 +2134,62 @@ void RealmClass<T>::close(ContextType ctx, FunctionType, ObjectType this_object,
     validate_argument_count(argc, 0);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    if (auto delegate = get_delegate<T>(realm.get())) {
+        delegate->count_change();
+        delegate->release_notification_object();
+    }
     realm->close();
 }
 
+template<typename T>
+void RealmClass<T>::stats(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 0);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    if (realm->is_closed()) {
+        throw std::runtime_error("Cannot read the stats of a closed Realm.");
+    }
+    auto delegate = get_delegate<T>(realm.get());
+    auto &config = realm->config();
+    ObjectType stats = Object::create_empty(ctx);
+
+    size_t notification_tokens = delegate->notification_count();
+    ObjectType live_objects = Object::create_empty(ctx);
+    for (auto &count : LiveObjectRegistry::shared().counts_for(config.path)) {
+        if (count.first == LiveObjectRegistry::notification_token_kind()) {
+            notification_tokens += count.second;
+        }
+        else {
+            Object::set_property(ctx, live_objects, count.first, Value::from_number(ctx, double(count.second)));
+        }
+    }
+    Object::set_property(ctx, stats, "liveObjects", live_objects);
+    Object::set_property(ctx, stats, "notificationTokens", Value::from_number(ctx, double(notification_tokens)));
+
+    // Core maps the whole file, so its size is also how much address space the Realm takes up.
+    ValueType file_size = Value::from_null(ctx);
+    if (!config.in_memory && util::File::exists(config.path)) {
+        util::File file(config.path, util::File::mode_Read);
+        file_size = Value::from_number(ctx, double(file.get_size()));
+    }
+    Object::set_property(ctx, stats, "fileSize", file_size);
+
+    ValueType versions = Value::from_null(ctx);
+    ValueType used_size = Value::from_null(ctx);
+    ValueType free_size = Value::from_null(ctx);
+    if (FileStats::supports(config)) {
+        FileStats file_stats(config, true);
+        versions = Value::from_number(ctx, double(file_stats.versions));
+        used_size = Value::from_number(ctx, double(file_stats.used_space));
+        free_size = Value::from_number(ctx, double(file_stats.free_space));
+    }
+    Object::set_property(ctx, stats, "versions", versions);
+    Object::set_property(ctx, stats, "usedSize", used_size);
+    Object::set_property(ctx, stats, "freeSize", free_size);
+
+    return_value.set(stats);
+}
+
 template<typename T>
 void RealmClass<T>::compact(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 0);
@@ -18,6 +18,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
 #include "object_accessor.hpp"
 #include "object_store.hpp"
 #include "util/format.hpp"
@@ -32,8 +38,202 @@ namespace js {
 
 template<typename> class NativeAccessor;
 
+// Remembers where each property name was found in an ObjectSchema, so that repeated property access
+// doesn't scan the schema again. Entries are verified against the schema before use, which keeps
+// stale entries harmless, and the whole cache is dropped whenever the schema changes. Names that aren't
+// properties, such as the ones frameworks probe objects for, are also remembered, but only up to a limit per
+// object type, so that code looking up arbitrary keys can't make the cache grow without bound.
+class PropertyIndexCache {
+    static constexpr size_t not_a_property = size_t(-1);
+
+    static size_t max_cached_misses() {
+        return 64;
+    }
+
+    struct Indexes {
+        std::unordered_map<std::string, size_t> by_name;
+        size_t miss_count = 0;
+    };
+
+    std::unordered_map<const ObjectSchema *, Indexes> m_indexes;
+
+    static const Property *property_at(const ObjectSchema &object_schema, size_t index) {
+        size_t persisted_count = object_schema.persisted_properties.size();
+        if (index < persisted_count) {
+            return &object_schema.persisted_properties[index];
+        }
+        if (index - persisted_count < object_schema.computed_properties.size()) {
+            return &object_schema.computed_properties[index - persisted_count];
+        }
+        return nullptr;
+    }
+
+    static size_t index_of(const ObjectSchema &object_schema, const std::string &name) {
+        size_t persisted_count = object_schema.persisted_properties.size();
+        for (size_t i = 0; i < persisted_count; i++) {
+            if (object_schema.persisted_properties[i].name == name) {
+                return i;
+            }
+        }
+        for (size_t i = 0; i < object_schema.computed_properties.size(); i++) {
+            if (object_schema.computed_properties[i].name == name) {
+                return persisted_count + i;
+            }
+        }
+        return not_a_property;
+    }
+
+  public:
+    const Property *find(const ObjectSchema &object_schema, const std::string &name) {
+        auto &indexes = m_indexes[&object_schema];
+        auto it = indexes.by_name.find(name);
+        if (it != indexes.by_name.end()) {
+            if (it->second == not_a_property) {
+                return nullptr;
+            }
+            const Property *prop = property_at(object_schema, it->second);
+            if (prop && prop->name == name) {
+                return prop;
+            }
+        }
+
+        // Any entry found above is stale, as it pointed to another property.
+        size_t index = index_of(object_schema, name);
+        if (it != indexes.by_name.end()) {
+            it->second = index;
+            indexes.miss_count += index == not_a_property;
+        }
+        else if (index != not_a_property || indexes.miss_count < max_cached_misses()) {
+            indexes.by_name.emplace(name, index);
+            indexes.miss_count += index == not_a_property;
+        }
+        return index == not_a_property ? nullptr : property_at(object_schema, index);
+    }
+
+    void clear() {
+        m_indexes.clear();
+    }
+};
+
+template<typename T, PropertyType type>
+struct PropertySetter;
+
+// The setter for each persisted property of an ObjectSchema, chosen by the property's type the first time
+// something is assigned to an object of that type. Like PropertyIndexCache, it is dropped whenever the
+// schema changes.
 template<typename T>
-struct RealmObjectClass : ClassDefinition<T, realm::Object> {
+class PropertySetterTable {
+  public:
+    using Setter = void (*)(typename T::Context, realm::Object &, const Property &, typename T::Value);
+
+    const std::vector<Setter> &setters_for(const ObjectSchema &object_schema) {
+        auto &setters = m_setters[&object_schema];
+        if (setters.size() != object_schema.persisted_properties.size()) {
+            setters.clear();
+            setters.reserve(object_schema.persisted_properties.size());
+            for (auto &prop : object_schema.persisted_properties) {
+                setters.push_back(setter_for_property(prop));
+            }
+        }
+        return setters;
+    }
+
+    static Setter setter_for_property(const Property &prop) {
+        // Primary keys can only be changed during a migration, which the object store checks for.
+        if (prop.is_primary) {
+            return &PropertySetter<T, PropertyType::Any>::set;
+        }
+        switch (prop.type) {
+            case PropertyType::Bool:   return &PropertySetter<T, PropertyType::Bool>::set;
+            case PropertyType::Int:    return &PropertySetter<T, PropertyType::Int>::set;
+            case PropertyType::Float:  return &PropertySetter<T, PropertyType::Float>::set;
+            case PropertyType::Double: return &PropertySetter<T, PropertyType::Double>::set;
+            case PropertyType::String: return &PropertySetter<T, PropertyType::String>::set;
+            case PropertyType::Data:   return &PropertySetter<T, PropertyType::Data>::set;
+            case PropertyType::Date:   return &PropertySetter<T, PropertyType::Date>::set;
+            default:                   return &PropertySetter<T, PropertyType::Any>::set;
+        }
+    }
+
+    void clear() {
+        m_setters.clear();
+    }
+
+  private:
+    std::unordered_map<const ObjectSchema *, std::vector<Setter>> m_setters;
+};
+
+// Resolves the type and property given to linkingObjects() and linkingObjectsCount() to the table and column
+// that the backlinks come from, validating them only the first time they're used with an object type.
+// The whole cache is dropped whenever the schema changes. The table is kept by its index in the group, as
+// compacting the file detaches the table accessors, and is looked up again from the group each time.
+class BacklinkCache {
+  public:
+    struct Backlink {
+        size_t origin_table_index;
+        size_t origin_column;
+
+        TableRef origin_table(realm::Realm &realm) const {
+            return realm.read_group().get_table(origin_table_index);
+        }
+    };
+
+    const Backlink &find(realm::Realm &realm, const ObjectSchema &object_schema, const std::string &object_type, const std::string &property_name) {
+        auto &backlinks = m_backlinks[&object_schema];
+        std::string key = object_type + '.' + property_name;
+        auto it = backlinks.find(key);
+        if (it == backlinks.end()) {
+            it = backlinks.emplace(std::move(key), resolve(realm, object_schema, object_type, property_name)).first;
+        }
+        return it->second;
+    }
+
+    static Backlink resolve(realm::Realm &realm, const ObjectSchema &object_schema, const std::string &object_type, const std::string &property_name) {
+        auto origin_object_schema = realm.schema().find(object_type);
+        if (origin_object_schema == realm.schema().end()) {
+            throw std::logic_error(util::format("Could not find schema for type '%1'", object_type));
+        }
+
+        auto link_property = origin_object_schema->property_for_name(property_name);
+        if (!link_property) {
+            throw std::logic_error(util::format("Type '%1' does not contain property '%2'", object_type, property_name));
+        }
+
+        if (link_property->object_type != object_schema.name) {
+            throw std::logic_error(util::format("'%1.%2' is not a relationship to '%3'", object_type, property_name, object_schema.name));
+        }
+
+        auto origin_table = ObjectStore::table_for_object_type(realm.read_group(), origin_object_schema->name);
+        return {origin_table->get_index_in_group(), link_property->table_column};
+    }
+
+    void clear() {
+        m_backlinks.clear();
+    }
+
+  private:
+    std::unordered_map<const ObjectSchema *, std::unordered_map<std::string, Backlink>> m_backlinks;
+};
+
+// A realm::Object along with the listeners added to it from JS. The listeners share a single
+// notification callback, which is registered with the first one and released with the last.
+template<typename T>
+class RealmObject : public realm::Object {
+  public:
+    RealmObject(realm::Object object) : realm::Object(std::move(object)),
+        m_live_count(realm()->config().path, get_object_schema().name) {}
+
+    CallbackRegistry<T, std::nullptr_t> m_listeners;
+    NotificationToken m_notification_token;
+    // Set while m_notification_token is registered.
+    util::Optional<LiveObjectCounter> m_notification_count;
+
+  private:
+    LiveObjectCounter m_live_count;
+};
+
+template<typename T>
+struct RealmObjectClass : ClassDefinition<T, RealmObject<T>> {
     using ContextType = typename T::Context;
     using FunctionType = typename T::Function;
     using ObjectType = typename T::Object;
@@ -46,6 +246,11 @@ struct RealmObjectClass : ClassDefinition<T, realm::Object> {
 
     static ObjectType create_instance(ContextType, realm::Object);
 
+    static const Property *find_property(realm::Object &, const std::string &);
+    static const Property &validated_property_at(ContextType, realm::Object &, const ValueType &);
+    static ValueType get_property_value(NativeAccessor<T> &, realm::Object &, const Property &);
+    static void set_property_value(ContextType, realm::Object &, const Property &, ValueType);
+
     static void get_property(ContextType, ObjectType, const String &, ReturnValue &);
     static bool set_property(ContextType, ObjectType, const String &, ValueType);
     static std::vector<String> get_property_names(ContextType, ObjectType);
@@ -53,6 +258,18 @@ struct RealmObjectClass : ClassDefinition<T, realm::Object> {
     static void is_valid(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
     static void get_object_schema(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
     static void linking_objects(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
+    static void linking_objects_count(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
+    static const BacklinkCache::Backlink &validated_backlink(ContextType, realm::Object &, const ValueType [], BacklinkCache::Backlink &);
+    static void get_property_at(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
+    static void set_property_at(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
+    static void to_json(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
+
+    // observable
+    static void add_listener(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
+    static void remove_listener(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
+    static void remove_all_listeners(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
+
+    static ValueType create_object_change_set(ContextType, const realm::Object &, const CollectionChangeSet &);
 
     const std::string name = "RealmObject";
 
@@ -66,9 +283,329 @@ struct RealmObjectClass : ClassDefinition<T, realm::Object> {
         {"isValid", wrap<is_valid>},
         {"objectSchema", wrap<get_object_schema>},
         {"linkingObjects", wrap<linking_objects>},
+        {"linkingObjectsCount", wrap<linking_objects_count>},
+        {"_getPropertyAt", wrap<get_property_at>},
+        {"_setPropertyAt", wrap<set_property_at>},
+        {"toJSON", wrap<to_json>},
+        {"addListener", wrap<add_listener>},
+        {"removeListener", wrap<remove_listener>},
+        {"removeAllListeners", wrap<remove_all_listeners>},
     };
 };
 
+// Assigns a JS value to a property of one type. The specializations for primitive types check the value
+// while converting it and write it straight to the row, where going through the object store would check it
+// against the property, look the property up by name again and then switch on its type to unbox it.
+template<typename T, PropertyType type>
+struct PropertySetter {
+    using ContextType = typename T::Context;
+    using ValueType = typename T::Value;
+    using Value = js::Value<T>;
+
+    // Links, lists and primary keys are set through the object store.
+    static void set(ContextType ctx, realm::Object &realm_object, const Property &prop, ValueType value) {
+        if (!Value::is_valid_for_property(ctx, value, prop)) {
+            throw_type_error(realm_object, prop);
+        }
+
+        NativeAccessor<T> accessor(ctx, realm_object.realm(), realm_object.get_object_schema());
+        realm_object.set_property_value(accessor, prop.name, value, true);
+    }
+
+    [[noreturn]] static void throw_type_error(realm::Object &realm_object, const Property &prop) {
+        throw TypeErrorException(util::format("%1.%2", realm_object.get_object_schema().name, prop.name),
+                                 js_type_name_for_property_type(prop.type));
+    }
+
+    // Checks that the object can be modified and sets null values. Returns false if the value still needs to be
+    // written, which then has to be of the property's type.
+    static bool prepare(ContextType ctx, realm::Object &realm_object, const Property &prop, const ValueType &value) {
+        if (!realm_object.is_valid()) {
+            throw std::runtime_error(util::format("Accessing object of type %1 which has been invalidated or deleted",
+                                                  realm_object.get_object_schema().name));
+        }
+        if (!realm_object.realm()->is_in_transaction()) {
+            throw std::runtime_error("Cannot modify managed objects outside of a write transaction.");
+        }
+        if (!Value::is_null(ctx, value) && !Value::is_undefined(ctx, value)) {
+            return false;
+        }
+        if (!prop.is_nullable) {
+            throw_type_error(realm_object, prop);
+        }
+        auto &row = realm_object.row();
+        row.get_table()->set_null(prop.table_column, row.get_index());
+        return true;
+    }
+};
+
+template<typename T>
+struct PropertySetter<T, PropertyType::Bool> : PropertySetter<T, PropertyType::Any> {
+    using Base = PropertySetter<T, PropertyType::Any>;
+
+    static void set(typename T::Context ctx, realm::Object &realm_object, const Property &prop, typename T::Value value) {
+        if (Base::prepare(ctx, realm_object, prop, value)) {
+            return;
+        }
+        if (!Value<T>::is_boolean(ctx, value)) {
+            Base::throw_type_error(realm_object, prop);
+        }
+        auto &row = realm_object.row();
+        row.get_table()->set_bool(prop.table_column, row.get_index(), Value<T>::to_boolean(ctx, value));
+    }
+};
+
+template<typename T>
+struct PropertySetter<T, PropertyType::Int> : PropertySetter<T, PropertyType::Any> {
+    using Base = PropertySetter<T, PropertyType::Any>;
+
+    static void set(typename T::Context ctx, realm::Object &realm_object, const Property &prop, typename T::Value value) {
+        if (Base::prepare(ctx, realm_object, prop, value)) {
+            return;
+        }
+        if (!Value<T>::is_number(ctx, value)) {
+            Base::throw_type_error(realm_object, prop);
+        }
+        auto &row = realm_object.row();
+        row.get_table()->set_int(prop.table_column, row.get_index(), int64_t(Value<T>::to_number(ctx, value)));
+    }
+};
+
+template<typename T>
+struct PropertySetter<T, PropertyType::Float> : PropertySetter<T, PropertyType::Any> {
+    using Base = PropertySetter<T, PropertyType::Any>;
+
+    static void set(typename T::Context ctx, realm::Object &realm_object, const Property &prop, typename T::Value value) {
+        if (Base::prepare(ctx, realm_object, prop, value)) {
+            return;
+        }
+        if (!Value<T>::is_number(ctx, value)) {
+            Base::throw_type_error(realm_object, prop);
+        }
+        auto &row = realm_object.row();
+        row.get_table()->set_float(prop.table_column, row.get_index(), float(Value<T>::to_number(ctx, value)));
+    }
+};
+
+template<typename T>
+struct PropertySetter<T, PropertyType::Double> : PropertySetter<T, PropertyType::Any> {
+    using Base = PropertySetter<T, PropertyType::Any>;
+
+    static void set(typename T::Context ctx, realm::Object &realm_object, const Property &prop, typename T::Value value) {
+        if (Base::prepare(ctx, realm_object, prop, value)) {
+            return;
+        }
+        if (!Value<T>::is_number(ctx, value)) {
+            Base::throw_type_error(realm_object, prop);
+        }
+        auto &row = realm_object.row();
+        row.get_table()->set_double(prop.table_column, row.get_index(), Value<T>::to_number(ctx, value));
+    }
+};
+
+template<typename T>
+struct PropertySetter<T, PropertyType::String> : PropertySetter<T, PropertyType::Any> {
+    using Base = PropertySetter<T, PropertyType::Any>;
+
+    static void set(typename T::Context ctx, realm::Object &realm_object, const Property &prop, typename T::Value value) {
+        if (Base::prepare(ctx, realm_object, prop, value)) {
+            return;
+        }
+        if (!Value<T>::is_string(ctx, value)) {
+            Base::throw_type_error(realm_object, prop);
+        }
+        std::string buffer;
+        auto &row = realm_object.row();
+        row.get_table()->set_string(prop.table_column, row.get_index(), Value<T>::to_string_data(ctx, value, buffer));
+    }
+};
+
+template<typename T>
+struct PropertySetter<T, PropertyType::Data> : PropertySetter<T, PropertyType::Any> {
+    using Base = PropertySetter<T, PropertyType::Any>;
+
+    static void set(typename T::Context ctx, realm::Object &realm_object, const Property &prop, typename T::Value value) {
+        if (Base::prepare(ctx, realm_object, prop, value)) {
+            return;
+        }
+        if (!Value<T>::is_binary(ctx, value)) {
+            Base::throw_type_error(realm_object, prop);
+        }
+        OwnedBinaryData buffer;
+        auto &row = realm_object.row();
+        row.get_table()->set_binary(prop.table_column, row.get_index(), Value<T>::to_binary_data(ctx, value, buffer));
+    }
+};
+
+template<typename T>
+struct PropertySetter<T, PropertyType::Date> : PropertySetter<T, PropertyType::Any> {
+    using Base = PropertySetter<T, PropertyType::Any>;
+
+    static void set(typename T::Context ctx, realm::Object &realm_object, const Property &prop, typename T::Value value) {
+        if (Base::prepare(ctx, realm_object, prop, value)) {
+            return;
+        }
+        if (!Value<T>::is_date(ctx, value)) {
+            Base::throw_type_error(realm_object, prop);
+        }
+        double milliseconds = Value<T>::to_number(ctx, Value<T>::to_date(ctx, value));
+        auto &row = realm_object.row();
+        row.get_table()->set_timestamp(prop.table_column, row.get_index(),
+                                       Timestamp(int64_t(milliseconds / 1000), int32_t(int64_t(milliseconds) % 1000 * 1000000)));
+    }
+};
+
+// Copies objects into plain JS objects for toJSON() and toPlainArray(). Links and lists are followed up to
+// `depth` levels below the copied object, and are left out below that. An object reachable along several
+// paths is copied once for each of them, so the work grows with the number of paths rather than of objects,
+// which is why only a couple of levels are followed unless asked for. A link back to an object that is
+// already being copied, further up the same path, becomes null instead of recursing forever.
+template<typename T>
+class PlainObjectBuilder {
+    using ContextType = typename T::Context;
+    using ObjectType = typename T::Object;
+    using ValueType = typename T::Value;
+    using Value = js::Value<T>;
+    using Object = js::Object<T>;
+
+  public:
+    static constexpr size_t default_max_depth = 2;
+
+    // `options` may be undefined, or an object with optional `properties` and `depth` members.
+    PlainObjectBuilder(ContextType ctx, const ObjectSchema &object_schema, const ValueType &options) : m_ctx(ctx) {
+        static const String<T> properties_string = "properties";
+        static const String<T> depth_string = "depth";
+
+        if (!Value::is_object(ctx, options)) {
+            // JSON.stringify() passes the property name of the object to toJSON(), which is ignored.
+            return;
+        }
+        ObjectType options_object = Value::to_object(ctx, options);
+
+        ValueType properties = Object::get_property(ctx, options_object, properties_string);
+        if (!Value::is_undefined(ctx, properties)) {
+            ObjectType names = Value::validated_to_array(ctx, properties, "properties");
+            uint32_t count = Object::validated_get_length(ctx, names);
+            m_properties.reserve(count);
+            for (uint32_t i = 0; i < count; i++) {
+                std::string name = Object::validated_get_string(ctx, names, i);
+                const Property *prop = object_schema.property_for_name(name);
+                if (!prop) {
+                    throw std::runtime_error("Property '" + name + "' does not exist on object type '" + object_schema.name + "'");
+                }
+                m_properties.push_back(prop);
+            }
+        }
+
+        ValueType depth = Object::get_property(ctx, options_object, depth_string);
+        if (!Value::is_undefined(ctx, depth)) {
+            double max_depth = Value::validated_to_number(ctx, depth, "depth");
+            if (!(max_depth >= 0)) {
+                throw std::invalid_argument("depth must be a non-negative number.");
+            }
+            m_max_depth = max_depth < double(std::numeric_limits<size_t>::max()) ? size_t(max_depth) : std::numeric_limits<size_t>::max();
+        }
+    }
+
+    ValueType build(realm::Object &realm_object) {
+        if (!realm_object.is_valid()) {
+            throw std::runtime_error(util::format("Accessing object of type %1 which has been invalidated or deleted",
+                                                  realm_object.get_object_schema().name));
+        }
+        return build(realm_object, 0);
+    }
+
+  private:
+    ContextType m_ctx;
+    // Only applies to the copied objects themselves, not to the objects they link to.
+    std::vector<const Property *> m_properties;
+    size_t m_max_depth = default_max_depth;
+    std::vector<std::pair<const Table *, size_t>> m_path;
+
+    ValueType build(realm::Object &realm_object, size_t depth) {
+        auto &row = realm_object.row();
+        std::pair<const Table *, size_t> key(row.get_table(), row.get_index());
+        if (std::find(m_path.begin(), m_path.end(), key) != m_path.end()) {
+            return Value::from_null(m_ctx);
+        }
+        m_path.push_back(key);
+
+        auto &realm = realm_object.realm();
+        auto &object_schema = realm_object.get_object_schema();
+        NativeAccessor<T> accessor(m_ctx, realm, object_schema);
+        ObjectType object = Object::create_empty(m_ctx);
+
+        auto copy_property = [&](const Property &prop) {
+            size_t column = prop.table_column;
+            switch (prop.type) {
+                case PropertyType::Object: {
+                    if (depth >= m_max_depth) {
+                        return;
+                    }
+                    if (row.is_null_link(column)) {
+                        Object::set_property(m_ctx, object, prop.name, Value::from_null(m_ctx));
+                        return;
+                    }
+                    auto &target_schema = *realm->schema().find(prop.object_type);
+                    auto table = ObjectStore::table_for_object_type(realm->read_group(), prop.object_type);
+                    realm::Object target(realm, target_schema, table->get(row.get_link(column)));
+                    Object::set_property(m_ctx, object, prop.name, build(target, depth + 1));
+                    return;
+                }
+                case PropertyType::Array: {
+                    if (depth >= m_max_depth) {
+                        return;
+                    }
+                    auto link_view = row.get_linklist(column);
+                    Object::set_property(m_ctx, object, prop.name, build_rows(realm, prop.object_type, *link_view, depth + 1));
+                    return;
+                }
+                case PropertyType::LinkingObjects: {
+                    if (depth >= m_max_depth) {
+                        return;
+                    }
+                    auto origin_schema = realm->schema().find(prop.object_type);
+                    auto link_property = origin_schema->property_for_name(prop.link_origin_property_name);
+                    auto table = ObjectStore::table_for_object_type(realm->read_group(), origin_schema->name);
+                    auto tv = row.get_table()->get_backlink_view(row.get_index(), table.get(), link_property->table_column);
+                    Object::set_property(m_ctx, object, prop.name, build_rows(realm, prop.object_type, tv, depth + 1));
+                    return;
+                }
+                default:
+                    Object::set_property(m_ctx, object, prop.name, RealmObjectClass<T>::get_property_value(accessor, realm_object, prop));
+                    return;
+            }
+        };
+
+        if (depth == 0 && !m_properties.empty()) {
+            for (auto prop : m_properties) {
+                copy_property(*prop);
+            }
+        }
+        else {
+            for (auto &prop : object_schema.persisted_properties) {
+                copy_property(prop);
+            }
+        }
+
+        m_path.pop_back();
+        return object;
+    }
+
+    // Works for both LinkView and TableView, which have the same size() and get().
+    template<typename Rows>
+    ValueType build_rows(const SharedRealm &realm, const std::string &object_type, Rows &rows, size_t depth) {
+        auto &object_schema = *realm->schema().find(object_type);
+        std::vector<ValueType> values;
+        values.reserve(rows.size());
+        for (size_t i = 0; i < rows.size(); i++) {
+            realm::Object target(realm, object_schema, rows.get(i));
+            values.push_back(build(target, depth));
+        }
+        return Object::create_array(m_ctx, values);
+    }
+};
+
 template<typename T>
 void RealmObjectClass<T>::is_valid(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     return_value.set(get_internal<T, RealmObjectClass<T>>(this_object)->is_valid());
@@ -86,7 +623,25 @@ typename T::Object RealmObjectClass<T>::create_instance(ContextType ctx, realm::
 
     auto delegate = get_delegate<T>(realm_object.realm().get());
     auto name = realm_object.get_object_schema().name;
-    auto object = create_object<T, RealmObjectClass<T>>(ctx, new realm::Object(std::move(realm_object)));
+
+    if (delegate && delegate->m_accessor_prototypes.count(name)) {
+        // The accessor prototype already inherits from the constructor prototype, if there is one.
+        auto object = Object::template create_instance_without_interceptors<RealmObjectClass<T>>(ctx, new RealmObject<T>(std::move(realm_object)));
+        Object::set_prototype(ctx, object, delegate->m_accessor_prototypes.at(name));
+
+        if (!delegate->m_constructors.count(name)) {
+            return object;
+        }
+
+        FunctionType constructor = delegate->m_constructors.at(name);
+        ValueType result = Function::call(ctx, constructor, object, 0, NULL);
+        if (result != object && !Value::is_null(ctx, result) && !Value::is_undefined(ctx, result)) {
+            throw std::runtime_error("Realm object constructor must not return another value");
+        }
+        return object;
+    }
+
+    auto object = create_object<T, RealmObjectClass<T>>(ctx, new RealmObject<T>(std::move(realm_object)));
 
     if (!delegate || !delegate->m_constructors.count(name)) {
         return object;
@@ -104,17 +659,87 @@ typename T::Object RealmObjectClass<T>::create_instance(ContextType ctx, realm::
     return object;
 }
 
+template<typename T>
+const Property *RealmObjectClass<T>::find_property(realm::Object &realm_object, const std::string &name) {
+    auto delegate = get_delegate<T>(realm_object.realm().get());
+    if (!delegate) {
+        return realm_object.get_object_schema().property_for_name(name);
+    }
+    return delegate->m_property_cache.find(realm_object.get_object_schema(), name);
+}
+
+template<typename T>
+const Property &RealmObjectClass<T>::validated_property_at(ContextType ctx, realm::Object &realm_object, const ValueType &value) {
+    auto &object_schema = realm_object.get_object_schema();
+    size_t persisted_count = object_schema.persisted_properties.size();
+    size_t index = Value::validated_to_number(ctx, value, "index");
+
+    // Indexes follow the order used by Realm._createAccessorPrototype(): persisted, then computed properties.
+    if (index < persisted_count) {
+        return object_schema.persisted_properties[index];
+    }
+    if (index - persisted_count < object_schema.computed_properties.size()) {
+        return object_schema.computed_properties[index - persisted_count];
+    }
+    throw std::out_of_range(util::format("Property index %1 is out of range for object type '%2'", index, object_schema.name));
+}
+
+template<typename T>
+typename T::Value RealmObjectClass<T>::get_property_value(NativeAccessor<T> &accessor, realm::Object &realm_object, const Property &prop) {
+    auto &object_schema = realm_object.get_object_schema();
+    if (!realm_object.is_valid()) {
+        throw std::runtime_error(util::format("Accessing object of type %1 which has been invalidated or deleted", object_schema.name));
+    }
+
+    auto &realm = realm_object.realm();
+    auto &row = realm_object.row();
+    size_t column = prop.table_column;
+
+    if (prop.is_nullable && prop.type != PropertyType::Object && row.is_null(column)) {
+        return accessor.null_value();
+    }
+
+    switch (prop.type) {
+        case PropertyType::Bool:   return accessor.box(row.get_bool(column));
+        case PropertyType::Int:    return accessor.box(row.get_int(column));
+        case PropertyType::Float:  return accessor.box(row.get_float(column));
+        case PropertyType::Double: return accessor.box(row.get_double(column));
+        case PropertyType::String: return accessor.box(row.get_string(column));
+        case PropertyType::Data:   return accessor.box(row.get_binary(column));
+        case PropertyType::Date:   return accessor.box(row.get_timestamp(column));
+        case PropertyType::Any:    return accessor.box(row.get_mixed(column));
+        case PropertyType::Object: {
+            if (row.is_null_link(column)) {
+                return accessor.null_value();
+            }
+            auto &target_schema = *realm->schema().find(prop.object_type);
+            auto table = ObjectStore::table_for_object_type(realm->read_group(), prop.object_type);
+            return accessor.box(realm::Object(realm, target_schema, table->get(row.get_link(column))));
+        }
+        case PropertyType::Array:
+            return accessor.box(realm::List(realm, row.get_linklist(column)));
+        case PropertyType::LinkingObjects: {
+            auto target_schema = realm->schema().find(prop.object_type);
+            auto link_property = target_schema->property_for_name(prop.link_origin_property_name);
+            auto table = ObjectStore::table_for_object_type(realm->read_group(), target_schema->name);
+            auto tv = row.get_table()->get_backlink_view(row.get_index(), table.get(), link_property->table_column);
+            return accessor.box(realm::Results(realm, std::move(tv)));
+        }
+    }
+    REALM_UNREACHABLE();
+}
+
 template<typename T>
 void RealmObjectClass<T>::get_property(ContextType ctx, ObjectType object, const String &property, ReturnValue &return_value) {
-    try {
-        auto realm_object = get_internal<T, RealmObjectClass<T>>(object);
-        NativeAccessor<T> accessor(ctx, realm_object->realm(), realm_object->get_object_schema());
-        std::string name = property;
-        auto result = realm_object->template get_property_value<ValueType>(accessor, name);
-        return_value.set(result);
-    } catch (InvalidPropertyException &ex) {
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(object);
+    const Property *prop = find_property(*realm_object, property);
+    if (!prop) {
         // getters for nonexistent properties in JS should always return undefined
+        return;
     }
+
+    NativeAccessor<T> accessor(ctx, realm_object->realm(), realm_object->get_object_schema());
+    return_value.set(get_property_value(accessor, *realm_object, *prop));
 }
 
 template<typename T>
@@ -122,19 +747,56 @@ bool RealmObjectClass<T>::set_property(ContextType ctx, ObjectType object, const
     auto realm_object = get_internal<T, RealmObjectClass<T>>(object);
 
     std::string property_name = property;
-    const Property* prop = realm_object->get_object_schema().property_for_name(property_name);
+    const Property* prop = find_property(*realm_object, property_name);
     if (!prop) {
         return false;
     }
 
-    if (!Value::is_valid_for_property(ctx, value, *prop)) {
-        throw TypeErrorException(util::format("%1.%2", realm_object->get_object_schema().name, property_name),
-                                 js_type_name_for_property_type(prop->type));
+    set_property_value(ctx, *realm_object, *prop, value);
+    return true;
+}
+
+template<typename T>
+void RealmObjectClass<T>::set_property_value(ContextType ctx, realm::Object &realm_object, const Property &prop, ValueType value) {
+    auto &properties = realm_object.get_object_schema().persisted_properties;
+    auto delegate = get_delegate<T>(realm_object.realm().get());
+    std::less<const Property *> before;
+
+    if (delegate && !before(&prop, properties.data()) && before(&prop, properties.data() + properties.size())) {
+        auto &setters = delegate->m_property_setters.setters_for(realm_object.get_object_schema());
+        setters[&prop - properties.data()](ctx, realm_object, prop, value);
     }
+    else {
+        PropertySetterTable<T>::setter_for_property(prop)(ctx, realm_object, prop, value);
+    }
+}
+
+template<typename T>
+void RealmObjectClass<T>::get_property_at(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1);
+
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(this_object);
+    auto &prop = validated_property_at(ctx, *realm_object, arguments[0]);
 
     NativeAccessor<T> accessor(ctx, realm_object->realm(), realm_object->get_object_schema());
-    realm_object->set_property_value(accessor, property_name, value, true);
-    return true;
+    return_value.set(get_property_value(accessor, *realm_object, prop));
+}
+
+template<typename T>
+void RealmObjectClass<T>::set_property_at(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 2);
+
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(this_object);
+    set_property_value(ctx, *realm_object, validated_property_at(ctx, *realm_object, arguments[0]), arguments[1]);
+}
+
+template<typename T>
+void RealmObjectClass<T>::to_json(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 0, 1);
+
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(this_object);
+    PlainObjectBuilder<T> builder(ctx, realm_object->get_object_schema(), argc ? arguments[0] : Value::from_undefined(ctx));
+    return_value.set(builder.build(*realm_object));
 }
 
 template<typename T>
@@ -152,6 +814,94 @@ std::vector<String<T>> RealmObjectClass<T>::get_property_names(ContextType ctx,
     return names;
 }
 
+template<typename T>
+typename T::Value RealmObjectClass<T>::create_object_change_set(ContextType ctx, const realm::Object &realm_object, const CollectionChangeSet &change_set) {
+    ObjectType object = Object::create_empty(ctx);
+    bool deleted = !change_set.deletions.empty();
+    Object::set_property(ctx, object, "deleted", Value::from_boolean(ctx, deleted));
+
+    // The change set describes a collection holding just this object, so its row is always at index 0.
+    std::vector<ValueType> changed_properties;
+    if (!deleted) {
+        for (auto &prop : realm_object.get_object_schema().persisted_properties) {
+            if (prop.table_column < change_set.columns.size() && change_set.columns[prop.table_column].contains(0)) {
+                changed_properties.push_back(Value::from_string(ctx, prop.name));
+            }
+        }
+    }
+    Object::set_property(ctx, object, "changedProperties", Object::create_array(ctx, changed_properties));
+    return object;
+}
+
+template<typename T>
+void RealmObjectClass<T>::add_listener(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1);
+
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(this_object);
+    if (!realm_object->is_valid()) {
+        throw std::runtime_error("Cannot add a listener to an object that has been deleted.");
+    }
+
+    auto callback = Value::validated_to_function(ctx, arguments[0], "callback");
+    Protected<FunctionType> protected_callback(ctx, callback);
+    if (realm_object->m_listeners.contains(protected_callback)) {
+        return;
+    }
+
+    bool first_listener = realm_object->m_listeners.empty();
+    realm_object->m_listeners.add(std::move(protected_callback), nullptr);
+    if (!first_listener) {
+        return;
+    }
+
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    RealmObject<T> *object = realm_object;
+
+    realm_object->m_notification_token = realm_object->add_notification_callback([=](CollectionChangeSet change_set, std::exception_ptr exception) {
+        // The initial notification has no changes to report.
+        if (change_set.empty()) {
+            return;
+        }
+
+        HANDLESCOPE
+
+        ValueType arguments[2];
+        arguments[0] = static_cast<ObjectType>(protected_this);
+        arguments[1] = create_object_change_set(protected_ctx, *object, change_set);
+
+        // Listeners may add or remove listeners, so call the ones present when the notification started.
+        for (auto &listener : object->m_listeners.callbacks()) {
+            Function::callback(protected_ctx, listener, protected_this, 2, arguments);
+        }
+    });
+    realm_object->m_notification_count.emplace(realm_object->realm()->config().path, LiveObjectRegistry::notification_token_kind());
+}
+
+template<typename T>
+void RealmObjectClass<T>::remove_listener(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1);
+
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(this_object);
+    auto callback = Value::validated_to_function(ctx, arguments[0], "callback");
+
+    realm_object->m_listeners.remove(Protected<FunctionType>(ctx, callback));
+    if (realm_object->m_listeners.empty()) {
+        realm_object->m_notification_token = {};
+        realm_object->m_notification_count = util::none;
+    }
+}
+
+template<typename T>
+void RealmObjectClass<T>::remove_all_listeners(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 0);
+
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(this_object);
+    realm_object->m_listeners.clear();
+    realm_object->m_notification_token = {};
+    realm_object->m_notification_count = util::none;
+}
+
 } // js
 } // realm
 
@@ -160,31 +910,49 @@ std::vector<String<T>> RealmObjectClass<T>::get_property_names(ContextType ctx,
 #include "js_results.hpp"
 
 template<typename T>
-void realm::js::RealmObjectClass<T>::linking_objects(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
-    validate_argument_count(argc, 2);
-    
+const realm::js::BacklinkCache::Backlink &realm::js::RealmObjectClass<T>::validated_backlink(ContextType ctx, realm::Object &realm_object, const ValueType arguments[], BacklinkCache::Backlink &uncached) {
     std::string object_type = Value::validated_to_string(ctx, arguments[0], "objectType");
     std::string property_name = Value::validated_to_string(ctx, arguments[1], "property");
-    
-    auto object = get_internal<T, RealmObjectClass<T>>(this_object);
-    
-    auto target_object_schema = object->realm()->schema().find(object_type);
-    if (target_object_schema == object->realm()->schema().end()) {
-        throw std::logic_error(util::format("Could not find schema for type '%1'", object_type));
-    }
-    
-    auto link_property = target_object_schema->property_for_name(property_name);
-    if (!link_property) {
-        throw std::logic_error(util::format("Type '%1' does not contain property '%2'", object_type, property_name));
+
+    if (!realm_object.is_valid()) {
+        throw std::runtime_error(util::format("Accessing object of type %1 which has been invalidated or deleted",
+                                              realm_object.get_object_schema().name));
     }
-    
-    if (link_property->object_type != object->get_object_schema().name) {
-        throw std::logic_error(util::format("'%1.%2' is not a relationship to '%3'", object_type, property_name, object->get_object_schema().name));
+
+    auto &realm = *realm_object.realm();
+    auto delegate = get_delegate<T>(&realm);
+    if (!delegate) {
+        uncached = BacklinkCache::resolve(realm, realm_object.get_object_schema(), object_type, property_name);
+        return uncached;
     }
-    
-    realm::TableRef table = ObjectStore::table_for_object_type(object->realm()->read_group(), target_object_schema->name);
+    return delegate->m_backlink_cache.find(realm, realm_object.get_object_schema(), object_type, property_name);
+}
+
+template<typename T>
+void realm::js::RealmObjectClass<T>::linking_objects(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 2);
+
+    auto object = get_internal<T, RealmObjectClass<T>>(this_object);
+    BacklinkCache::Backlink uncached;
+    auto &backlink = validated_backlink(ctx, *object, arguments, uncached);
+
     auto row = object->row();
-    auto tv = row.get_table()->get_backlink_view(row.get_index(), table.get(), link_property->table_column);
-    
+    auto origin_table = backlink.origin_table(*object->realm());
+    auto tv = row.get_table()->get_backlink_view(row.get_index(), origin_table.get(), backlink.origin_column);
+
     return_value.set(ResultsClass<T>::create_instance(ctx, realm::Results(object->realm(), std::move(tv))));
 }
+
+template<typename T>
+void realm::js::RealmObjectClass<T>::linking_objects_count(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 2);
+
+    auto object = get_internal<T, RealmObjectClass<T>>(this_object);
+    BacklinkCache::Backlink uncached;
+    auto &backlink = validated_backlink(ctx, *object, arguments, uncached);
+
+    // Reads the number of backlinks kept with the row instead of building a view of them.
+    auto row = object->row();
+    auto origin_table = backlink.origin_table(*object->realm());
+    return_value.set((uint32_t)row.get_table()->get_backlink_count(row.get_index(), *origin_table, backlink.origin_column));
+}
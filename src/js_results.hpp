@@ -18,14 +18,30 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+
 #include "js_collection.hpp"
 #include "js_realm_object.hpp"
+#include "event_loop_dispatcher.hpp"
 
 #include "results.hpp"
 #include "list.hpp"
 #include "object_store.hpp"
 #include "parser.hpp"
 #include "query_builder.hpp"
+#include "thread_safe_reference.hpp"
+
+#include "base64.hpp"
+
+#include <realm/query_expression.hpp>
 
 namespace realm {
 namespace js {
@@ -33,6 +49,587 @@ namespace js {
 template<typename>
 class NativeAccessor;
 
+// Keeps the parsed form of recently used predicate strings, so that filtering repeatedly with the
+// same predicate and different arguments only parses it once. A predicate doesn't depend on the
+// schema until it is applied to a query, so entries never go stale; the cache is simply emptied
+// once it's full, which keeps a stream of distinct predicates from growing it without bound.
+class PredicateCache {
+    static constexpr size_t capacity = 64;
+
+    std::unordered_map<std::string, parser::Predicate> m_predicates;
+
+  public:
+    const parser::Predicate &get(const std::string &query_string) {
+        auto it = m_predicates.find(query_string);
+        if (it != m_predicates.end()) {
+            return it->second;
+        }
+
+        parser::Predicate predicate = parser::parse(query_string);
+        if (m_predicates.size() >= capacity) {
+            m_predicates.clear();
+        }
+        return m_predicates.emplace(query_string, std::move(predicate)).first->second;
+    }
+
+    void clear() {
+        m_predicates.clear();
+    }
+};
+
+// A token index over a string column: every word in the column, lowercased, with the rows it occurs in.
+// Words are runs of ASCII letters and digits and of the bytes of non-ASCII characters. It is used to narrow
+// down a CONTAINS query to the rows that can match before the query itself runs on them, and is built for
+// one version of the table.
+class TextIndex {
+  public:
+    TextIndex(const Table &table, size_t column) : m_version(table.get_version_counter()) {
+        size_t size = table.size();
+        for (size_t row = 0; row < size; row++) {
+            StringData value = table.get_string(column, row);
+            if (value.is_null()) {
+                continue;
+            }
+            for_each_word(std::string(value.data(), value.size()), [&](std::string word, bool, bool) {
+                auto &rows = m_rows[std::move(word)];
+                if (rows.empty() || rows.back() != row) {
+                    rows.push_back(row);
+                }
+            });
+        }
+    }
+
+    uint_fast64_t version() const {
+        return m_version;
+    }
+
+    // Sets `rows` to the rows, in order, whose value could contain `term` (case-insensitively), which includes all
+    // the ones that do. Returns false if the index can't tell, e.g. if the term has no word in it or has
+    // non-ASCII characters, whose case is folded differently by queries.
+    bool find_candidates(const std::string &term, std::vector<size_t> &rows) const {
+        if (std::any_of(term.begin(), term.end(), [](char c) { return static_cast<unsigned char>(c) >= 0x80; })) {
+            return false;
+        }
+
+        // The longest word narrows it down the most. Its ends are only word boundaries in the value if they
+        // are in the term.
+        std::string longest;
+        bool starts_word = false, ends_word = false;
+        for_each_word(term, [&](std::string word, bool at_start, bool at_end) {
+            if (word.size() > longest.size()) {
+                longest = std::move(word);
+                starts_word = !at_start;
+                ends_word = !at_end;
+            }
+        });
+        if (longest.empty()) {
+            return false;
+        }
+
+        rows.clear();
+        if (starts_word && ends_word) {
+            auto it = m_rows.find(longest);
+            if (it != m_rows.end()) {
+                rows = it->second;
+            }
+            return true;
+        }
+
+        for (auto &entry : m_rows) {
+            const std::string &word = entry.first;
+            bool matches;
+            if (starts_word) {
+                matches = word.compare(0, longest.size(), longest) == 0;
+            }
+            else if (ends_word) {
+                matches = word.size() >= longest.size() && word.compare(word.size() - longest.size(), longest.size(), longest) == 0;
+            }
+            else {
+                matches = word.find(longest) != std::string::npos;
+            }
+            if (matches) {
+                rows.insert(rows.end(), entry.second.begin(), entry.second.end());
+            }
+        }
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+        return true;
+    }
+
+  private:
+    uint_fast64_t m_version;
+    std::unordered_map<std::string, std::vector<size_t>> m_rows;
+
+    static bool is_word_character(char c) {
+        return static_cast<unsigned char>(c) >= 0x80 || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    // Calls `callback(word, at_start, at_end)` for every lowercased word, with whether it is at the start
+    // or end of the text.
+    template<typename Callback>
+    static void for_each_word(const std::string &text, Callback &&callback) {
+        size_t size = text.size();
+        size_t i = 0;
+        while (i < size) {
+            while (i < size && !is_word_character(text[i])) {
+                i++;
+            }
+            size_t begin = i;
+            while (i < size && is_word_character(text[i])) {
+                i++;
+            }
+            if (i > begin) {
+                std::string word = text.substr(begin, i - begin);
+                std::transform(word.begin(), word.end(), word.begin(), [](char c) {
+                    return c >= 'A' && c <= 'Z' ? char(c - 'A' + 'a') : c;
+                });
+                callback(std::move(word), begin == 0, i == size);
+            }
+        }
+    }
+};
+
+// The text indexes of the full-text properties that have been queried, kept until their table changes and
+// dropped when the schema changes. Building an index reads the whole column, which costs more than the scan
+// it saves a single query, so once the table has changed the index is only rebuilt by the second query in a
+// row that sees the same version of it. Until then, or if the table changes between every query, the
+// queries scan the table without an index. Returns null when there is no index to use.
+class TextIndexCache {
+    static constexpr size_t rebuild_after_queries = 2;
+
+  public:
+    std::shared_ptr<const TextIndex> get(const Table &table, const std::string &object_type, size_t column) {
+        auto &entry = m_entries[std::make_pair(object_type, column)];
+        auto version = table.get_version_counter();
+        if (entry.index && entry.index->version() == version) {
+            return entry.index;
+        }
+
+        // The index of an older version is of no use, and would only hold on to its rows.
+        entry.index = nullptr;
+        if (entry.queried_version != version) {
+            entry.queried_version = version;
+            entry.queries = 0;
+        }
+        if (++entry.queries < rebuild_after_queries && entry.built) {
+            return nullptr;
+        }
+        entry.index = std::make_shared<const TextIndex>(table, column);
+        entry.built = true;
+        return entry.index;
+    }
+
+    void clear() {
+        m_entries.clear();
+    }
+
+  private:
+    struct Entry {
+        std::shared_ptr<const TextIndex> index;
+        bool built = false;
+        uint_fast64_t queried_version = 0;
+        size_t queries = 0;
+    };
+
+    std::map<std::pair<std::string, size_t>, Entry> m_entries;
+};
+
+// A query node that only matches the candidate rows a TextIndex found, so that the rest of the query only
+// runs on those. The rows are only known for the table accessor and version they were found on; anywhere
+// else, such as once the query has been handed over to the notifier's thread or after the table has changed,
+// every row is let through and the query's own conditions decide as usual.
+class TextIndexCandidates : public realm::Expression {
+  public:
+    TextIndexCandidates(const Table *table, uint_fast64_t version, std::shared_ptr<const std::vector<size_t>> rows)
+    : m_table(table), m_version(version), m_rows(std::move(rows)) {}
+
+    size_t find_first(size_t start, size_t end) const override {
+        if (start >= end) {
+            return realm::not_found;
+        }
+        if (!m_rows || m_table->get_version_counter() != m_version) {
+            return start;
+        }
+        auto it = std::lower_bound(m_rows->begin(), m_rows->end(), start);
+        return it != m_rows->end() && *it < end ? *it : realm::not_found;
+    }
+
+    void set_base_table(const Table *table) override {
+        if (table != m_table) {
+            m_table = table;
+            m_rows = nullptr;
+        }
+    }
+
+    const Table *get_base_table() const override {
+        return m_table;
+    }
+
+    std::unique_ptr<realm::Expression> clone(QueryNodeHandoverPatches *patches) const override {
+        // A copy made for handing the query over belongs to another table accessor.
+        auto copy = std::unique_ptr<TextIndexCandidates>(new TextIndexCandidates(m_table, m_version, patches ? nullptr : m_rows));
+        return std::move(copy);
+    }
+
+  private:
+    const Table *m_table;
+    uint_fast64_t m_version;
+    std::shared_ptr<const std::vector<size_t>> m_rows;
+};
+
+// Streams rows to a file as newline-delimited JSON, one object per line, or as CSV with a header line.
+// Output is collected in a bounded buffer that is written out whenever it fills up, so memory use
+// doesn't grow with the number of rows. Dates are written as ISO 8601 strings and binary data as
+// base64. Links are written as the primary key of the linked object, and lists as an array of them;
+// objects without a primary key are written as null.
+class RowExporter {
+    static constexpr size_t buffer_capacity = 64 * 1024;
+
+  public:
+    enum class Format { JSON, CSV };
+
+    RowExporter(const std::string &path, Format format, realm::Realm &realm, const ObjectSchema &object_schema,
+                const std::vector<std::string> &property_names)
+    : m_file(path, std::ios::out | std::ios::trunc | std::ios::binary), m_format(format) {
+        if (!m_file) {
+            throw std::runtime_error(util::format("Cannot open '%1' for writing.", path));
+        }
+        for (auto &name : property_names) {
+            const Property *prop = object_schema.property_for_name(name);
+            if (!prop || prop->type == PropertyType::LinkingObjects) {
+                throw std::invalid_argument(util::format("Property '%1' cannot be exported.", name));
+            }
+            Column column = {prop, {}, nullptr};
+            if (prop->type == PropertyType::Object || prop->type == PropertyType::Array) {
+                auto &target_schema = *realm.schema().find(prop->object_type);
+                column.target_table = ObjectStore::table_for_object_type(realm.read_group(), target_schema.name);
+                column.target_primary_key = target_schema.primary_key_property();
+            }
+            m_columns.push_back(column);
+        }
+        m_buffer.reserve(buffer_capacity + 1024);
+    }
+
+    void write_header() {
+        if (m_format != Format::CSV) {
+            return;
+        }
+        for (size_t i = 0; i < m_columns.size(); i++) {
+            if (i) {
+                m_buffer += ',';
+            }
+            append_csv_string(m_columns[i].property->name);
+        }
+        end_line();
+    }
+
+    void write_row(RowExpr row) {
+        if (m_format == Format::JSON) {
+            m_buffer += '{';
+        }
+        for (size_t i = 0; i < m_columns.size(); i++) {
+            if (i) {
+                m_buffer += ',';
+            }
+            if (m_format == Format::JSON) {
+                append_json_string(m_columns[i].property->name);
+                m_buffer += ':';
+            }
+            append_value(row, m_columns[i]);
+        }
+        if (m_format == Format::JSON) {
+            m_buffer += '}';
+        }
+        end_line();
+    }
+
+    void finish() {
+        flush();
+        m_file.close();
+        if (m_file.fail()) {
+            throw std::runtime_error("Failed to write the exported rows.");
+        }
+    }
+
+  private:
+    struct Column {
+        const Property *property;
+        ConstTableRef target_table;
+        const Property *target_primary_key;
+    };
+
+    std::ofstream m_file;
+    Format m_format;
+    std::vector<Column> m_columns;
+    std::string m_buffer;
+    std::string m_scratch;
+
+    void end_line() {
+        m_buffer += '\n';
+        if (m_buffer.size() >= buffer_capacity) {
+            flush();
+        }
+    }
+
+    void flush() {
+        m_file.write(m_buffer.data(), m_buffer.size());
+        if (m_file.fail()) {
+            throw std::runtime_error("Failed to write the exported rows.");
+        }
+        m_buffer.clear();
+    }
+
+    void append_null() {
+        if (m_format == Format::JSON) {
+            m_buffer += "null";
+        }
+    }
+
+    void append_json_string(StringData string) {
+        static const char hex[] = "0123456789abcdef";
+        m_buffer += '"';
+        for (size_t i = 0; i < string.size(); i++) {
+            char c = string[i];
+            switch (c) {
+                case '"':  m_buffer += "\\\""; break;
+                case '\\': m_buffer += "\\\\"; break;
+                case '\n': m_buffer += "\\n"; break;
+                case '\r': m_buffer += "\\r"; break;
+                case '\t': m_buffer += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        m_buffer += "\\u00";
+                        m_buffer += hex[(c >> 4) & 0xf];
+                        m_buffer += hex[c & 0xf];
+                    }
+                    else {
+                        m_buffer += c;
+                    }
+            }
+        }
+        m_buffer += '"';
+    }
+
+    void append_csv_string(StringData string) {
+        bool needs_quotes = false;
+        for (size_t i = 0; i < string.size() && !needs_quotes; i++) {
+            char c = string[i];
+            needs_quotes = c == '"' || c == ',' || c == '\n' || c == '\r';
+        }
+        if (!needs_quotes) {
+            m_buffer.append(string.data(), string.size());
+            return;
+        }
+        m_buffer += '"';
+        for (size_t i = 0; i < string.size(); i++) {
+            if (string[i] == '"') {
+                m_buffer += '"';
+            }
+            m_buffer += string[i];
+        }
+        m_buffer += '"';
+    }
+
+    void append_string(StringData string) {
+        if (m_format == Format::JSON) {
+            append_json_string(string);
+        }
+        else {
+            append_csv_string(string);
+        }
+    }
+
+    void append_number(double number, const char *format) {
+        if (std::isnan(number) || std::isinf(number)) {
+            append_null();
+            return;
+        }
+        char buffer[32];
+        int length = snprintf(buffer, sizeof(buffer), format, number);
+        m_buffer.append(buffer, length);
+    }
+
+    void append_timestamp(Timestamp timestamp) {
+        // Days since the epoch in the proleptic Gregorian calendar, converted to a civil date.
+        int64_t milliseconds = timestamp.get_seconds() * 1000 + timestamp.get_nanoseconds() / 1000000;
+        int64_t days = milliseconds / 86400000 - (milliseconds % 86400000 < 0 ? 1 : 0);
+        int64_t time = milliseconds - days * 86400000;
+
+        int64_t z = days + 719468;
+        int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+        int64_t day_of_era = z - era * 146097;
+        int64_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+        int64_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+        int64_t mp = (5 * day_of_year + 2) / 153;
+        int64_t day = day_of_year - (153 * mp + 2) / 5 + 1;
+        int64_t month = mp < 10 ? mp + 3 : mp - 9;
+        int64_t year = year_of_era + era * 400 + (month <= 2 ? 1 : 0);
+
+        char buffer[48];
+        snprintf(buffer, sizeof(buffer), "%04lld-%02lld-%02lldT%02lld:%02lld:%02lld.%03lldZ",
+                 (long long)year, (long long)month, (long long)day, (long long)(time / 3600000),
+                 (long long)(time / 60000 % 60), (long long)(time / 1000 % 60), (long long)(time % 1000));
+        append_string(buffer);
+    }
+
+    void append_primary_key(const Column &column, size_t target_row) {
+        if (!column.target_primary_key) {
+            append_null();
+            return;
+        }
+        auto row = column.target_table->get(target_row);
+        size_t key_column = column.target_primary_key->table_column;
+        if (column.target_primary_key->is_nullable && row.is_null(key_column)) {
+            append_null();
+        }
+        else if (column.target_primary_key->type == PropertyType::String) {
+            append_string(row.get_string(key_column));
+        }
+        else {
+            m_buffer += util::to_string(row.get_int(key_column));
+        }
+    }
+
+    void append_value(RowExpr row, const Column &column) {
+        const Property &prop = *column.property;
+        size_t col = prop.table_column;
+        if (prop.is_nullable && prop.type != PropertyType::Object && row.is_null(col)) {
+            append_null();
+            return;
+        }
+
+        switch (prop.type) {
+            case PropertyType::Bool:
+                m_buffer += row.get_bool(col) ? "true" : "false";
+                break;
+            case PropertyType::Int:
+                m_buffer += util::to_string(row.get_int(col));
+                break;
+            case PropertyType::Float:
+                append_number(row.get_float(col), "%.9g");
+                break;
+            case PropertyType::Double:
+                append_number(row.get_double(col), "%.17g");
+                break;
+            case PropertyType::String:
+                append_string(row.get_string(col));
+                break;
+            case PropertyType::Data: {
+                BinaryData data = row.get_binary(col);
+                append_string(base64_encode(reinterpret_cast<const unsigned char *>(data.data()), data.size()));
+                break;
+            }
+            case PropertyType::Date:
+                append_timestamp(row.get_timestamp(col));
+                break;
+            case PropertyType::Object:
+                if (row.is_null_link(col)) {
+                    append_null();
+                }
+                else {
+                    append_primary_key(column, row.get_link(col));
+                }
+                break;
+            case PropertyType::Array: {
+                // In CSV the whole array goes into a single cell, written as JSON.
+                bool csv = m_format == Format::CSV;
+                if (csv) {
+                    m_scratch.clear();
+                    std::swap(m_scratch, m_buffer);
+                    m_format = Format::JSON;
+                }
+                auto link_view = row.get_linklist(col);
+                m_buffer += '[';
+                for (size_t i = 0; i < link_view->size(); i++) {
+                    if (i) {
+                        m_buffer += ',';
+                    }
+                    append_primary_key(column, link_view->get(i).get_index());
+                }
+                m_buffer += ']';
+                if (csv) {
+                    std::swap(m_scratch, m_buffer);
+                    m_format = Format::CSV;
+                    append_csv_string(m_scratch);
+                }
+                break;
+            }
+            default:
+                append_null();
+        }
+    }
+};
+
+// Holds on to the object wrappers most recently handed out by a collection, so reading the same
+// index again returns the same JS object rather than allocating a new one. It is direct-mapped:
+// each index has one slot, and every hit is checked against the row it should refer to, so entries
+// made stale by changes to the collection are simply replaced and never need to be invalidated
+// explicitly. JavaScriptCore has no weak references in its C API, so the wrappers in the slots are
+// kept alive along with the collection.
+template<typename T>
+class ObjectWrapperCache {
+    using ContextType = typename T::Context;
+    using ObjectType = typename T::Object;
+
+    static constexpr size_t capacity = 256;
+
+    // Only allocated once the collection is first read by index.
+    std::vector<util::Optional<Protected<ObjectType>>> m_objects;
+
+  public:
+    ObjectType get(ContextType ctx, size_t index, const SharedRealm &realm, const ObjectSchema &object_schema, RowExpr row) {
+        if (m_objects.empty()) {
+            m_objects.resize(capacity);
+        }
+        auto &slot = m_objects[index % capacity];
+
+        if (slot) {
+            ObjectType object = *slot;
+            auto realm_object = get_internal<T, RealmObjectClass<T>>(object);
+            if (realm_object->is_valid() && realm_object->realm() == realm
+                    && &realm_object->get_object_schema() == &object_schema
+                    && realm_object->row().get_table() == row.get_table()
+                    && realm_object->row().get_index() == row.get_index()) {
+                return object;
+            }
+        }
+
+        ObjectType object = RealmObjectClass<T>::create_instance(ctx, realm::Object(realm, object_schema, row));
+        slot.emplace(ctx, object);
+        return object;
+    }
+};
+
+// The aggregates that can be computed over a property of the objects in a collection.
+enum class AggregateFunction {
+    Count,
+    Min,
+    Max,
+    Sum,
+    Avg,
+};
+
+static inline const char *name_for_aggregate_function(AggregateFunction function) {
+    switch (function) {
+        case AggregateFunction::Count: return "count";
+        case AggregateFunction::Min: return "min";
+        case AggregateFunction::Max: return "max";
+        case AggregateFunction::Sum: return "sum";
+        case AggregateFunction::Avg: return "avg";
+    }
+    REALM_UNREACHABLE();
+}
+
+static inline AggregateFunction aggregate_function_for_name(const std::string &name) {
+    for (auto function : {AggregateFunction::Count, AggregateFunction::Min, AggregateFunction::Max,
+                          AggregateFunction::Sum, AggregateFunction::Avg}) {
+        if (name == name_for_aggregate_function(function)) {
+            return function;
+        }
+    }
+    throw std::invalid_argument("Unknown aggregate function '" + name + "'");
+}
+
 template<typename T>
 class Results : public realm::Results {
   public:
@@ -44,7 +641,13 @@ class Results : public realm::Results {
 
     using realm::Results::Results;
 
-    std::vector<std::pair<Protected<typename T::Function>, NotificationToken>> m_notification_tokens;
+    CallbackRegistry<T, CountedNotificationToken> m_notification_tokens;
+    ObjectWrapperCache<T> m_object_cache;
+    PositionIndex m_position_index;
+    CountCache m_count_cache;
+
+  private:
+    LiveObjectCounter m_live_count {get_realm() ? get_realm()->config().path : std::string(), "Realm.Results"};
 };
 
 template<typename T>
@@ -60,12 +663,36 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
     static ObjectType create_instance(ContextType, realm::Results);
     static ObjectType create_instance(ContextType, SharedRealm, const std::string &object_type);
 
+    template<typename U>
+    static realm::Results filter_collection(ContextType, const U &, size_t, const ValueType[]);
+
+    static bool find_text_index_term(ContextType, const parser::Predicate &, const std::set<std::string> &, size_t, const ValueType[], std::string &, std::string &);
+
     template<typename U>
     static ObjectType create_filtered(ContextType, const U &, size_t, const ValueType[]);
 
     template<typename U>
     static ObjectType create_sorted(ContextType, const U &, size_t, const ValueType[]);
 
+    template<typename U>
+    static ObjectType create_columns(ContextType, U &, size_t, const ValueType[]);
+
+    template<typename U>
+    static ObjectType create_groups(ContextType, U &, size_t, const ValueType[]);
+
+    template<typename U>
+    static ObjectType create_slice(ContextType, U &, size_t, const ValueType[]);
+
+    template<typename U>
+    static ObjectType create_chunk(ContextType, U &, size_t, const ValueType[]);
+
+    template<typename U>
+    static ObjectType create_plain_array(ContextType, U &, size_t, const ValueType[]);
+
+    static std::pair<size_t, size_t> validated_slice_bounds(ContextType, size_t size, size_t argc, const ValueType[]);
+
+    static ValueType compute_aggregate(ContextType, realm::Results &, AggregateFunction, const ValueType &);
+
     static void get_length(ContextType, ObjectType, ReturnValue &);
     static void get_index(ContextType, ObjectType, uint32_t, ReturnValue &);
 
@@ -75,6 +702,17 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
     static void is_valid(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
 
     static void index_of(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void to_columns(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+
+    template<AggregateFunction>
+    static void aggregate(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void group_by(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void slice(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void get_chunk(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void to_plain_array(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void count(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void is_empty(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void export_to(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     
     // observable
     static void add_listener(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
@@ -92,6 +730,19 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
         {"removeListener", wrap<remove_listener>},
         {"removeAllListeners", wrap<remove_all_listeners>},
         {"indexOf", wrap<index_of>},
+        {"toColumns", wrap<to_columns>},
+        {"min", wrap<aggregate<AggregateFunction::Min>>},
+        {"max", wrap<aggregate<AggregateFunction::Max>>},
+        {"sum", wrap<aggregate<AggregateFunction::Sum>>},
+        {"avg", wrap<aggregate<AggregateFunction::Avg>>},
+        {"groupBy", wrap<group_by>},
+        {"slice", wrap<slice>},
+        {"toArray", wrap<slice>},
+        {"_getChunk", wrap<get_chunk>},
+        {"toPlainArray", wrap<to_plain_array>},
+        {"count", wrap<count>},
+        {"isEmpty", wrap<is_empty>},
+        {"_exportTo", wrap<export_to>},
     };
     
     PropertyMap<T> const properties = {
@@ -117,18 +768,89 @@ typename T::Object ResultsClass<T>::create_instance(ContextType ctx, SharedRealm
 
 template<typename T>
 template<typename U>
-typename T::Object ResultsClass<T>::create_filtered(ContextType ctx, const U &collection, size_t argc, const ValueType arguments[]) {
+realm::Results ResultsClass<T>::filter_collection(ContextType ctx, const U &collection, size_t argc, const ValueType arguments[]) {
     auto query_string = Value::validated_to_string(ctx, arguments[0], "predicate");
     auto query = collection.get_query();
     auto const &realm = collection.get_realm();
     auto const &object_schema = collection.get_object_schema();
 
-    parser::Predicate predicate = parser::parse(query_string);
     NativeAccessor<T> accessor(ctx, realm, object_schema);
     query_builder::ArgumentConverter<ValueType, NativeAccessor<T>> converter(accessor, &arguments[1], argc - 1);
-    query_builder::apply_predicate(query, predicate, converter, realm->schema(), object_schema.name);
 
-    return create_instance(ctx, collection.filter(std::move(query)));
+    if (auto delegate = get_delegate<T>(realm.get())) {
+        auto &predicate = delegate->m_predicate_cache.get(query_string);
+        query_builder::apply_predicate(query, predicate, converter, realm->schema(), object_schema.name);
+
+        // Narrow the query down to the rows a full-text index finds for one of its CONTAINS conditions.
+        auto text_indexes = delegate->m_text_indexes.find(object_schema.name);
+        std::string property_name, term;
+        if (text_indexes != delegate->m_text_indexes.end() &&
+            find_text_index_term(ctx, predicate, text_indexes->second, argc, arguments, property_name, term)) {
+            auto table = ObjectStore::table_for_object_type(realm->read_group(), object_schema.name);
+            size_t column = object_schema.property_for_name(property_name)->table_column;
+            auto index = delegate->m_text_index_cache.get(*table, object_schema.name, column);
+
+            auto rows = std::make_shared<std::vector<size_t>>();
+            if (index && index->find_candidates(term, *rows)) {
+                query.and_query(Query(std::unique_ptr<realm::Expression>(new TextIndexCandidates(table.get(), index->version(), std::move(rows)))));
+            }
+        }
+    }
+    else {
+        parser::Predicate predicate = parser::parse(query_string);
+        query_builder::apply_predicate(query, predicate, converter, realm->schema(), object_schema.name);
+    }
+
+    return collection.filter(std::move(query));
+}
+
+// Finds a CONTAINS condition on a full-text property that every match of the predicate has to meet, i.e. one
+// that isn't negated or under an OR, and gets the property and the string it looks for.
+template<typename T>
+bool ResultsClass<T>::find_text_index_term(ContextType ctx, const parser::Predicate &predicate, const std::set<std::string> &properties,
+                                           size_t argc, const ValueType arguments[], std::string &property_name, std::string &term) {
+    if (predicate.negate) {
+        return false;
+    }
+    if (predicate.type == parser::Predicate::Type::And) {
+        for (auto &sub_predicate : predicate.cpnd.sub_predicates) {
+            if (find_text_index_term(ctx, sub_predicate, properties, argc, arguments, property_name, term)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    if (predicate.type != parser::Predicate::Type::Comparison || predicate.cmpr.op != parser::Predicate::Operator::Contains) {
+        return false;
+    }
+
+    auto &key_path = predicate.cmpr.expr[0];
+    auto &value = predicate.cmpr.expr[1];
+    if (key_path.type != parser::Expression::Type::KeyPath || !properties.count(key_path.s)) {
+        return false;
+    }
+    if (value.type == parser::Expression::Type::Argument) {
+        size_t index = std::stoul(value.s);
+        if (index + 1 >= argc || !Value::is_string(ctx, arguments[index + 1])) {
+            return false;
+        }
+        term = Value::to_string(ctx, arguments[index + 1]);
+    }
+    else if (value.type == parser::Expression::Type::String && value.s.find('\\') == std::string::npos) {
+        // Escaped strings are left to the query, which unescapes them.
+        term = value.s;
+    }
+    else {
+        return false;
+    }
+    property_name = key_path.s;
+    return true;
+}
+
+template<typename T>
+template<typename U>
+typename T::Object ResultsClass<T>::create_filtered(ContextType ctx, const U &collection, size_t argc, const ValueType arguments[]) {
+    return create_instance(ctx, filter_collection(ctx, collection, argc, arguments));
 }
 
 template<typename T>
@@ -189,12 +911,492 @@ typename T::Object ResultsClass<T>::create_sorted(ContextType ctx, const U &coll
     return create_instance(ctx, collection.sort({*table, std::move(columns), std::move(ascending)}));
 }
 
+template<typename T>
+template<typename U>
+typename T::Object ResultsClass<T>::create_columns(ContextType ctx, U &collection, size_t argc, const ValueType arguments[]) {
+    auto const &object_schema = collection.get_object_schema();
+    ObjectType js_prop_names = Value::validated_to_array(ctx, arguments[0], "properties");
+    uint32_t prop_count = Object::validated_get_length(ctx, js_prop_names);
+
+    std::vector<const Property *> props;
+    props.reserve(prop_count);
+
+    for (uint32_t i = 0; i < prop_count; i++) {
+        std::string prop_name = Object::validated_get_string(ctx, js_prop_names, i);
+        const Property *prop = object_schema.property_for_name(prop_name);
+        if (!prop) {
+            throw std::runtime_error("Property '" + prop_name + "' does not exist on object type '" + object_schema.name + "'");
+        }
+
+        switch (prop->type) {
+            case PropertyType::Bool:
+            case PropertyType::Int:
+            case PropertyType::Float:
+            case PropertyType::Double:
+            case PropertyType::String:
+            case PropertyType::Date:
+                break;
+            default:
+                throw std::runtime_error("Property '" + prop_name + "' of type '" + string_for_property_type(prop->type) + "' cannot be read as a column");
+        }
+        props.push_back(prop);
+    }
+
+    // Numeric and date columns are collected as doubles and returned as Float64Arrays (with NaN for null),
+    // while bool and string columns become plain arrays.
+    size_t count = collection.size();
+    std::vector<std::vector<double>> numbers(prop_count);
+    std::vector<std::vector<ValueType>> values(prop_count);
+
+    for (uint32_t i = 0; i < prop_count; i++) {
+        if (props[i]->type == PropertyType::Bool || props[i]->type == PropertyType::String) {
+            values[i].reserve(count);
+        }
+        else {
+            numbers[i].reserve(count);
+        }
+    }
+
+    for (size_t row_index = 0; row_index < count; row_index++) {
+        auto row = collection.get(row_index);
+
+        for (uint32_t i = 0; i < prop_count; i++) {
+            const Property &prop = *props[i];
+            size_t column = prop.table_column;
+            bool is_null = !row.is_attached() || (prop.is_nullable && row.is_null(column));
+
+            switch (prop.type) {
+                case PropertyType::Bool:
+                    values[i].push_back(is_null ? Value::from_null(ctx) : Value::from_boolean(ctx, row.get_bool(column)));
+                    break;
+                case PropertyType::String:
+                    values[i].push_back(is_null ? Value::from_null(ctx) : Value::from_string(ctx, std::string(row.get_string(column))));
+                    break;
+                case PropertyType::Int:
+                    numbers[i].push_back(is_null ? NAN : row.get_int(column));
+                    break;
+                case PropertyType::Float:
+                    numbers[i].push_back(is_null ? NAN : row.get_float(column));
+                    break;
+                case PropertyType::Double:
+                    numbers[i].push_back(is_null ? NAN : row.get_double(column));
+                    break;
+                case PropertyType::Date: {
+                    if (is_null) {
+                        numbers[i].push_back(NAN);
+                        break;
+                    }
+                    Timestamp ts = row.get_timestamp(column);
+                    numbers[i].push_back(ts.get_seconds() * 1000.0 + ts.get_nanoseconds() / 1000000);
+                    break;
+                }
+                default:
+                    REALM_UNREACHABLE();
+            }
+        }
+    }
+
+    ObjectType columns = Object::create_empty(ctx);
+    for (uint32_t i = 0; i < prop_count; i++) {
+        if (props[i]->type == PropertyType::Bool || props[i]->type == PropertyType::String) {
+            Object::set_property(ctx, columns, props[i]->name, Object::create_array(ctx, values[i]));
+        }
+        else {
+            Object::set_property(ctx, columns, props[i]->name, CollectionClass<T>::create_typed_array(ctx, numbers[i]));
+        }
+    }
+    return columns;
+}
+
+template<typename T>
+typename T::Value ResultsClass<T>::compute_aggregate(ContextType ctx, realm::Results &results, AggregateFunction function, const ValueType &property) {
+    auto const &object_schema = results.get_object_schema();
+    std::string prop_name = Value::validated_to_string(ctx, property, "property");
+    const Property *prop = object_schema.property_for_name(prop_name);
+    if (!prop) {
+        throw std::runtime_error("Property '" + prop_name + "' does not exist on object type '" + object_schema.name + "'");
+    }
+
+    bool is_numeric = prop->type == PropertyType::Int || prop->type == PropertyType::Float || prop->type == PropertyType::Double;
+    bool is_ordered = is_numeric || prop->type == PropertyType::Date;
+    if (!(function == AggregateFunction::Min || function == AggregateFunction::Max ? is_ordered : is_numeric)) {
+        throw std::runtime_error(util::format("Cannot compute %1 of property '%2' of type '%3'", name_for_aggregate_function(function),
+                                              prop_name, string_for_property_type(prop->type)));
+    }
+
+    // These run over the column in core, which scans whole leaves at a time when the results aren't sorted or filtered.
+    size_t column = prop->table_column;
+    util::Optional<Mixed> result;
+    switch (function) {
+        case AggregateFunction::Min:
+            result = results.min(column);
+            break;
+        case AggregateFunction::Max:
+            result = results.max(column);
+            break;
+        case AggregateFunction::Sum:
+            result = results.sum(column);
+            break;
+        case AggregateFunction::Avg: {
+            auto average = results.average(column);
+            return average ? Value::from_number(ctx, *average) : Value::from_undefined(ctx);
+        }
+        default:
+            REALM_UNREACHABLE();
+    }
+
+    if (!result) {
+        return Value::from_undefined(ctx);
+    }
+    switch (result->get_type()) {
+        case type_Int:
+            return Value::from_number(ctx, result->get_int());
+        case type_Float:
+            return Value::from_number(ctx, result->get_float());
+        case type_Double:
+            return Value::from_number(ctx, result->get_double());
+        case type_Timestamp: {
+            Timestamp ts = result->get_timestamp();
+            return Object::create_date(ctx, ts.get_seconds() * 1000.0 + ts.get_nanoseconds() / 1000000);
+        }
+        default:
+            REALM_UNREACHABLE();
+    }
+}
+
+template<typename T>
+template<typename U>
+typename T::Object ResultsClass<T>::create_groups(ContextType ctx, U &collection, size_t argc, const ValueType arguments[]) {
+    auto const &realm = collection.get_realm();
+    auto const &object_schema = collection.get_object_schema();
+
+    std::string key_name = Value::validated_to_string(ctx, arguments[0], "keyProperty");
+    const Property *key_prop = object_schema.property_for_name(key_name);
+    if (!key_prop) {
+        throw std::runtime_error("Property '" + key_name + "' does not exist on object type '" + object_schema.name + "'");
+    }
+    switch (key_prop->type) {
+        case PropertyType::Bool:
+        case PropertyType::Int:
+        case PropertyType::String:
+        case PropertyType::Date:
+            break;
+        default:
+            throw std::runtime_error("Property '" + key_name + "' of type '" + string_for_property_type(key_prop->type) + "' cannot be grouped by");
+    }
+
+    auto function = argc > 1 ? aggregate_function_for_name(Value::validated_to_string(ctx, arguments[1], "aggregate")) : AggregateFunction::Count;
+    const Property *value_prop = nullptr;
+    if (function != AggregateFunction::Count) {
+        validate_argument_count(argc, 3, "A property to aggregate is required unless counting");
+
+        std::string value_name = Value::validated_to_string(ctx, arguments[2], "property");
+        value_prop = object_schema.property_for_name(value_name);
+        if (!value_prop) {
+            throw std::runtime_error("Property '" + value_name + "' does not exist on object type '" + object_schema.name + "'");
+        }
+        if (value_prop->type != PropertyType::Int && value_prop->type != PropertyType::Float && value_prop->type != PropertyType::Double) {
+            throw std::runtime_error(util::format("Cannot compute %1 of property '%2' of type '%3'", name_for_aggregate_function(function),
+                                                  value_name, string_for_property_type(value_prop->type)));
+        }
+    }
+
+    size_t key_column = key_prop->table_column;
+    auto key_for_row = [&](RowExpr row) -> ValueType {
+        if (key_prop->is_nullable && row.is_null(key_column)) {
+            return Value::from_null(ctx);
+        }
+        switch (key_prop->type) {
+            case PropertyType::Bool:
+                return Value::from_boolean(ctx, row.get_bool(key_column));
+            case PropertyType::Int:
+                return Value::from_number(ctx, row.get_int(key_column));
+            case PropertyType::String:
+                return Value::from_string(ctx, std::string(row.get_string(key_column)));
+            case PropertyType::Date: {
+                Timestamp ts = row.get_timestamp(key_column);
+                return Object::create_date(ctx, ts.get_seconds() * 1000.0 + ts.get_nanoseconds() / 1000000);
+            }
+            default:
+                REALM_UNREACHABLE();
+        }
+    };
+    auto keys_equal = [&](RowExpr a, RowExpr b) {
+        if (key_prop->is_nullable && (a.is_null(key_column) || b.is_null(key_column))) {
+            return a.is_null(key_column) && b.is_null(key_column);
+        }
+        switch (key_prop->type) {
+            case PropertyType::Bool:
+                return a.get_bool(key_column) == b.get_bool(key_column);
+            case PropertyType::Int:
+                return a.get_int(key_column) == b.get_int(key_column);
+            case PropertyType::String:
+                return a.get_string(key_column) == b.get_string(key_column);
+            case PropertyType::Date:
+                return a.get_timestamp(key_column) == b.get_timestamp(key_column);
+            default:
+                REALM_UNREACHABLE();
+        }
+    };
+
+    struct Group {
+        size_t count = 0;
+        size_t value_count = 0;
+        double sum = 0, min = 0, max = 0;
+    };
+
+    auto group_value = [&](const Group &group) -> ValueType {
+        switch (function) {
+            case AggregateFunction::Count:
+                return Value::from_number(ctx, group.count);
+            case AggregateFunction::Sum:
+                return Value::from_number(ctx, group.sum);
+            case AggregateFunction::Avg:
+                return group.value_count ? Value::from_number(ctx, group.sum / group.value_count) : Value::from_undefined(ctx);
+            case AggregateFunction::Min:
+                return group.value_count ? Value::from_number(ctx, group.min) : Value::from_undefined(ctx);
+            case AggregateFunction::Max:
+                return group.value_count ? Value::from_number(ctx, group.max) : Value::from_undefined(ctx);
+        }
+        REALM_UNREACHABLE();
+    };
+
+    // Sorting by the key lets core order the rows, so each group is a contiguous run that is aggregated in a single pass.
+    auto table = realm::ObjectStore::table_for_object_type(realm->read_group(), object_schema.name);
+    auto sorted = collection.sort({*table, {{key_column}}, {true}});
+    size_t count = sorted.size();
+
+    std::vector<ValueType> groups;
+    RowExpr group_row;
+    Group group;
+
+    for (size_t row_index = 0; row_index < count; row_index++) {
+        auto row = sorted.get(row_index);
+        if (!row.is_attached()) {
+            continue;
+        }
+
+        if (group.count == 0 || !keys_equal(group_row, row)) {
+            if (group.count) {
+                ValueType entry[2] = {key_for_row(group_row), group_value(group)};
+                groups.push_back(Object::create_array(ctx, 2, entry));
+            }
+            group_row = row;
+            group = {};
+        }
+        group.count++;
+
+        if (value_prop) {
+            size_t column = value_prop->table_column;
+            if (value_prop->is_nullable && row.is_null(column)) {
+                continue;
+            }
+
+            double value;
+            switch (value_prop->type) {
+                case PropertyType::Int:
+                    value = row.get_int(column);
+                    break;
+                case PropertyType::Float:
+                    value = row.get_float(column);
+                    break;
+                case PropertyType::Double:
+                    value = row.get_double(column);
+                    break;
+                default:
+                    REALM_UNREACHABLE();
+            }
+
+            group.sum += value;
+            group.min = group.value_count ? std::min(group.min, value) : value;
+            group.max = group.value_count ? std::max(group.max, value) : value;
+            group.value_count++;
+        }
+    }
+    if (group.count) {
+        ValueType entry[2] = {key_for_row(group_row), group_value(group)};
+        groups.push_back(Object::create_array(ctx, 2, entry));
+    }
+
+    return Object::create_array(ctx, groups);
+}
+
+// Returns the wrappers for up to `count` objects from `start` on, for iterating without a call per object.
+// Within a write transaction objects may be deleted by the code iterating over them, so only one is read at
+// a time there, and the collection is looked at again before each object as when reading by index.
+template<typename T>
+template<typename U>
+typename T::Object ResultsClass<T>::create_chunk(ContextType ctx, U &collection, size_t argc, const ValueType arguments[]) {
+    double start = Value::validated_to_number(ctx, arguments[0], "start");
+    double count = Value::validated_to_number(ctx, arguments[1], "count");
+    if (start < 0 || count < 1) {
+        throw std::invalid_argument("Invalid chunk bounds.");
+    }
+    if (collection.get_realm()->is_in_transaction()) {
+        count = 1;
+    }
+
+    ValueType bounds[2] = {Value::from_number(ctx, start), Value::from_number(ctx, start + count)};
+    ObjectType chunk = create_slice(ctx, collection, 2, bounds);
+
+    // The chunk is stale once the Realm's change state has moved on from the version it was read at.
+    if (auto delegate = get_delegate<T>(collection.get_realm().get())) {
+        Object::set_property(ctx, chunk, "version", Value::from_number(ctx, double(delegate->change_count())));
+        Object::set_property(ctx, chunk, "state", delegate->change_state());
+    }
+    return chunk;
+}
+
+template<typename T>
+template<typename U>
+typename T::Object ResultsClass<T>::create_slice(ContextType ctx, U &collection, size_t argc, const ValueType arguments[]) {
+    auto const &realm = collection.get_realm();
+    auto const &object_schema = collection.get_object_schema();
+
+    size_t start, end;
+    std::tie(start, end) = validated_slice_bounds(ctx, collection.size(), argc, arguments);
+
+    std::vector<const Property *> props;
+    if (argc > 2 && !Value::is_undefined(ctx, arguments[2])) {
+        ObjectType js_prop_names = Value::validated_to_array(ctx, arguments[2], "properties");
+        uint32_t prop_count = Object::validated_get_length(ctx, js_prop_names);
+        props.reserve(prop_count);
+
+        for (uint32_t i = 0; i < prop_count; i++) {
+            std::string prop_name = Object::validated_get_string(ctx, js_prop_names, i);
+            const Property *prop = object_schema.property_for_name(prop_name);
+            if (!prop) {
+                throw std::runtime_error("Property '" + prop_name + "' does not exist on object type '" + object_schema.name + "'");
+            }
+            props.push_back(prop);
+        }
+    }
+
+    std::vector<ValueType> values;
+    values.reserve(end - start);
+
+    if (argc <= 2 || Value::is_undefined(ctx, arguments[2])) {
+        for (size_t index = start; index < end; index++) {
+            auto row = collection.get(index);
+            values.push_back(row.is_attached() ? ValueType(collection.m_object_cache.get(ctx, index, realm, object_schema, row))
+                                               : Value::from_null(ctx));
+        }
+        return Object::create_array(ctx, values);
+    }
+
+    // Only the requested properties are read, into plain objects that share a single accessor.
+    NativeAccessor<T> accessor(ctx, realm, object_schema);
+    for (size_t index = start; index < end; index++) {
+        auto row = collection.get(index);
+        if (!row.is_attached()) {
+            values.push_back(Value::from_null(ctx));
+            continue;
+        }
+
+        realm::Object realm_object(realm, object_schema, row);
+        ObjectType object = Object::create_empty(ctx);
+        for (auto prop : props) {
+            Object::set_property(ctx, object, prop->name, RealmObjectClass<T>::get_property_value(accessor, realm_object, *prop));
+        }
+        values.push_back(object);
+    }
+    return Object::create_array(ctx, values);
+}
+
+template<typename T>
+std::pair<size_t, size_t> ResultsClass<T>::validated_slice_bounds(ContextType ctx, size_t size, size_t argc, const ValueType arguments[]) {
+    // Resolve the bounds the same way Array.prototype.slice does.
+    auto validated_bound = [&](size_t index, size_t default_value, const char *name) -> size_t {
+        if (argc <= index || Value::is_undefined(ctx, arguments[index])) {
+            return default_value;
+        }
+        if (!Value::is_number(ctx, arguments[index])) {
+            Value::validated_to_number(ctx, arguments[index], name);
+        }
+        double bound;
+        try {
+            bound = std::trunc(Value::to_number(ctx, arguments[index]));
+        }
+        catch (std::invalid_argument &) {
+            // NaN, which the engines refuse to convert, counts as 0.
+            bound = 0;
+        }
+
+        // Clamp before converting, as infinities and other numbers out of range don't fit a size_t.
+        if (bound < 0) {
+            bound += size;
+            return bound > 0 ? size_t(bound) : 0;
+        }
+        return bound < double(size) ? size_t(bound) : size;
+    };
+    size_t start = validated_bound(0, 0, "start");
+    return {start, std::max(start, validated_bound(1, size, "end"))};
+}
+
+template<typename T>
+template<typename U>
+typename T::Object ResultsClass<T>::create_plain_array(ContextType ctx, U &collection, size_t argc, const ValueType arguments[]) {
+    auto const &realm = collection.get_realm();
+    auto const &object_schema = collection.get_object_schema();
+
+    size_t start, end;
+    std::tie(start, end) = validated_slice_bounds(ctx, collection.size(), argc, arguments);
+    PlainObjectBuilder<T> builder(ctx, object_schema, argc > 2 ? arguments[2] : Value::from_undefined(ctx));
+
+    std::vector<ValueType> values;
+    values.reserve(end - start);
+    for (size_t index = start; index < end; index++) {
+        auto row = collection.get(index);
+        if (!row.is_attached()) {
+            values.push_back(Value::from_null(ctx));
+            continue;
+        }
+        realm::Object realm_object(realm, object_schema, row);
+        values.push_back(builder.build(realm_object));
+    }
+    return Object::create_array(ctx, values);
+}
+
 template<typename T>
 void ResultsClass<T>::get_length(ContextType ctx, ObjectType object, ReturnValue &return_value) {
     auto results = get_internal<T, ResultsClass<T>>(object);
     return_value.set((uint32_t)results->size());
 }
 
+template<typename T>
+void ResultsClass<T>::count(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 0);
+
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    if (!results->is_valid()) {
+        // Throws the error for the invalidated Realm or deleted list.
+        results->size();
+    }
+    // A Results that hasn't been evaluated counts with its query, without building a TableView.
+    size_t count = results->m_count_cache.get(results->get_realm()->read_group(), "count", [&] {
+        return results->size();
+    });
+    return_value.set((uint32_t)count);
+}
+
+template<typename T>
+void ResultsClass<T>::is_empty(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 0);
+
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    if (!results->is_valid()) {
+        results->size();
+    }
+    // The query only has to find its first match.
+    size_t empty = results->m_count_cache.get(results->get_realm()->read_group(), "isEmpty", [&] {
+        if (results->get_mode() == realm::Results::Mode::Query) {
+            return size_t(results->get_query().find() == realm::not_found);
+        }
+        return size_t(results->size() == 0);
+    });
+    return_value.set(empty != 0);
+}
+
 template<typename T>
 void ResultsClass<T>::get_index(ContextType ctx, ObjectType object, uint32_t index, ReturnValue &return_value) {
     auto results = get_internal<T, ResultsClass<T>>(object);
@@ -206,8 +1408,7 @@ void ResultsClass<T>::get_index(ContextType ctx, ObjectType object, uint32_t ind
         return;
     }
 
-    auto realm_object = realm::Object(results->get_realm(), results->get_object_schema(), results->get(index));
-    return_value.set(RealmObjectClass<T>::create_instance(ctx, std::move(realm_object)));
+    return_value.set(results->m_object_cache.get(ctx, index, results->get_realm(), results->get_object_schema(), row));
 }
 
 template<typename T>
@@ -253,7 +1454,17 @@ void ResultsClass<T>::index_of(ContextType ctx, FunctionType, ObjectType this_ob
         size_t ndx;
         try {
             auto results = get_internal<T, ResultsClass<T>>(this_object);
-            ndx = results->index_of(object->row());
+            // Rows of plain tables are found without scanning, and index_of() is what checks the object's table.
+            bool indexable = results->get_mode() != realm::Results::Mode::Table && object->realm() == results->get_realm()
+                && &object->get_object_schema() == &results->get_object_schema();
+            if (indexable) {
+                ndx = results->m_position_index.find(*results, results->get_realm()->read_group(), object->row().get_index(), [&] {
+                    return results->index_of(object->row());
+                });
+            }
+            else {
+                ndx = results->index_of(object->row());
+            }
         }
         catch (realm::Results::IncorrectTableException &) {
             throw std::runtime_error("Object type does not match the type contained in result");
@@ -272,24 +1483,184 @@ void ResultsClass<T>::index_of(ContextType ctx, FunctionType, ObjectType this_ob
 }
     
 template<typename T>
-void ResultsClass<T>::add_listener(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+void ResultsClass<T>::to_columns(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1);
+
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    return_value.set(create_columns(ctx, *results, argc, arguments));
+}
+
+template<typename T>
+template<AggregateFunction function>
+void ResultsClass<T>::aggregate(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 1);
+
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    return_value.set(compute_aggregate(ctx, *results, function, arguments[0]));
+}
+
+template<typename T>
+void ResultsClass<T>::group_by(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1, 3);
+
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    return_value.set(create_groups(ctx, *results, argc, arguments));
+}
+
+template<typename T>
+void ResultsClass<T>::slice(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    // Extra arguments are ignored, as they are by Array.prototype.slice.
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    return_value.set(create_slice(ctx, *results, argc, arguments));
+}
+
+template<typename T>
+void ResultsClass<T>::get_chunk(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 2);
+
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    return_value.set(create_chunk(ctx, *results, argc, arguments));
+}
+
+template<typename T>
+void ResultsClass<T>::to_plain_array(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 0, 3);
+
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    return_value.set(create_plain_array(ctx, *results, argc, arguments));
+}
+
+template<typename T>
+void ResultsClass<T>::export_to(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 4);
+
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    std::string path = Value::validated_to_string(ctx, arguments[0], "path");
+
+    std::string format_name = Value::validated_to_string(ctx, arguments[1], "format");
+    RowExporter::Format format;
+    if (format_name == "json") {
+        format = RowExporter::Format::JSON;
+    }
+    else if (format_name == "csv") {
+        format = RowExporter::Format::CSV;
+    }
+    else {
+        throw std::invalid_argument(util::format("Unsupported export format '%1'.", format_name));
+    }
+
+    auto &object_schema = results->get_object_schema();
+    std::vector<std::string> property_names;
+    if (Value::is_undefined(ctx, arguments[2])) {
+        for (auto &prop : object_schema.persisted_properties) {
+            property_names.push_back(prop.name);
+        }
+    }
+    else {
+        ObjectType names = Value::validated_to_array(ctx, arguments[2], "properties");
+        uint32_t count = Object::validated_get_length(ctx, names);
+        for (uint32_t i = 0; i < count; i++) {
+            std::string name = Object::validated_get_string(ctx, names, i);
+            auto prop = object_schema.property_for_name(name);
+            if (!prop || prop->type == PropertyType::LinkingObjects) {
+                throw std::invalid_argument(util::format("Property '%1' cannot be exported from '%2'.", name, object_schema.name));
+            }
+            property_names.push_back(std::move(name));
+        }
+    }
+    FunctionType callback = Value::validated_to_function(ctx, arguments[3], "callback");
+
+    auto realm = results->get_realm();
+    if (realm->is_in_transaction()) {
+        throw std::runtime_error("Cannot export objects while in a write transaction.");
+    }
+
+    // The rows are read by a Realm of the worker's own, at the version this Results is at now.
+    auto reference = std::make_shared<ThreadSafeReference<realm::Results>>(realm->obtain_thread_safe_reference<realm::Results>(*results));
+    realm::Realm::Config config = realm->config();
+    config.migration_function = nullptr;
+    config.should_compact_on_launch_function = nullptr;
+    config.cache = false;
+
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<FunctionType> protected_callback(ctx, callback);
+
+    using ExportHandler = void(std::string error, size_t row_count);
+    std::function<ExportHandler> report = EventLoopDispatcher<ExportHandler>([=](std::string error, size_t row_count) {
+        HANDLESCOPE
+        ValueType callback_arguments[2];
+        if (!error.empty()) {
+            callback_arguments[0] = Value::from_string(protected_ctx, error);
+            callback_arguments[1] = Value::from_undefined(protected_ctx);
+        }
+        else {
+            ObjectType result = Object::create_empty(protected_ctx);
+            Object::set_property(protected_ctx, result, "rows", Value::from_number(protected_ctx, row_count));
+            callback_arguments[0] = Value::from_null(protected_ctx);
+            callback_arguments[1] = result;
+        }
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
+    });
+
+    std::thread([=]() {
+        size_t row_count = 0;
+        try {
+            SharedRealm worker_realm = realm::Realm::get_shared_realm(config);
+            realm::Results rows = worker_realm->resolve_thread_safe_reference(std::move(*reference));
+
+            RowExporter exporter(path, format, *worker_realm, rows.get_object_schema(), property_names);
+            exporter.write_header();
+            size_t size = rows.size();
+            for (size_t i = 0; i < size; i++) {
+                auto row = rows.get(i);
+                // Snapshots keep the places of deleted objects, which are left out.
+                if (row.is_attached()) {
+                    exporter.write_row(row);
+                    row_count++;
+                }
+            }
+            exporter.finish();
+            worker_realm->close();
+        }
+        catch (std::exception &e) {
+            report(e.what(), row_count);
+            return;
+        }
+        report("", row_count);
+    }).detach();
+}
+
+template<typename T>
+void ResultsClass<T>::add_listener(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1, 2);
     
     auto results = get_internal<T, ResultsClass<T>>(this_object);
     auto callback = Value::validated_to_function(ctx, arguments[0]);
+    auto options = CollectionClass<T>::validated_listener_options(ctx, results->get_object_schema(), argc, arguments);
     Protected<FunctionType> protected_callback(ctx, callback);
     Protected<ObjectType> protected_this(ctx, this_object);
     Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
     
-    auto token = results->add_notification_callback([=](CollectionChangeSet change_set, std::exception_ptr exception) {
+    auto &scheduler = get_delegate<T>(results->get_realm().get())->m_listener_scheduler;
+    auto listener = scheduler.add(options.priority, [=](CollectionChangeSet change_set) {
         HANDLESCOPE
 
         ValueType arguments[2];
         arguments[0] = static_cast<ObjectType>(protected_this);
-        arguments[1] = CollectionClass<T>::create_collection_change_set(protected_ctx, change_set);
+        arguments[1] = CollectionClass<T>::create_collection_change_set(protected_ctx, change_set, options);
         Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, arguments);
     });
-    results->m_notification_tokens.emplace_back(protected_callback, std::move(token));
+
+    std::weak_ptr<ListenerScheduler::Listener> weak_listener = listener;
+    auto token = results->add_notification_callback([=](CollectionChangeSet change_set, std::exception_ptr exception) {
+        auto listener = weak_listener.lock();
+        if (listener && CollectionClass<T>::should_notify(change_set, options)) {
+            ListenerScheduler::deliver(listener, std::move(change_set));
+        }
+    });
+    LiveObjectCounter token_count(results->get_realm()->config().path, LiveObjectRegistry::notification_token_kind());
+    results->m_notification_tokens.add(protected_callback, {std::move(token), std::move(token_count), std::move(listener)});
 }
 
 template<typename T>
@@ -300,16 +1671,7 @@ void ResultsClass<T>::remove_listener(ContextType ctx, FunctionType, ObjectType
     auto callback = Value::validated_to_function(ctx, arguments[0]);
     auto protected_function = Protected<FunctionType>(ctx, callback);
     
-    auto iter = results->m_notification_tokens.begin();
-    typename Protected<FunctionType>::Comparator compare;
-    while (iter != results->m_notification_tokens.end()) {
-        if(compare(iter->first, protected_function)) {
-            iter = results->m_notification_tokens.erase(iter);
-        }
-        else {
-            iter++;
-        }
-    }
+    results->m_notification_tokens.remove(protected_function);
 }
 
 template<typename T>
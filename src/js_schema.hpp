@@ -18,16 +18,20 @@
 
 #pragma once
 
+#include <list>
 #include <map>
+#include <set>
 
 #include "js_types.hpp"
 #include "schema.hpp"
+#include "util/format.hpp"
 
 namespace realm {
 namespace js {
 
 template<typename T>
 struct Schema {
+    using GlobalContextType = typename T::GlobalContext;
     using ContextType = typename T::Context;
     using FunctionType = typename T::Function;
     using ObjectType = typename T::Object;
@@ -39,11 +43,15 @@ struct Schema {
     using ObjectDefaults = std::map<std::string, Protected<ValueType>>;
     using ObjectDefaultsMap = std::map<std::string, ObjectDefaults>;
     using ConstructorMap = std::map<std::string, Protected<FunctionType>>;
+    // The string properties of each object type that were declared with `fullText: true`, for which
+    // CONTAINS queries look up candidate rows in a token index.
+    using TextIndexMap = std::map<std::string, std::set<std::string>>;
 
     static ObjectType dict_for_property_array(ContextType, const ObjectSchema &, ObjectType);
-    static Property parse_property(ContextType, ValueType, std::string, ObjectDefaults &);
-    static ObjectSchema parse_object_schema(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &);
-    static realm::Schema parse_schema(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &);
+    static Property parse_property(ContextType, ValueType, std::string, ObjectDefaults &, std::set<std::string> &);
+    static ObjectSchema parse_object_schema(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &, TextIndexMap &);
+    static realm::Schema parse_schema(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &, TextIndexMap &);
+    static realm::Schema parse_schema_cached(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &, TextIndexMap &);
 
     static ObjectType object_for_schema(ContextType, const realm::Schema &);
     static ObjectType object_for_object_schema(ContextType, const ObjectSchema &);
@@ -69,9 +77,11 @@ typename T::Object Schema<T>::dict_for_property_array(ContextType ctx, const Obj
 }
 
 template<typename T>
-Property Schema<T>::parse_property(ContextType ctx, ValueType attributes, std::string property_name, ObjectDefaults &object_defaults) {
+Property Schema<T>::parse_property(ContextType ctx, ValueType attributes, std::string property_name, ObjectDefaults &object_defaults,
+                                   std::set<std::string> &text_indexed) {
     static const String default_string = "default";
     static const String indexed_string = "indexed";
+    static const String full_text_string = "fullText";
     static const String type_string = "type";
     static const String object_type_string = "objectType";
     static const String optional_string = "optional";
@@ -123,6 +133,14 @@ Property Schema<T>::parse_property(ContextType ctx, ValueType attributes, std::s
         }
         prop.type = realm::PropertyType::Array;
         prop.object_type = Object::validated_get_string(ctx, property_object, object_type_string);
+
+        // The List in this version of the object store is backed by a LinkView, so it can only hold objects.
+        static const std::set<std::string> primitive_types = {"bool", "int", "float", "double", "string", "date", "data"};
+        if (primitive_types.count(prop.object_type)) {
+            throw std::runtime_error(util::format("List property '%1' can't contain '%2' values, only objects. "
+                                                  "Store them in objects with a single '%2' property instead.",
+                                                  prop.name, prop.object_type));
+        }
     }
     else if (type == "linkingObjects") {
         prop.type = realm::PropertyType::LinkingObjects;
@@ -159,13 +177,22 @@ Property Schema<T>::parse_property(ContextType ctx, ValueType attributes, std::s
         if (!Value::is_undefined(ctx, indexed_value)) {
             prop.is_indexed = Value::validated_to_boolean(ctx, indexed_value);
         }
+
+        ValueType full_text_value = Object::get_property(ctx, property_object, full_text_string);
+        if (!Value::is_undefined(ctx, full_text_value) && Value::validated_to_boolean(ctx, full_text_value, "fullText")) {
+            if (prop.type != realm::PropertyType::String) {
+                throw std::invalid_argument(util::format("Property '%1' can't have a full-text index, as it is not a string property.", prop.name));
+            }
+            text_indexed.insert(prop.name);
+        }
     }
     
     return prop;
 }
 
 template<typename T>
-ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_schema_object, ObjectDefaultsMap &defaults, ConstructorMap &constructors) {
+ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_schema_object, ObjectDefaultsMap &defaults,
+                                            ConstructorMap &constructors, TextIndexMap &text_indexes) {
     static const String name_string = "name";
     static const String primary_string = "primaryKey";
     static const String properties_string = "properties";
@@ -178,6 +205,7 @@ ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_s
     }
     
     ObjectDefaults object_defaults;
+    std::set<std::string> text_indexed;
     ObjectSchema object_schema;
     object_schema.name = Object::validated_get_string(ctx, object_schema_object, name_string);
     
@@ -187,7 +215,7 @@ ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_s
         for (uint32_t i = 0; i < length; i++) {
             ObjectType property_object = Object::validated_get_object(ctx, properties_object, i);
             std::string property_name = Object::validated_get_string(ctx, property_object, name_string);
-            Property property = parse_property(ctx, property_object, property_name, object_defaults);
+            Property property = parse_property(ctx, property_object, property_name, object_defaults, text_indexed);
             if (property.type == realm::PropertyType::LinkingObjects) {
                 object_schema.computed_properties.emplace_back(std::move(property));
             }
@@ -201,7 +229,7 @@ ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_s
         auto property_names = Object::get_property_names(ctx, properties_object);
         for (auto &property_name : property_names) {
             ValueType property_value = Object::get_property(ctx, properties_object, property_name);
-            Property property = parse_property(ctx, property_value, property_name, object_defaults);
+            Property property = parse_property(ctx, property_value, property_name, object_defaults, text_indexed);
             if (property.type == realm::PropertyType::LinkingObjects) {
                 object_schema.computed_properties.emplace_back(std::move(property));
             }
@@ -227,24 +255,148 @@ ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_s
     }
     
     defaults.emplace(object_schema.name, std::move(object_defaults));
+    if (!text_indexed.empty()) {
+        text_indexes.emplace(object_schema.name, std::move(text_indexed));
+    }
     
     return object_schema;
 }
 
 template<typename T>
-realm::Schema Schema<T>::parse_schema(ContextType ctx, ObjectType schema_object, ObjectDefaultsMap &defaults, ConstructorMap &constructors) {
+realm::Schema Schema<T>::parse_schema(ContextType ctx, ObjectType schema_object, ObjectDefaultsMap &defaults,
+                                      ConstructorMap &constructors, TextIndexMap &text_indexes) {
     std::vector<ObjectSchema> schema;
     uint32_t length = Object::validated_get_length(ctx, schema_object);
 
     for (uint32_t i = 0; i < length; i++) {
         ObjectType object_schema_object = Object::validated_get_object(ctx, schema_object, i, "ObjectSchema");
-        ObjectSchema object_schema = parse_object_schema(ctx, object_schema_object, defaults, constructors);
+        ObjectSchema object_schema = parse_object_schema(ctx, object_schema_object, defaults, constructors, text_indexes);
         schema.emplace_back(std::move(object_schema));
     }
 
     return realm::Schema(schema);
 }
 
+// The schemas that Realms were most recently opened with, so that opening Realms repeatedly with the same schema
+// array doesn't parse and validate it from scratch every time. An entry is reused when both the array and each of
+// its elements (object schemas or constructors) are the very same JS objects, and each still has as many
+// properties as before, so that properties added to or removed from an object schema in place are picked up.
+// Changing the attributes of a property in place isn't detected, and needs a new object schema.
+template<typename T>
+struct CachedSchema {
+    using ContextType = typename T::Context;
+    using ObjectType = typename T::Object;
+    using ValueType = typename T::Value;
+    using Object = js::Object<T>;
+    using Value = js::Value<T>;
+    using String = js::String<T>;
+
+    static constexpr size_t capacity = 8;
+
+    // Keeps the context alive until the values protected in it below have been released.
+    Protected<typename T::GlobalContext> context;
+    Protected<ObjectType> schema_object;
+    std::vector<Protected<ValueType>> elements;
+    std::vector<size_t> property_counts;
+    realm::Schema schema;
+    typename Schema<T>::ObjectDefaultsMap defaults;
+    typename Schema<T>::ConstructorMap constructors;
+    typename Schema<T>::TextIndexMap text_indexes;
+
+    static std::list<CachedSchema> &entries() {
+        // Deliberately leaked so nothing is unprotected after the JS engine has been torn down at exit.
+        static auto entries = new std::list<CachedSchema>();
+        return *entries;
+    }
+
+    // The number of properties of each element, or -1 for those that wouldn't parse, which parse_schema() rejects.
+    static std::vector<size_t> count_properties(ContextType ctx, const std::vector<ValueType> &elements) {
+        static const String properties_string = "properties";
+        static const String schema_string = "schema";
+
+        std::vector<size_t> counts;
+        counts.reserve(elements.size());
+        for (ValueType value : elements) {
+            if (Value::is_constructor(ctx, value)) {
+                value = Object::get_property(ctx, Value::to_object(ctx, value), schema_string);
+            }
+            ValueType properties = Value::is_object(ctx, value)
+                ? Object::get_property(ctx, Value::to_object(ctx, value), properties_string) : value;
+            if (!Value::is_object(ctx, properties)) {
+                counts.push_back(size_t(-1));
+            }
+            else if (Value::is_array(ctx, properties)) {
+                counts.push_back(Object::validated_get_length(ctx, Value::to_object(ctx, properties)));
+            }
+            else {
+                counts.push_back(Object::get_property_names(ctx, Value::to_object(ctx, properties)).size());
+            }
+        }
+        return counts;
+    }
+};
+
+template<typename T>
+realm::Schema Schema<T>::parse_schema_cached(ContextType ctx, ObjectType schema_object, ObjectDefaultsMap &defaults,
+                                             ConstructorMap &constructors, TextIndexMap &text_indexes) {
+    auto &entries = CachedSchema<T>::entries();
+    GlobalContextType global_context = Context<T>::get_global_context(ctx);
+    uint32_t length = Object::validated_get_length(ctx, schema_object);
+
+    // Only gather the elements if this array is in the cache, since that is all that needs checking then.
+    std::vector<ValueType> elements;
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (static_cast<GlobalContextType>(it->context) != global_context || static_cast<ObjectType>(it->schema_object) != schema_object) {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < length; i++) {
+            elements.push_back(Object::get_property(ctx, schema_object, i));
+        }
+        bool unchanged = it->elements.size() == length;
+        for (uint32_t i = 0; unchanged && i < length; i++) {
+            unchanged = static_cast<ValueType>(it->elements[i]) == elements[i];
+        }
+        unchanged = unchanged && CachedSchema<T>::count_properties(ctx, elements) == it->property_counts;
+
+        if (unchanged) {
+            entries.splice(entries.begin(), entries, it);
+            defaults = it->defaults;
+            constructors = it->constructors;
+            text_indexes = it->text_indexes;
+            return it->schema;
+        }
+        entries.erase(it);
+        break;
+    }
+
+    realm::Schema schema = parse_schema(ctx, schema_object, defaults, constructors, text_indexes);
+
+    if (elements.empty()) {
+        for (uint32_t i = 0; i < length; i++) {
+            elements.push_back(Object::get_property(ctx, schema_object, i));
+        }
+    }
+    std::vector<size_t> property_counts = CachedSchema<T>::count_properties(ctx, elements);
+    std::vector<Protected<ValueType>> protected_elements;
+    protected_elements.reserve(length);
+    for (auto &element : elements) {
+        protected_elements.emplace_back(ctx, element);
+    }
+
+    // Entries from previous contexts (e.g. before a React Native reload) can never match again.
+    entries.remove_if([&](const CachedSchema<T> &entry) {
+        return static_cast<GlobalContextType>(entry.context) != global_context;
+    });
+    entries.push_front({Protected<GlobalContextType>(global_context), Protected<ObjectType>(ctx, schema_object),
+                        std::move(protected_elements), std::move(property_counts), schema, defaults, constructors, text_indexes});
+    if (entries.size() > CachedSchema<T>::capacity) {
+        entries.pop_back();
+    }
+
+    return schema;
+}
+
 template<typename T>
 typename T::Object Schema<T>::object_for_schema(ContextType ctx, const realm::Schema &schema) {
     ObjectType object = Object::create_array(ctx);
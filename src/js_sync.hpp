@@ -18,9 +18,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <deque>
 #include <list>
 #include <map>
+#include <mutex>
 #include <set>
+#include <sstream>
 #include <regex>
 
 #include "event_loop_dispatcher.hpp"
@@ -40,6 +45,184 @@ namespace js {
 using SharedUser = std::shared_ptr<realm::SyncUser>;
 using WeakSession = std::weak_ptr<realm::SyncSession>;
 
+// Decides on the sync thread which progress ticks are worth sending to JS: one is let through only
+// when `min_interval` has passed or `min_delta` of the transferrable bytes were transferred since the
+// last one. The first tick and the one completing the transfer always get through.
+class ProgressThrottle {
+    using Clock = std::chrono::steady_clock;
+
+  public:
+    ProgressThrottle(double min_interval_ms, double min_delta)
+    : m_min_interval(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(min_interval_ms)))
+    , m_min_delta(min_delta) {}
+
+    bool should_deliver(uint64_t transferred, uint64_t transferrable) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto now = Clock::now();
+        bool unthrottled = m_min_interval.count() == 0 && m_min_delta == 0;
+        // A drop in the transferred bytes means a new transfer started.
+        bool deliver = unthrottled || !m_delivered_any || transferred >= transferrable || transferred < m_last_transferred
+            || (m_min_interval.count() > 0 && now - m_last_time >= m_min_interval)
+            || (m_min_delta > 0 && transferrable > 0 && double(transferred - m_last_transferred) / transferrable >= m_min_delta);
+
+        if (deliver) {
+            m_delivered_any = true;
+            m_last_time = now;
+            m_last_transferred = transferred;
+        }
+        return deliver;
+    }
+
+  private:
+    const Clock::duration m_min_interval;
+    const double m_min_delta;
+
+    std::mutex m_mutex;
+    bool m_delivered_any = false;
+    Clock::time_point m_last_time;
+    uint64_t m_last_transferred = 0;
+};
+
+// Where the sync client's log messages go once Realm.Sync.setLogger() has been called. Messages below the
+// level are dropped by the logger before they are even formatted. The rest are kept in a ring buffer on the
+// sync thread, and a single delivery to JS is scheduled for however many arrive before it runs, so verbose
+// logging doesn't cost a call into JS per line. When more arrive than the buffer holds, the oldest are dropped
+// and counted.
+class SyncLogSink {
+  public:
+    struct Entry {
+        util::Logger::Level level;
+        std::string message;
+    };
+
+    static SyncLogSink &shared() {
+        // Leaked on purpose, as the sync client thread may still log during static destruction.
+        static SyncLogSink *sink = new SyncLogSink();
+        return *sink;
+    }
+
+    util::Logger::Level level() const {
+        return m_level.load(std::memory_order_relaxed);
+    }
+
+    bool has_target() const {
+        return m_has_target.load(std::memory_order_relaxed);
+    }
+
+    // `deliver` is called from the sync thread, and should get the batch onto the JS thread to take() it.
+    void set_target(util::Logger::Level level, size_t capacity, std::function<void()> deliver) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_level = deliver ? level : util::Logger::Level::off;
+        m_has_target = bool(deliver);
+        m_capacity = capacity;
+        m_deliver = std::move(deliver);
+        m_entries.clear();
+        m_dropped = 0;
+        m_delivery_pending = false;
+    }
+
+    // Returns false, leaving `message` alone, if there is no target to deliver it to.
+    bool log(util::Logger::Level level, std::string &message) {
+        std::function<void()> deliver;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_deliver) {
+                return false;
+            }
+            if (m_entries.size() >= m_capacity) {
+                m_entries.pop_front();
+                m_dropped++;
+            }
+            m_entries.push_back({level, std::move(message)});
+            if (m_delivery_pending) {
+                return true;
+            }
+            m_delivery_pending = true;
+            deliver = m_deliver;
+        }
+        deliver();
+        return true;
+    }
+
+    std::deque<Entry> take(size_t &dropped) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::deque<Entry> entries;
+        entries.swap(m_entries);
+        dropped = m_dropped;
+        m_dropped = 0;
+        m_delivery_pending = false;
+        return entries;
+    }
+
+  private:
+    std::atomic<util::Logger::Level> m_level = {util::Logger::Level::off};
+    std::atomic<bool> m_has_target = {false};
+    std::mutex m_mutex;
+    size_t m_capacity = 0;
+    std::function<void()> m_deliver;
+    std::deque<Entry> m_entries;
+    size_t m_dropped = 0;
+    bool m_delivery_pending = false;
+};
+
+// The logger the sync client is given, which follows the sink so the logger can be set or removed after the
+// client has been created. Without a target, messages go to stderr at the level given by setLogLevel() before
+// the client was created, as they would with the sync manager's default logger.
+class SyncSinkLogger : private util::Logger::LevelThreshold, public util::Logger {
+  public:
+    explicit SyncSinkLogger(util::Logger::Level default_level)
+    : util::Logger(static_cast<util::Logger::LevelThreshold &>(*this))
+    , m_default_level(default_level) {
+        m_default_logger.set_level_threshold(default_level);
+    }
+
+  protected:
+    void do_log(util::Logger::Level level, std::string message) override {
+        if (!SyncLogSink::shared().log(level, message)) {
+            m_default_logger.log(level, "%1", message);
+        }
+    }
+
+  private:
+    util::Logger::Level m_default_level;
+    util::StderrLogger m_default_logger;
+
+    util::Logger::Level get() const noexcept override {
+        SyncLogSink &sink = SyncLogSink::shared();
+        return sink.has_target() ? sink.level() : m_default_level;
+    }
+};
+
+class SyncSinkLoggerFactory : public realm::SyncLoggerFactory {
+  public:
+    static SyncSinkLoggerFactory &shared() {
+        static SyncSinkLoggerFactory factory;
+        return factory;
+    }
+
+    std::unique_ptr<util::Logger> make_logger(util::Logger::Level level) override {
+        return std::unique_ptr<util::Logger>(new SyncSinkLogger(level));
+    }
+};
+
+inline util::Logger::Level parse_log_level(const std::string &name) {
+    std::istringstream in(name); // Throws
+    in.imbue(std::locale::classic()); // Throws
+    in.unsetf(std::ios_base::skipws);
+    util::Logger::Level level = util::Logger::Level();
+    in >> level; // Throws
+    if (!in || !in.eof())
+        throw std::runtime_error("Bad log level");
+    return level;
+}
+
+inline std::string log_level_name(util::Logger::Level level) {
+    std::ostringstream out;
+    out.imbue(std::locale::classic());
+    out << level;
+    return out.str();
+}
+
 template<typename T>
 class UserClass : public ClassDefinition<T, SharedUser> {
     using GlobalContextType = typename T::GlobalContext;
@@ -147,6 +330,35 @@ void UserClass<T>::logout(ContextType ctx, FunctionType, ObjectType this_object,
     get_internal<T, UserClass<T>>(this_object)->get()->log_out();
 }
 
+// The progress notifications registered from JS, with the tokens they were registered with, for each session
+// that is still around. A session's JS objects come and go, so they are kept by the session itself.
+template<typename T>
+class ProgressNotificationRegistry {
+    using Registrations = CallbackRegistry<T, uint64_t>;
+
+  public:
+    static Registrations &for_session(const std::shared_ptr<SyncSession> &session) {
+        auto &sessions = all();
+        for (auto it = sessions.begin(); it != sessions.end();) {
+            if (it->second.first.expired()) {
+                it = sessions.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        auto &entry = sessions[session.get()];
+        entry.first = session;
+        return entry.second;
+    }
+
+  private:
+    static std::map<const SyncSession *, std::pair<WeakSession, Registrations>> &all() {
+        static std::map<const SyncSession *, std::pair<WeakSession, Registrations>> sessions;
+        return sessions;
+    }
+};
+
 template<typename T>
 class SessionClass : public ClassDefinition<T, WeakSession> {
     using ContextType = typename T::Context;
@@ -170,6 +382,8 @@ public:
 
     static void simulate_error(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
     static void refresh_access_token(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void add_progress_notification(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void remove_progress_notification(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
 
     PropertyMap<T> const properties = {
         {"config", {wrap<get_config>, nullptr}},
@@ -180,7 +394,9 @@ public:
 
     MethodMap<T> const methods = {
         {"_simulateError", wrap<simulate_error>},
-        {"_refreshAccessToken", wrap<refresh_access_token>}
+        {"_refreshAccessToken", wrap<refresh_access_token>},
+        {"addProgressNotification", wrap<add_progress_notification>},
+        {"removeProgressNotification", wrap<remove_progress_notification>},
     };
 };
 
@@ -307,6 +523,106 @@ void SessionClass<T>::refresh_access_token(ContextType ctx, FunctionType, Object
     }
 }
 
+template<typename T>
+void SessionClass<T>::add_progress_notification(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &) {
+    validate_argument_count(argc, 3, 4);
+
+    std::string direction = Value::validated_to_string(ctx, arguments[0], "direction");
+    SyncSession::NotifierType notifier_type;
+    if (direction == "download") {
+        notifier_type = SyncSession::NotifierType::download;
+    }
+    else if (direction == "upload") {
+        notifier_type = SyncSession::NotifierType::upload;
+    }
+    else {
+        throw std::invalid_argument("Invalid argument 'direction'. Only 'download' and 'upload' progress notification directions are supported.");
+    }
+
+    std::string mode = Value::validated_to_string(ctx, arguments[1], "mode");
+    bool is_streaming;
+    if (mode == "reportIndefinitely") {
+        is_streaming = true;
+    }
+    else if (mode == "forCurrentlyOutstandingWork") {
+        is_streaming = false;
+    }
+    else {
+        throw std::invalid_argument("Invalid argument 'mode'. Only 'reportIndefinitely' and 'forCurrentlyOutstandingWork' progress notification modes are supported.");
+    }
+
+    FunctionType callback_function = Value::validated_to_function(ctx, arguments[2], "callback");
+
+    double min_interval = 0, min_delta = 0;
+    if (argc == 4 && !Value::is_undefined(ctx, arguments[3])) {
+        static const String min_interval_string = "minInterval";
+        static const String min_delta_string = "minDelta";
+
+        ObjectType options = Value::validated_to_object(ctx, arguments[3], "options");
+        ValueType min_interval_value = Object::get_property(ctx, options, min_interval_string);
+        if (!Value::is_undefined(ctx, min_interval_value)) {
+            min_interval = Value::validated_to_number(ctx, min_interval_value, "minInterval");
+        }
+        ValueType min_delta_value = Object::get_property(ctx, options, min_delta_string);
+        if (!Value::is_undefined(ctx, min_delta_value)) {
+            min_delta = Value::validated_to_number(ctx, min_delta_value, "minDelta");
+        }
+        if (min_interval < 0 || min_delta < 0 || min_delta > 1) {
+            throw std::invalid_argument("'minInterval' must not be negative and 'minDelta' must be between 0 and 1.");
+        }
+    }
+
+    auto session = get_internal<T, SessionClass<T>>(this_object)->lock();
+    if (!session) {
+        return;
+    }
+
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    Protected<FunctionType> protected_callback(ctx, callback_function);
+    Protected<ObjectType> protected_this(ctx, this_object);
+
+    // Coalescing means a busy JS thread only ever sees the latest progress.
+    std::function<void(uint64_t, uint64_t)> dispatch = EventLoopDispatcher<void(uint64_t, uint64_t)>([=](uint64_t transferred_bytes, uint64_t transferrable_bytes) {
+        HANDLESCOPE
+        ValueType callback_arguments[2] = {
+            Value::from_number(protected_ctx, transferred_bytes),
+            Value::from_number(protected_ctx, transferrable_bytes),
+        };
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
+    }, true);
+
+    auto throttle = std::make_shared<ProgressThrottle>(min_interval, min_delta);
+    uint64_t token = session->register_progress_notifier([=](uint64_t transferred_bytes, uint64_t transferrable_bytes) {
+        if (throttle->should_deliver(transferred_bytes, transferrable_bytes)) {
+            dispatch(transferred_bytes, transferrable_bytes);
+        }
+    }, notifier_type, is_streaming);
+
+    ProgressNotificationRegistry<T>::for_session(session).add(std::move(protected_callback), token);
+}
+
+template<typename T>
+void SessionClass<T>::remove_progress_notification(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &) {
+    validate_argument_count(argc, 1);
+
+    FunctionType callback_function = Value::validated_to_function(ctx, arguments[0], "callback");
+    auto session = get_internal<T, SessionClass<T>>(this_object)->lock();
+    if (!session) {
+        return;
+    }
+
+    // Every registration of the callback with this session is removed.
+    auto &registrations = ProgressNotificationRegistry<T>::for_session(session);
+    Protected<FunctionType> protected_callback(ctx, callback_function);
+    typename Protected<FunctionType>::Comparator compare;
+    for (auto &registration : registrations) {
+        if (compare(registration.first, protected_callback)) {
+            session->unregister_progress_notifier(registration.second);
+        }
+    }
+    registrations.remove(protected_callback);
+}
+
 template<typename T>
 class SyncClass : public ClassDefinition<T, void *> {
     using GlobalContextType = typename T::GlobalContext;
@@ -326,6 +642,7 @@ public:
     static FunctionType create_constructor(ContextType);
 
     static void set_sync_log_level(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
+    static void set_sync_logger(ContextType, FunctionType, ObjectType, size_t, const ValueType[], ReturnValue &);
 
     // private
     static void populate_sync_config(ContextType, ObjectType realm_constructor, ObjectType config_object, Realm::Config&);
@@ -335,6 +652,7 @@ public:
 
     MethodMap<T> const static_methods = {
         {"setLogLevel", wrap<set_sync_log_level>},
+        {"setLogger", wrap<set_sync_logger>},
     };
 };
 
@@ -350,6 +668,10 @@ inline typename T::Function SyncClass<T>::create_constructor(ContextType ctx) {
     ensure_directory_exists_for_file(default_realm_file_directory());
     SyncManager::shared().configure_file_system(default_realm_file_directory(), SyncManager::MetadataMode::NoEncryption);
 
+    // Installed before any synced Realm can be opened, since the sync client only asks for its logger when it
+    // starts. Realm.Sync.setLogger() then only changes where the logger sends messages.
+    SyncManager::shared().set_logger_factory(SyncSinkLoggerFactory::shared());
+
     return sync_constructor;
 }
 
@@ -357,14 +679,63 @@ template<typename T>
 void SyncClass<T>::set_sync_log_level(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
     validate_argument_count(argc, 1);
     std::string log_level = Value::validated_to_string(ctx, arguments[0]);
-    std::istringstream in(log_level); // Throws
-    in.imbue(std::locale::classic()); // Throws
-    in.unsetf(std::ios_base::skipws);
-    util::Logger::Level log_level_2 = util::Logger::Level();
-    in >> log_level_2; // Throws
-    if (!in || !in.eof())
-        throw std::runtime_error("Bad log level");
-    realm::SyncManager::shared().set_log_level(log_level_2);
+    realm::SyncManager::shared().set_log_level(parse_log_level(log_level));
+}
+
+template<typename T>
+void SyncClass<T>::set_sync_logger(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 1, 3);
+
+    if (Value::is_null(ctx, arguments[0]) || Value::is_undefined(ctx, arguments[0])) {
+        SyncLogSink::shared().set_target(util::Logger::Level::off, 0, nullptr);
+        return;
+    }
+
+    util::Logger::Level level = parse_log_level(Value::validated_to_string(ctx, arguments[0], "level"));
+    if (argc < 2) {
+        throw std::invalid_argument("A callback must be given unless the level is null.");
+    }
+    FunctionType callback = Value::validated_to_function(ctx, arguments[1], "callback");
+    size_t capacity = 1000;
+    if (argc == 3 && !Value::is_undefined(ctx, arguments[2])) {
+        double max_buffered = Value::validated_to_number(ctx, arguments[2], "maxBufferedMessages");
+        if (!(max_buffered >= 1)) {
+            throw std::invalid_argument("maxBufferedMessages must be at least 1.");
+        }
+        capacity = size_t(max_buffered);
+    }
+
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    Protected<FunctionType> protected_callback(ctx, callback);
+    Protected<ObjectType> protected_this(ctx, this_object);
+
+    std::function<void()> deliver = EventLoopDispatcher<void()>([=]() {
+        size_t dropped = 0;
+        auto entries = SyncLogSink::shared().take(dropped);
+        if (entries.empty() && dropped == 0) {
+            return;
+        }
+
+        HANDLESCOPE
+
+        std::vector<ValueType> values;
+        values.reserve(entries.size());
+        for (auto &entry : entries) {
+            ObjectType value = Object::create_empty(protected_ctx);
+            Object::set_property(protected_ctx, value, "level", Value::from_string(protected_ctx, log_level_name(entry.level)));
+            Object::set_property(protected_ctx, value, "message", Value::from_string(protected_ctx, entry.message));
+            values.push_back(value);
+        }
+
+        ValueType callback_arguments[2];
+        callback_arguments[0] = Object::create_array(protected_ctx, values);
+        callback_arguments[1] = Value::from_number(protected_ctx, double(dropped));
+        Function::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
+    });
+
+    // Installed again in case Realm.clearTestState() has reset the sync manager since create_constructor().
+    SyncManager::shared().set_logger_factory(SyncSinkLoggerFactory::shared());
+    SyncLogSink::shared().set_target(level, capacity, std::move(deliver));
 }
 
 template<typename T>
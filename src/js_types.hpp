@@ -21,11 +21,15 @@
 #include "execution_context_id.hpp"
 #include "property.hpp"
 
+#include <iterator>
+#include <list>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <realm/binary_data.hpp>
+#include <realm/string_data.hpp>
 #include <realm/util/to_string.hpp>
 
 #if defined(__GNUC__) && !(defined(DEBUG) && DEBUG)
@@ -55,6 +59,12 @@ inline PropertyAttributes operator|(PropertyAttributes a, PropertyAttributes b)
     return PropertyAttributes(static_cast<unsigned>(a) | static_cast<unsigned>(b));
 }
 
+// The element types of the typed arrays created by Object::create_typed_array().
+enum class TypedArrayType {
+    Uint32,     // Uint32Array, with uint32_t elements.
+    Float64,    // Float64Array, with double elements.
+};
+
 template<typename T>
 struct String {
     using StringType = typename T::String;
@@ -122,6 +132,7 @@ struct Value {
     static ValueType from_null(ContextType);
     static ValueType from_number(ContextType, double);
     static ValueType from_string(ContextType, const String<T> &);
+    static ValueType from_string_data(ContextType, StringData);
     static ValueType from_binary(ContextType, BinaryData);
     static ValueType from_undefined(ContextType);
 
@@ -135,6 +146,14 @@ struct Value {
     static String<T> to_string(ContextType, const ValueType &);
     static OwnedBinaryData to_binary(ContextType, ValueType);
 
+    // Returns the bytes of `value` without copying them when the engine exposes its buffers directly.
+    // The result only stays valid while `value` is alive; `buffer` holds a copy when one is needed.
+    static BinaryData to_binary_data(ContextType, ValueType, OwnedBinaryData &buffer);
+
+    // Writes the UTF-8 encoding of the string `value` into `buffer`, reusing its capacity, and returns a
+    // view of it. The result only stays valid until `buffer` is modified.
+    static StringData to_string_data(ContextType, const ValueType &, std::string &buffer);
+
 #define VALIDATED(return_t, type) \
     static return_t validated_to_##type(ContextType ctx, const ValueType &value, const char *name = nullptr) { \
         if (!is_##type(ctx, value)) { \
@@ -268,9 +287,18 @@ struct Object {
 
     static ObjectType create_date(ContextType, double);
 
+    // Creates a typed array of `count` elements copied from `elements`, which are of the array's element type.
+    static ObjectType create_typed_array(ContextType, TypedArrayType, const void *elements, size_t count);
+
     template<typename ClassType>
     static ObjectType create_instance(ContextType, typename ClassType::Internal*);
 
+    // Creates an instance whose named properties are not intercepted by the class string accessor,
+    // so they can be provided by its prototype instead. Only available where has_instances_without_interceptors().
+    template<typename ClassType>
+    static ObjectType create_instance_without_interceptors(ContextType, typename ClassType::Internal*);
+    static bool has_instances_without_interceptors();
+
     template<typename ClassType>
     static bool is_instance(ContextType, const ObjectType &);
 
@@ -292,6 +320,89 @@ class Protected {
     struct Comparator {
         bool operator()(const Protected<ValueType>& a, const Protected<ValueType>& b) const;
     };
+
+    // Hashes objects by identity, consistently with Comparator.
+    struct Hasher {
+        size_t operator()(const Protected<ValueType>& a) const;
+    };
+};
+
+// The callbacks registered with something that can be listened to, each with a payload such as its
+// notification token. They are kept in the order they were added, and are looked up by identity in
+// constant time, so adding and removing listeners doesn't get slower the more of them there are.
+template<typename T, typename Payload>
+class CallbackRegistry {
+    using FunctionType = typename T::Function;
+    using ProtectedFunction = Protected<FunctionType>;
+    using Entries = std::list<std::pair<ProtectedFunction, Payload>>;
+    // Keyed by hash rather than by function so that each callback is only protected once.
+    using Index = std::unordered_multimap<size_t, typename Entries::iterator>;
+
+  public:
+    using const_iterator = typename Entries::const_iterator;
+
+    CallbackRegistry() = default;
+    CallbackRegistry(CallbackRegistry &&) = default;
+    CallbackRegistry &operator=(CallbackRegistry &&) = default;
+
+    bool empty() const { return m_entries.empty(); }
+    size_t size() const { return m_entries.size(); }
+    const_iterator begin() const { return m_entries.begin(); }
+    const_iterator end() const { return m_entries.end(); }
+
+    bool contains(const ProtectedFunction &callback) const {
+        auto range = m_index.equal_range(typename ProtectedFunction::Hasher()(callback));
+        typename ProtectedFunction::Comparator compare;
+        for (auto it = range.first; it != range.second; ++it) {
+            if (compare(it->second->first, callback)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void add(ProtectedFunction callback, Payload payload) {
+        size_t hash = typename ProtectedFunction::Hasher()(callback);
+        m_entries.emplace_back(std::move(callback), std::move(payload));
+        m_index.emplace(hash, std::prev(m_entries.end()));
+    }
+
+    // Removes every registration of `callback`, returning how many there were.
+    size_t remove(const ProtectedFunction &callback) {
+        auto range = m_index.equal_range(typename ProtectedFunction::Hasher()(callback));
+        typename ProtectedFunction::Comparator compare;
+        size_t count = 0;
+        for (auto it = range.first; it != range.second;) {
+            if (compare(it->second->first, callback)) {
+                m_entries.erase(it->second);
+                it = m_index.erase(it);
+                ++count;
+            }
+            else {
+                ++it;
+            }
+        }
+        return count;
+    }
+
+    void clear() {
+        m_index.clear();
+        m_entries.clear();
+    }
+
+    // Callbacks may add or remove listeners, so notifications go to a copy of the current callbacks.
+    std::vector<ProtectedFunction> callbacks() const {
+        std::vector<ProtectedFunction> callbacks;
+        callbacks.reserve(m_entries.size());
+        for (auto &entry : m_entries) {
+            callbacks.push_back(entry.first);
+        }
+        return callbacks;
+    }
+
+  private:
+    Entries m_entries;
+    Index m_index;
 };
 
 template<typename T>
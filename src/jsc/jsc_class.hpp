@@ -140,6 +140,13 @@ inline JSClassRef ObjectWrap<ClassType>::create_class() {
         definition.staticValues = properties.data();
     }
 
+    auto &registry = js::CallStatsRegistry::shared();
+    registry.register_entry_point(s_class.index_accessor.getter, s_class.name + "[index]");
+    registry.register_entry_point(s_class.index_accessor.setter, s_class.name + "[index]=");
+    registry.register_entry_point(s_class.string_accessor.getter, s_class.name + "[name]");
+    registry.register_entry_point(s_class.string_accessor.setter, s_class.name + "[name]=");
+    registry.register_entry_point(s_class.string_accessor.enumerator, s_class.name + "[names]");
+
     if (s_class.index_accessor.getter || s_class.string_accessor.getter) {
         definition.getProperty = get_property;
         definition.setProperty = set_property;
@@ -193,6 +200,7 @@ inline std::vector<JSStaticFunction> ObjectWrap<ClassType>::get_methods(const Me
     size_t index = 0;
 
     for (auto &pair : methods) {
+        js::CallStatsRegistry::shared().register_entry_point(pair.second, s_class.name + "." + pair.first);
         functions[index++] = {pair.first.c_str(), pair.second, attributes};
     }
 
@@ -210,6 +218,8 @@ inline std::vector<JSStaticValue> ObjectWrap<ClassType>::get_properties(const Pr
 
     for (auto &pair : properties) {
         auto &prop = pair.second;
+        js::CallStatsRegistry::shared().register_entry_point(prop.getter, s_class.name + "." + pair.first);
+        js::CallStatsRegistry::shared().register_entry_point(prop.setter, s_class.name + "." + pair.first + "=");
         values[index++] = {pair.first.c_str(), prop.getter, prop.setter ?: set_readonly_property, attributes};
     }
 
@@ -282,7 +292,7 @@ template<typename ClassType>
 inline void ObjectWrap<ClassType>::get_property_names(JSContextRef ctx, JSObjectRef object, JSPropertyNameAccumulatorRef accumulator) {
     if (s_class.index_accessor.getter) {
         try {
-            uint32_t length = Object::validated_get_length(ctx, object);
+            uint32_t length = std::min<uint32_t>(Object::validated_get_length(ctx, object), js::collection_enumeration_limit());
             char string[32];
             for (uint32_t i = 0; i < length; i++) {
                 sprintf(string, "%u", i);
@@ -358,6 +368,7 @@ class ObjectWrap<jsc::Types, ClassType> : public jsc::ObjectWrap<ClassType> {};
 
 template<jsc::MethodType F>
 JSValueRef wrap(JSContextRef ctx, JSObjectRef function, JSObjectRef this_object, size_t argc, const JSValueRef arguments[], JSValueRef* exception) {
+    js::CallTimer timer(static_cast<JSObjectCallAsFunctionCallback>(wrap<F>));
     jsc::ReturnValue return_value(ctx);
     try {
         F(ctx, function, this_object, argc, arguments, return_value);
@@ -371,6 +382,7 @@ JSValueRef wrap(JSContextRef ctx, JSObjectRef function, JSObjectRef this_object,
 
 template<jsc::PropertyType::GetterType F>
 JSValueRef wrap(JSContextRef ctx, JSObjectRef object, JSStringRef property, JSValueRef* exception) {
+    js::CallTimer timer(static_cast<JSObjectGetPropertyCallback>(wrap<F>));
     jsc::ReturnValue return_value(ctx);
     try {
         F(ctx, object, return_value);
@@ -384,6 +396,7 @@ JSValueRef wrap(JSContextRef ctx, JSObjectRef object, JSStringRef property, JSVa
 
 template<jsc::PropertyType::SetterType F>
 bool wrap(JSContextRef ctx, JSObjectRef object, JSStringRef property, JSValueRef value, JSValueRef* exception) {
+    js::CallTimer timer(static_cast<JSObjectSetPropertyCallback>(wrap<F>));
     try {
         F(ctx, object, value);
         return true;
@@ -396,6 +409,7 @@ bool wrap(JSContextRef ctx, JSObjectRef object, JSStringRef property, JSValueRef
 
 template<jsc::IndexPropertyType::GetterType F>
 JSValueRef wrap(JSContextRef ctx, JSObjectRef object, uint32_t index, JSValueRef* exception) {
+    js::CallTimer timer(static_cast<jsc::Types::IndexPropertyGetterCallback>(wrap<F>));
     jsc::ReturnValue return_value(ctx);
     try {
         F(ctx, object, index, return_value);
@@ -413,6 +427,7 @@ JSValueRef wrap(JSContextRef ctx, JSObjectRef object, uint32_t index, JSValueRef
 
 template<jsc::IndexPropertyType::SetterType F>
 bool wrap(JSContextRef ctx, JSObjectRef object, uint32_t index, JSValueRef value, JSValueRef* exception) {
+    js::CallTimer timer(static_cast<jsc::Types::IndexPropertySetterCallback>(wrap<F>));
     try {
         return F(ctx, object, index, value);
     }
@@ -424,6 +439,7 @@ bool wrap(JSContextRef ctx, JSObjectRef object, uint32_t index, JSValueRef value
 
 template<jsc::StringPropertyType::GetterType F>
 JSValueRef wrap(JSContextRef ctx, JSObjectRef object, JSStringRef property, JSValueRef* exception) {
+    js::CallTimer timer(static_cast<JSObjectGetPropertyCallback>(wrap<F>));
     jsc::ReturnValue return_value(ctx);
     try {
         F(ctx, object, property, return_value);
@@ -437,6 +453,7 @@ JSValueRef wrap(JSContextRef ctx, JSObjectRef object, JSStringRef property, JSVa
 
 template<jsc::StringPropertyType::SetterType F>
 bool wrap(JSContextRef ctx, JSObjectRef object, JSStringRef property, JSValueRef value, JSValueRef* exception) {
+    js::CallTimer timer(static_cast<JSObjectSetPropertyCallback>(wrap<F>));
     try {
         return F(ctx, object, property, value);
     }
@@ -448,6 +465,7 @@ bool wrap(JSContextRef ctx, JSObjectRef object, JSStringRef property, JSValueRef
 
 template<jsc::StringPropertyType::EnumeratorType F>
 void wrap(JSContextRef ctx, JSObjectRef object, JSPropertyNameAccumulatorRef accumulator) {
+    js::CallTimer timer(static_cast<JSObjectGetPropertyNamesCallback>(wrap<F>));
     auto names = F(ctx, object);
     for (auto &name : names) {
         JSPropertyNameAccumulatorAddName(accumulator, name);
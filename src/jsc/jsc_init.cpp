@@ -40,4 +40,8 @@ void RJSInitializeInContext(JSContextRef ctx) {
     jsc::Object::set_property(ctx, global_object, realm_string, realm_constructor, js::ReadOnly | js::DontEnum | js::DontDelete);
 }
 
+void RJSCloseRealmsFromPreviousContexts() {
+    js::close_realms_for_reload();
+}
+
 } // extern "C"
@@ -27,6 +27,10 @@ extern "C" {
 JSObjectRef RJSConstructorCreate(JSContextRef ctx);
 void RJSInitializeInContext(JSContextRef ctx);
 
+// Closes the Realms opened by earlier JS contexts, which must not be used again. This should be called before
+// initializing a new context after a reload.
+void RJSCloseRealmsFromPreviousContexts(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -118,12 +118,59 @@ inline JSObjectRef jsc::Object::create_date(JSContextRef ctx, double time) {
     return JSObjectMakeDate(ctx, 1, &number, nullptr);
 }
 
+template<>
+inline JSObjectRef jsc::Object::create_typed_array(JSContextRef ctx, TypedArrayType type, const void *elements, size_t count) {
+    bool is_uint32 = type == TypedArrayType::Uint32;
+    JSValueRef exception = nullptr;
+
+#if defined(__APPLE__)
+    // The typed array API is weakly linked, as it is only available from iOS 10 and macOS 10.12.
+    if (JSObjectMakeTypedArray != nullptr) {
+        JSObjectRef array = JSObjectMakeTypedArray(ctx, is_uint32 ? kJSTypedArrayTypeUint32Array : kJSTypedArrayTypeFloat64Array, count, &exception);
+        void *bytes = exception ? nullptr : JSObjectGetTypedArrayBytesPtr(ctx, array, &exception);
+        if (exception) {
+            throw jsc::Exception(ctx, exception);
+        }
+        if (count) {
+            memcpy(bytes, elements, count * (is_uint32 ? sizeof(uint32_t) : sizeof(double)));
+        }
+        return array;
+    }
+#endif
+
+    // Older JavaScriptCore versions, including the one React Native bundles on Android, can only set the elements one by one.
+    static jsc::String s_uint32_array = "Uint32Array";
+    static jsc::String s_float64_array = "Float64Array";
+    JSObjectRef constructor = jsc::Object::validated_get_constructor(ctx, JSContextGetGlobalObject(ctx), is_uint32 ? s_uint32_array : s_float64_array);
+    JSValueRef length = jsc::Value::from_number(ctx, count);
+    JSObjectRef array = jsc::Function::construct(ctx, constructor, 1, &length);
+    for (size_t i = 0; i < count; i++) {
+        double value = is_uint32 ? static_cast<const uint32_t *>(elements)[i] : static_cast<const double *>(elements)[i];
+        jsc::Object::set_property(ctx, array, (uint32_t)i, jsc::Value::from_number(ctx, value));
+    }
+    return array;
+}
+
 template<>
 template<typename ClassType>
 inline JSObjectRef jsc::Object::create_instance(JSContextRef ctx, typename ClassType::Internal* internal) {
     return jsc::ObjectWrap<ClassType>::create_instance(ctx, internal);
 }
 
+template<>
+template<typename ClassType>
+inline JSObjectRef jsc::Object::create_instance_without_interceptors(JSContextRef ctx, typename ClassType::Internal* internal) {
+    return jsc::ObjectWrap<ClassType>::create_instance(ctx, internal);
+}
+
+// The class callbacks of an instance are always consulted by JavaScriptCore before its prototype, which would
+// never be reached for the properties the callbacks know about. They don't hold up optimization the way V8
+// interceptors do either.
+template<>
+inline bool jsc::Object::has_instances_without_interceptors() {
+    return false;
+}
+
 template<>
 template<typename ClassType>
 inline bool jsc::Object::is_instance(JSContextRef ctx, const JSObjectRef &object) {
@@ -91,6 +91,13 @@ class Protected<JSValueRef> {
             return JSValueIsStrictEqual(a.m_context, a.m_value, b.m_value);
         }
     };
+
+    // JavaScriptCore doesn't move objects, so their addresses identify them.
+    struct Hasher {
+        size_t operator()(const Protected<JSValueRef>& a) const {
+            return std::hash<JSValueRef>()(a.m_value);
+        }
+    };
     
     Protected<JSValueRef>& operator=(Protected<JSValueRef> other) {
         std::swap(m_context, other.m_context);
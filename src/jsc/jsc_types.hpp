@@ -21,6 +21,9 @@
 #include <JavaScriptCore/JSContextRef.h>
 #include <JavaScriptCore/JSObjectRef.h>
 #include <JavaScriptCore/JSStringRef.h>
+#if defined(__APPLE__)
+#include <JavaScriptCore/JSTypedArray.h>
+#endif
 
 #include "js_types.hpp"
 
@@ -128,6 +128,12 @@ inline JSValueRef jsc::Value::from_string(JSContextRef ctx, const jsc::String &s
     return JSValueMakeString(ctx, string);
 }
 
+template<>
+inline JSValueRef jsc::Value::from_string_data(JSContextRef ctx, StringData string) {
+    // JSStringCreateWithUTF8CString needs a null-terminated copy, as StringData may not be terminated.
+    return JSValueMakeString(ctx, jsc::String(std::string(string.data() ? string.data() : "", string.size())));
+}
+
 template<>
 inline JSValueRef jsc::Value::from_undefined(JSContextRef ctx) {
     return JSValueMakeUndefined(ctx);
@@ -168,6 +174,20 @@ inline jsc::String jsc::Value::to_string(JSContextRef ctx, const JSValueRef &val
     return string;
 }
 
+template<>
+inline StringData jsc::Value::to_string_data(JSContextRef ctx, const JSValueRef &value, std::string &buffer) {
+    JSValueRef exception = nullptr;
+    JSStringRef string = JSValueToStringCopy(ctx, value, &exception);
+    if (exception) {
+        throw jsc::Exception(ctx, exception);
+    }
+
+    buffer.resize(JSStringGetMaximumUTF8CStringSize(string));
+    buffer.resize(JSStringGetUTF8CString(string, &buffer[0], buffer.size()) - 1);
+    JSStringRelease(string);
+    return StringData(buffer.data(), buffer.size());
+}
+
 template<>
 inline JSObjectRef jsc::Value::to_object(JSContextRef ctx, const JSValueRef &value) {
     JSValueRef exception = nullptr;
@@ -201,5 +221,50 @@ inline JSObjectRef jsc::Value::to_function(JSContextRef ctx, const JSValueRef &v
 template<>
 OwnedBinaryData jsc::Value::to_binary(JSContextRef ctx, JSValueRef value);
 
+template<>
+inline BinaryData jsc::Value::to_binary_data(JSContextRef ctx, JSValueRef value, OwnedBinaryData &buffer) {
+#if defined(__APPLE__)
+    // The typed array API is weakly linked, as it is only available from iOS 10 and macOS 10.12. Its pointers
+    // stay valid until the next call into JavaScriptCore, which the write the bytes are unboxed for doesn't make.
+    if (JSValueGetTypedArrayType != nullptr) {
+        // BinaryData with a null pointer means null, so empty values need a non-null pointer.
+        static const char placeholder = 0;
+        auto make_binary_data = [](const void *data, size_t length) {
+            return BinaryData(data ? static_cast<const char *>(data) : &placeholder, length);
+        };
+
+        JSValueRef exception = nullptr;
+        JSTypedArrayType type = JSValueGetTypedArrayType(ctx, value, &exception);
+        JSObjectRef object = type != kJSTypedArrayTypeNone ? JSValueToObject(ctx, value, &exception) : nullptr;
+        if (exception) {
+            throw jsc::Exception(ctx, exception);
+        }
+        if (type == kJSTypedArrayTypeArrayBuffer) {
+            void *bytes = JSObjectGetArrayBufferBytesPtr(ctx, object, &exception);
+            size_t length = exception ? 0 : JSObjectGetArrayBufferByteLength(ctx, object, &exception);
+            if (exception) {
+                throw jsc::Exception(ctx, exception);
+            }
+            return make_binary_data(bytes, length);
+        }
+        if (type != kJSTypedArrayTypeNone) {
+            // The bytes pointer is the start of the underlying buffer rather than of the view.
+            char *bytes = static_cast<char *>(JSObjectGetTypedArrayBytesPtr(ctx, object, &exception));
+            size_t offset = exception ? 0 : JSObjectGetTypedArrayByteOffset(ctx, object, &exception);
+            size_t length = exception ? 0 : JSObjectGetTypedArrayByteLength(ctx, object, &exception);
+            if (exception) {
+                throw jsc::Exception(ctx, exception);
+            }
+            return make_binary_data(bytes ? bytes + offset : nullptr, length);
+        }
+    }
+#endif
+
+    // Older JavaScriptCore versions, including the one React Native bundles on Android, and DataViews,
+    // which the typed array API doesn't cover, can only be read one byte at a time into a copy.
+    buffer = to_binary(ctx, value);
+    return buffer.get();
+}
+
 } // js
 } // realm
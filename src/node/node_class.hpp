@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "node_types.hpp"
 
 #include "js_class.hpp"
@@ -43,12 +45,19 @@ class ObjectWrap : public Nan::ObjectWrap {
   public:
     static v8::Local<v8::Function> create_constructor(v8::Isolate*);
     static v8::Local<v8::Object> create_instance(v8::Isolate*, Internal* = nullptr);
+    static v8::Local<v8::Object> create_instance_without_interceptors(v8::Isolate*, Internal* = nullptr);
 
     static v8::Local<v8::FunctionTemplate> get_template() {
         static Nan::Persistent<v8::FunctionTemplate> js_template(create_template());
         return Nan::New(js_template);
     }
 
+    // Inherits from the class template, so has_instance() holds for its instances, but has no interceptors.
+    static v8::Local<v8::FunctionTemplate> get_template_without_interceptors() {
+        static Nan::Persistent<v8::FunctionTemplate> js_template(create_template_without_interceptors());
+        return Nan::New(js_template);
+    }
+
     static void construct(const v8::FunctionCallbackInfo<v8::Value>&);
 
     static bool has_instance(v8::Isolate* isolate, const v8::Local<v8::Value> &value) {
@@ -74,6 +83,7 @@ class ObjectWrap : public Nan::ObjectWrap {
     ObjectWrap(Internal* object = nullptr) : m_object(object) {}
 
     static v8::Local<v8::FunctionTemplate> create_template();
+    static v8::Local<v8::FunctionTemplate> create_template_without_interceptors();
 
     static void setup_method(v8::Local<v8::FunctionTemplate>, const std::string &, v8::FunctionCallback);
     static void setup_static_method(v8::Local<v8::FunctionTemplate>, const std::string &, v8::FunctionCallback);
@@ -109,18 +119,35 @@ class ObjectWrap<void> {
     }
 };
 
-// This helper function is needed outside the scope of the ObjectWrap class as well.
-static inline std::vector<v8::Local<v8::Value>> get_arguments(const v8::FunctionCallbackInfo<v8::Value> &info) {
-    int count = info.Length();
-    std::vector<v8::Local<v8::Value>> arguments;
-    arguments.reserve(count);
+// Copies the arguments of a call into a contiguous array, as expected by the method callbacks.
+// This is needed outside the scope of the ObjectWrap class as well. Calls with only a few arguments,
+// which are nearly all of them, keep them on the stack so no allocation is made per call.
+class Arguments {
+  public:
+    static const int inline_capacity = 8;
 
-    for (int i = 0; i < count; i++) {
-        arguments.push_back(info[i]);
+    Arguments(const v8::FunctionCallbackInfo<v8::Value> &info) : m_count(info.Length()), m_values(m_inline) {
+        if (m_count > inline_capacity) {
+            m_heap.reset(new v8::Local<v8::Value>[m_count]);
+            m_values = m_heap.get();
+        }
+        for (int i = 0; i < m_count; i++) {
+            m_values[i] = info[i];
+        }
     }
-    
-    return arguments;
-}
+
+    Arguments(const Arguments &) = delete;
+    Arguments &operator=(const Arguments &) = delete;
+
+    size_t size() const { return m_count; }
+    const v8::Local<v8::Value> *data() const { return m_values; }
+
+  private:
+    int m_count;
+    v8::Local<v8::Value> m_inline[inline_capacity];
+    std::unique_ptr<v8::Local<v8::Value>[]> m_heap;
+    v8::Local<v8::Value> *m_values;
+};
 
 // The static class variable must be defined as well.
 template<typename ClassType>
@@ -153,6 +180,31 @@ inline v8::Local<v8::Object> ObjectWrap<ClassType>::create_instance(v8::Isolate*
     return scope.Escape(instance);
 }
 
+template<typename ClassType>
+inline v8::Local<v8::Object> ObjectWrap<ClassType>::create_instance_without_interceptors(v8::Isolate* isolate, Internal* internal) {
+    Nan::EscapableHandleScope scope;
+
+    v8::Local<v8::FunctionTemplate> tpl = get_template_without_interceptors();
+    v8::Local<v8::Object> instance = Nan::NewInstance(tpl->InstanceTemplate()).ToLocalChecked();
+
+    auto wrap = new ObjectWrap<ClassType>(internal);
+    wrap->Wrap(instance);
+
+    return scope.Escape(instance);
+}
+
+template<typename ClassType>
+inline v8::Local<v8::FunctionTemplate> ObjectWrap<ClassType>::create_template_without_interceptors() {
+    Nan::EscapableHandleScope scope;
+
+    v8::Local<v8::FunctionTemplate> tpl = v8::FunctionTemplate::New(v8::Isolate::GetCurrent());
+    tpl->SetClassName(Nan::New(s_class.name).ToLocalChecked());
+    tpl->InstanceTemplate()->SetInternalFieldCount(1);
+    tpl->Inherit(get_template());
+
+    return scope.Escape(tpl);
+}
+
 template<typename ClassType>
 inline v8::Local<v8::FunctionTemplate> ObjectWrap<ClassType>::create_template() {
     Nan::EscapableHandleScope scope;
@@ -182,11 +234,16 @@ inline v8::Local<v8::FunctionTemplate> ObjectWrap<ClassType>::create_template()
 
     if (s_class.index_accessor.getter) {
         auto &index_accessor = s_class.index_accessor;
+        js::CallStatsRegistry::shared().register_entry_point(index_accessor.getter, s_class.name + "[index]");
+        js::CallStatsRegistry::shared().register_entry_point(index_accessor.setter, s_class.name + "[index]=");
         instance_tpl->SetIndexedPropertyHandler(index_accessor.getter, index_accessor.setter ? index_accessor.setter : set_readonly_index, 0, 0, get_indexes);
     }
     if (s_class.string_accessor.getter || s_class.index_accessor.getter || s_class.index_accessor.setter) {
         // Use our own wrapper for the setter since we want to throw for negative indices.
         auto &string_accessor = s_class.string_accessor;
+        js::CallStatsRegistry::shared().register_entry_point(string_accessor.getter, s_class.name + "[name]");
+        js::CallStatsRegistry::shared().register_entry_point(string_accessor.setter, s_class.name + "[name]=");
+        js::CallStatsRegistry::shared().register_entry_point(string_accessor.enumerator, s_class.name + "[names]");
         instance_tpl->SetNamedPropertyHandler(string_accessor.getter ? string_accessor.getter : get_nonexistent_property, set_property, 0, 0, string_accessor.enumerator);
     }
 
@@ -195,6 +252,8 @@ inline v8::Local<v8::FunctionTemplate> ObjectWrap<ClassType>::create_template()
 
 template<typename ClassType>
 inline void ObjectWrap<ClassType>::setup_method(v8::Local<v8::FunctionTemplate> tpl, const std::string &name, v8::FunctionCallback callback) {
+    js::CallStatsRegistry::shared().register_entry_point(callback, s_class.name + "." + name);
+
     v8::Local<v8::Signature> signature = Nan::New<v8::Signature>(tpl);
     v8::Local<v8::FunctionTemplate> fn_tpl = v8::FunctionTemplate::New(v8::Isolate::GetCurrent(), callback, v8::Local<v8::Value>(), signature);
     v8::Local<v8::String> fn_name = Nan::New(name).ToLocalChecked();
@@ -206,6 +265,8 @@ inline void ObjectWrap<ClassType>::setup_method(v8::Local<v8::FunctionTemplate>
 
 template<typename ClassType>
 inline void ObjectWrap<ClassType>::setup_static_method(v8::Local<v8::FunctionTemplate> tpl, const std::string &name, v8::FunctionCallback callback) {
+    js::CallStatsRegistry::shared().register_entry_point(callback, s_class.name + "." + name);
+
     v8::Local<v8::FunctionTemplate> fn_tpl = v8::FunctionTemplate::New(v8::Isolate::GetCurrent(), callback);
     v8::Local<v8::String> fn_name = Nan::New(name).ToLocalChecked();
 
@@ -216,6 +277,9 @@ inline void ObjectWrap<ClassType>::setup_static_method(v8::Local<v8::FunctionTem
 template<typename ClassType>
 template<typename TargetType>
 inline void ObjectWrap<ClassType>::setup_property(v8::Local<TargetType> target, const std::string &name, const PropertyType &property) {
+    js::CallStatsRegistry::shared().register_entry_point(property.getter, s_class.name + "." + name);
+    js::CallStatsRegistry::shared().register_entry_point(property.setter, s_class.name + "." + name + "=");
+
     v8::Local<v8::String> prop_name = Nan::New(name).ToLocalChecked();
     v8::PropertyAttribute attributes = v8::PropertyAttribute(v8::DontEnum | v8::DontDelete);
 
@@ -229,7 +293,7 @@ inline void ObjectWrap<ClassType>::construct(const v8::FunctionCallbackInfo<v8::
     }
     if (reinterpret_cast<void*>(s_class.constructor)) {
         auto isolate = info.GetIsolate();
-        auto arguments = get_arguments(info);
+        Arguments arguments(info);
         v8::Local<v8::Object> this_object = info.This();
         info.GetReturnValue().Set(this_object);
 
@@ -252,7 +316,7 @@ template<typename ClassType>
 inline void ObjectWrap<ClassType>::get_indexes(const v8::PropertyCallbackInfo<v8::Array>& info) {
     uint32_t length;
     try {
-        length = Object::validated_get_length(info.GetIsolate(), info.This());
+        length = std::min<uint32_t>(Object::validated_get_length(info.GetIsolate(), info.This()), js::collection_enumeration_limit());
     }
     catch (std::exception &) {
         // Enumerating properties should never throw an exception.
@@ -296,9 +360,10 @@ class ObjectWrap<node::Types, ClassType> : public node::ObjectWrap<ClassType> {}
 
 template<node::MethodType F>
 void wrap(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    js::CallTimer timer(static_cast<v8::FunctionCallback>(wrap<F>));
     v8::Isolate* isolate = info.GetIsolate();
     node::ReturnValue return_value(info.GetReturnValue());
-    auto arguments = node::get_arguments(info);
+    node::Arguments arguments(info);
 
     try {
         F(isolate, info.Callee(), info.This(), arguments.size(), arguments.data(), return_value);
@@ -310,6 +375,7 @@ void wrap(const v8::FunctionCallbackInfo<v8::Value>& info) {
 
 template<node::PropertyType::GetterType F>
 void wrap(v8::Local<v8::String> property, const v8::PropertyCallbackInfo<v8::Value>& info) {
+    js::CallTimer timer(static_cast<v8::AccessorGetterCallback>(wrap<F>));
     v8::Isolate* isolate = info.GetIsolate();
     node::ReturnValue return_value(info.GetReturnValue());
     try {
@@ -322,6 +388,7 @@ void wrap(v8::Local<v8::String> property, const v8::PropertyCallbackInfo<v8::Val
 
 template<node::PropertyType::SetterType F>
 void wrap(v8::Local<v8::String> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& info) {
+    js::CallTimer timer(static_cast<v8::AccessorSetterCallback>(wrap<F>));
     v8::Isolate* isolate = info.GetIsolate();
     try {
         F(isolate, info.This(), value);
@@ -333,6 +400,7 @@ void wrap(v8::Local<v8::String> property, v8::Local<v8::Value> value, const v8::
 
 template<node::IndexPropertyType::GetterType F>
 void wrap(uint32_t index, const v8::PropertyCallbackInfo<v8::Value>& info) {
+    js::CallTimer timer(static_cast<v8::IndexedPropertyGetterCallback>(wrap<F>));
     v8::Isolate* isolate = info.GetIsolate();
     node::ReturnValue return_value(info.GetReturnValue());
     try {
@@ -349,6 +417,7 @@ void wrap(uint32_t index, const v8::PropertyCallbackInfo<v8::Value>& info) {
 
 template<node::IndexPropertyType::SetterType F>
 void wrap(uint32_t index, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<v8::Value>& info) {
+    js::CallTimer timer(static_cast<v8::IndexedPropertySetterCallback>(wrap<F>));
     v8::Isolate* isolate = info.GetIsolate();
     try {
         if (F(isolate, info.This(), index, value)) {
@@ -363,6 +432,7 @@ void wrap(uint32_t index, v8::Local<v8::Value> value, const v8::PropertyCallback
 
 template<node::StringPropertyType::GetterType F>
 void wrap(v8::Local<v8::String> property, const v8::PropertyCallbackInfo<v8::Value>& info) {
+    js::CallTimer timer(static_cast<v8::NamedPropertyGetterCallback>(wrap<F>));
     v8::Isolate* isolate = info.GetIsolate();
     node::ReturnValue return_value(info.GetReturnValue());
     try {
@@ -375,6 +445,7 @@ void wrap(v8::Local<v8::String> property, const v8::PropertyCallbackInfo<v8::Val
 
 template<node::StringPropertyType::SetterType F>
 void wrap(v8::Local<v8::String> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<v8::Value>& info) {
+    js::CallTimer timer(static_cast<v8::NamedPropertySetterCallback>(wrap<F>));
     v8::Isolate* isolate = info.GetIsolate();
     try {
         if (F(isolate, info.This(), property, value)) {
@@ -389,6 +460,7 @@ void wrap(v8::Local<v8::String> property, v8::Local<v8::Value> value, const v8::
 
 template<node::StringPropertyType::EnumeratorType F>
 void wrap(const v8::PropertyCallbackInfo<v8::Array>& info) {
+    js::CallTimer timer(static_cast<v8::NamedPropertyEnumeratorCallback>(wrap<F>));
     auto names = F(info.GetIsolate(), info.This());
     int count = (int)names.size();
     v8::Local<v8::Array> array = Nan::New<v8::Array>(count);
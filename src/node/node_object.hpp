@@ -130,12 +130,37 @@ inline v8::Local<v8::Object> node::Object::create_date(v8::Isolate* isolate, dou
     return Nan::New<v8::Date>(time).ToLocalChecked();
 }
 
+template<>
+inline v8::Local<v8::Object> node::Object::create_typed_array(v8::Isolate* isolate, TypedArrayType type, const void *elements, size_t count) {
+    size_t byte_count = count * (type == TypedArrayType::Uint32 ? sizeof(uint32_t) : sizeof(double));
+    v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(isolate, byte_count);
+    if (byte_count) {
+        memcpy(buffer->GetContents().Data(), elements, byte_count);
+    }
+
+    if (type == TypedArrayType::Uint32) {
+        return v8::Uint32Array::New(buffer, 0, count);
+    }
+    return v8::Float64Array::New(buffer, 0, count);
+}
+
 template<>
 template<typename ClassType>
 inline v8::Local<v8::Object> node::Object::create_instance(v8::Isolate* isolate, typename ClassType::Internal* internal) {
     return node::ObjectWrap<ClassType>::create_instance(isolate, internal);
 }
 
+template<>
+template<typename ClassType>
+inline v8::Local<v8::Object> node::Object::create_instance_without_interceptors(v8::Isolate* isolate, typename ClassType::Internal* internal) {
+    return node::ObjectWrap<ClassType>::create_instance_without_interceptors(isolate, internal);
+}
+
+template<>
+inline bool node::Object::has_instances_without_interceptors() {
+    return true;
+}
+
 template<>
 template<typename ClassType>
 inline bool node::Object::is_instance(v8::Isolate* isolate, const v8::Local<v8::Object> &object) {
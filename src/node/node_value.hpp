@@ -114,6 +114,15 @@ inline v8::Local<v8::Value> node::Value::from_string(v8::Isolate* isolate, const
     return v8::Local<v8::String>(string);
 }
 
+template<>
+inline v8::Local<v8::Value> node::Value::from_string_data(v8::Isolate* isolate, StringData string) {
+    // StringData isn't necessarily null-terminated, so the length has to be passed along.
+    if (string.size() == 0) {
+        return Nan::EmptyString();
+    }
+    return Nan::New(string.data(), (int)string.size()).ToLocalChecked();
+}
+
 template<>
 inline v8::Local<v8::Value> node::Value::from_binary(v8::Isolate* isolate, BinaryData data) {
     v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(isolate, data.size());
@@ -150,6 +159,17 @@ inline node::String node::Value::to_string(v8::Isolate* isolate, const v8::Local
     return value->ToString();
 }
 
+template<>
+inline StringData node::Value::to_string_data(v8::Isolate* isolate, const v8::Local<v8::Value> &value, std::string &buffer) {
+    v8::Local<v8::String> string = value->ToString();
+    int length = string->Utf8Length();
+    buffer.resize(length);
+    if (length) {
+        string->WriteUtf8(&buffer[0], length, nullptr, v8::String::NO_NULL_TERMINATION | v8::String::REPLACE_INVALID_UTF8);
+    }
+    return StringData(buffer.data(), buffer.size());
+}
+
 template<>
 inline OwnedBinaryData node::Value::to_binary(v8::Isolate* isolate, v8::Local<v8::Value> value) {
     // Make a non-null OwnedBinaryData, even when `data` is nullptr.
@@ -182,6 +202,32 @@ inline OwnedBinaryData node::Value::to_binary(v8::Isolate* isolate, v8::Local<v8
     }
 }
 
+template<>
+inline BinaryData node::Value::to_binary_data(v8::Isolate* isolate, v8::Local<v8::Value> value, OwnedBinaryData &buffer) {
+    // BinaryData with a null pointer means null, so empty values need a non-null pointer.
+    static const char placeholder = 0;
+    auto make_binary_data = [](const char* data, size_t length) {
+        return BinaryData(data ? data : &placeholder, length);
+    };
+
+    if (Value::is_array_buffer(isolate, value)) {
+        v8::ArrayBuffer::Contents contents = value.As<v8::ArrayBuffer>()->GetContents();
+        return make_binary_data(static_cast<char*>(contents.Data()), contents.ByteLength());
+    }
+    else if (Value::is_array_buffer_view(isolate, value)) {
+        v8::Local<v8::ArrayBufferView> array_buffer_view = value.As<v8::ArrayBufferView>();
+        v8::ArrayBuffer::Contents contents = array_buffer_view->Buffer()->GetContents();
+        const char* data = static_cast<char*>(contents.Data());
+        return make_binary_data(data ? data + array_buffer_view->ByteOffset() : nullptr, array_buffer_view->ByteLength());
+    }
+    else if (::node::Buffer::HasInstance(value)) {
+        return make_binary_data(::node::Buffer::Data(value), ::node::Buffer::Length(value));
+    }
+    else {
+        throw std::runtime_error("Can only convert Buffer, ArrayBuffer, and ArrayBufferView objects to binary");
+    }
+}
+
 template<>
 inline v8::Local<v8::Object> node::Value::to_object(v8::Isolate* isolate, const v8::Local<v8::Value> &value) {
     return Nan::To<v8::Object>(value).FromMaybe(v8::Local<v8::Object>());
@@ -40,6 +40,32 @@ struct FileSystemRequest : uv_fs_t {
     }
 };
 
+// A libuv loop of its own for file system requests that may be made off the main thread, where using the
+// default loop, even for synchronous requests, would race with Node's own use of it.
+class FileSystemLoop {
+public:
+    FileSystemLoop() {
+        int error = uv_loop_init(&m_loop);
+        if (error) {
+            throw UVException(static_cast<uv_errno_t>(error));
+        }
+    }
+
+    ~FileSystemLoop() {
+        uv_loop_close(&m_loop);
+    }
+
+    FileSystemLoop(const FileSystemLoop &) = delete;
+    FileSystemLoop &operator=(const FileSystemLoop &) = delete;
+
+    uv_loop_t *get() {
+        return &m_loop;
+    }
+
+private:
+    uv_loop_t m_loop;
+};
+
 // taken from Node.js: function Cwd in node.cc
 std::string default_realm_file_directory()
 {
@@ -83,14 +109,41 @@ void copy_bundled_realm_files()
     throw std::runtime_error("Realm for Node does not support this method.");
 }
 
+std::string bundled_realm_file_path(const std::string &)
+{
+    throw std::runtime_error("Realm for Node does not support bundled Realm files.");
+}
+
 inline bool ends_with(const std::string& str, const std::string& suffix) {
     return str.size() > suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
 }
 
-void remove_realm_files_from_directory(const std::string &dir_path)
+// Unlinks all of the given files at once on the libuv threadpool, waiting for them by running the given loop
+// rather than the default one. Files that are already gone are not an error.
+static void unlink_files(FileSystemLoop &loop, const std::vector<std::string> &paths)
+{
+    int error = 0;
+    std::vector<FileSystemRequest> requests(paths.size());
+    for (size_t i = 0; i < paths.size() && !error; i++) {
+        requests[i].data = &error;
+        error = uv_fs_unlink(loop.get(), &requests[i], paths[i].c_str(), [](uv_fs_t *req) {
+            int *error = static_cast<int *>(req->data);
+            if (req->result < 0 && req->result != UV_ENOENT && !*error) {
+                *error = static_cast<int>(req->result);
+            }
+        });
+    }
+
+    uv_run(loop.get(), UV_RUN_DEFAULT);
+    if (error) {
+        throw UVException(static_cast<uv_errno_t>(error));
+    }
+}
+
+static void scan_directory(FileSystemLoop &loop, const std::string &dir_path, std::vector<std::string> &files, std::vector<std::string> *management_dirs)
 {
     FileSystemRequest scandir_req;
-    if (uv_fs_scandir(uv_default_loop(), &scandir_req, dir_path.c_str(), 0, nullptr) < 0) {
+    if (uv_fs_scandir(loop.get(), &scandir_req, dir_path.c_str(), 0, nullptr) < 0) {
         throw UVException(static_cast<uv_errno_t>(scandir_req.result));
     }
 
@@ -100,38 +153,38 @@ void remove_realm_files_from_directory(const std::string &dir_path)
 
         if (entry.type == UV_DIRENT_DIR) {
             static std::string realm_management_extension(".realm.management");
-            if (ends_with(path, realm_management_extension)) {
-                uv_dirent_t management_entry;
-                FileSystemRequest management_scandir_req;
-                if (uv_fs_scandir(uv_default_loop(), &management_scandir_req, path.c_str(), 0, nullptr) < 0) {
-                    throw UVException(static_cast<uv_errno_t>(scandir_req.result));
-                }
-
-                while (uv_fs_scandir_next(&management_scandir_req, &management_entry) != UV_EOF) {
-                    std::string management_entry_path = path + '/' + management_entry.name;
-                    FileSystemRequest delete_req;
-                    if (uv_fs_unlink(uv_default_loop(), &delete_req, management_entry_path.c_str(), nullptr) != 0) {
-                        throw UVException(static_cast<uv_errno_t>(delete_req.result));
-                    }
-                }
-
-                FileSystemRequest management_rmdir_req;
-                if (uv_fs_rmdir(uv_default_loop(), &management_rmdir_req, path.c_str(), nullptr)) {
-                    throw UVException(static_cast<uv_errno_t>(management_rmdir_req.result));
-                }
+            if (management_dirs && ends_with(path, realm_management_extension)) {
+                scan_directory(loop, path, files, nullptr);
+                management_dirs->push_back(std::move(path));
             }
+        } else if (!management_dirs) {
+            // Everything in a management directory is removed.
+            files.push_back(std::move(path));
         } else {
             static std::string realm_extension(".realm");
             static std::string realm_note_extension(".realm.note");
             static std::string realm_lock_extension(".realm.lock");
             if (ends_with(path, realm_extension) || ends_with(path, realm_note_extension) || ends_with(path, realm_lock_extension)) {
-                FileSystemRequest delete_req;
-                if (uv_fs_unlink(uv_default_loop(), &delete_req, path.c_str(), nullptr) != 0) {
-                    throw UVException(static_cast<uv_errno_t>(delete_req.result));
-                }
+                files.push_back(std::move(path));
             }
         }
     }
 }
 
+// Also called from the thread Realm.deleteFilesAsync() starts, so none of this uses the default loop.
+void remove_realm_files_from_directory(const std::string &dir_path)
+{
+    FileSystemLoop loop;
+    std::vector<std::string> files, management_dirs;
+    scan_directory(loop, dir_path, files, &management_dirs);
+    unlink_files(loop, files);
+
+    for (auto &path : management_dirs) {
+        FileSystemRequest management_rmdir_req;
+        if (uv_fs_rmdir(loop.get(), &management_rmdir_req, path.c_str(), nullptr)) {
+            throw UVException(static_cast<uv_errno_t>(management_rmdir_req.result));
+        }
+    }
+}
+
 } // realm
@@ -38,6 +38,10 @@ void ensure_directory_exists_for_file(const std::string &file);
 // copy all realm files from resources directory to default realm dir
 void copy_bundled_realm_files();
 
+// return the path that the realm file with the given name in the resources directory can be opened
+// read-only at, copying only that file first on platforms where it can't be opened in place
+std::string bundled_realm_file_path(const std::string &name);
+
 // remove all realm files in the given directory
 void remove_realm_files_from_directory(const std::string &directory);
 
@@ -16,7 +16,9 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <dlfcn.h>
 #include <map>
 #include <string>
@@ -46,6 +48,212 @@ static const char * const RealmObjectTypesUser = "user";
 static const char * const RealmObjectTypesSession = "session";
 static const char * const RealmObjectTypesUndefined = "undefined";
 
+namespace {
+
+void write_msgpack_header(std::string &out, uint8_t type, uint64_t value, size_t bytes) {
+    out.push_back(type);
+    for (size_t i = bytes; i > 0; i--) {
+        out.push_back(char(value >> ((i - 1) * 8)));
+    }
+}
+
+void write_msgpack_length(std::string &out, size_t length, uint8_t fix_type, size_t fix_limit, uint8_t type8, uint8_t type16, uint8_t type32) {
+    if (length < fix_limit) {
+        out.push_back(char(fix_type | length));
+    }
+    else if (type8 && length <= 0xff) {
+        write_msgpack_header(out, type8, length, 1);
+    }
+    else if (length <= 0xffff) {
+        write_msgpack_header(out, type16, length, 2);
+    }
+    else {
+        write_msgpack_header(out, type32, length, 4);
+    }
+}
+
+void write_msgpack(std::string &out, const json &value, bool is_bytes = false) {
+    switch (value.type()) {
+        case json::value_t::null:
+        case json::value_t::discarded:
+            out.push_back(char(0xc0));
+            break;
+        case json::value_t::boolean:
+            out.push_back(char(value.get<bool>() ? 0xc3 : 0xc2));
+            break;
+        case json::value_t::number_integer: {
+            int64_t number = value.get<int64_t>();
+            if (number >= -32 && number <= 0x7f) {
+                out.push_back(char(number));
+            }
+            else if (number >= INT32_MIN && number <= INT32_MAX) {
+                write_msgpack_header(out, 0xd2, uint64_t(number), 4);
+            }
+            else {
+                write_msgpack_header(out, 0xd3, uint64_t(number), 8);
+            }
+            break;
+        }
+        case json::value_t::number_float: {
+            double number = value.get<double>();
+            uint64_t bits;
+            memcpy(&bits, &number, sizeof(bits));
+            write_msgpack_header(out, 0xcb, bits, 8);
+            break;
+        }
+        case json::value_t::string: {
+            const std::string &string = *value.get_ptr<const json::string_t *>();
+            if (is_bytes) {
+                write_msgpack_length(out, string.size(), 0, 0, 0xc4, 0xc5, 0xc6);
+            }
+            else {
+                write_msgpack_length(out, string.size(), 0xa0, 32, 0xd9, 0xda, 0xdb);
+            }
+            out.append(string);
+            break;
+        }
+        case json::value_t::array:
+            write_msgpack_length(out, value.size(), 0x90, 16, 0, 0xdc, 0xdd);
+            for (auto &item : value) {
+                write_msgpack(out, item);
+            }
+            break;
+        case json::value_t::object: {
+            // Only the bytes of a value tagged as data are binary; any other "bytes" key is a plain string.
+            auto type = value.find("type");
+            bool is_data = type != value.end() && type->is_string() && type->get<std::string>() == RealmObjectTypesData;
+
+            write_msgpack_length(out, value.size(), 0x80, 16, 0, 0xde, 0xdf);
+            for (auto it = value.begin(); it != value.end(); ++it) {
+                write_msgpack(out, it.key());
+                write_msgpack(out, it.value(), is_data && it.key() == "bytes");
+            }
+            break;
+        }
+    }
+}
+
+class MsgpackReader {
+    const char *m_data;
+    const char *m_end;
+
+    uint64_t read_uint(size_t bytes) {
+        if (size_t(m_end - m_data) < bytes) {
+            throw std::runtime_error("Truncated MessagePack data");
+        }
+        uint64_t value = 0;
+        for (size_t i = 0; i < bytes; i++) {
+            value = (value << 8) | uint8_t(*m_data++);
+        }
+        return value;
+    }
+
+    std::string read_string(size_t length) {
+        if (size_t(m_end - m_data) < length) {
+            throw std::runtime_error("Truncated MessagePack data");
+        }
+        std::string string(m_data, length);
+        m_data += length;
+        return string;
+    }
+
+    json read_array(size_t count) {
+        json array = json::array();
+        for (size_t i = 0; i < count; i++) {
+            array.push_back(read());
+        }
+        return array;
+    }
+
+    json read_object(size_t count) {
+        json object = json::object();
+        for (size_t i = 0; i < count; i++) {
+            json key = read();
+            if (!key.is_string()) {
+                throw std::runtime_error("MessagePack map keys must be strings");
+            }
+            object[key.get<std::string>()] = read();
+        }
+        return object;
+    }
+
+  public:
+    MsgpackReader(const char *data, size_t size) : m_data(data), m_end(data + size) {}
+
+    bool at_end() const { return m_data == m_end; }
+
+    json read() {
+        uint8_t type = uint8_t(read_uint(1));
+
+        if (type <= 0x7f) {
+            return int64_t(type);
+        }
+        if (type >= 0xe0) {
+            return int64_t(int8_t(type));
+        }
+        if ((type & 0xe0) == 0xa0) {
+            return read_string(type & 0x1f);
+        }
+        if ((type & 0xf0) == 0x90) {
+            return read_array(type & 0x0f);
+        }
+        if ((type & 0xf0) == 0x80) {
+            return read_object(type & 0x0f);
+        }
+
+        switch (type) {
+            case 0xc0: return nullptr;
+            case 0xc2: return false;
+            case 0xc3: return true;
+            case 0xc4: case 0xd9: return read_string(read_uint(1));
+            case 0xc5: case 0xda: return read_string(read_uint(2));
+            case 0xc6: case 0xdb: return read_string(read_uint(4));
+            case 0xca: {
+                uint32_t bits = uint32_t(read_uint(4));
+                float number;
+                memcpy(&number, &bits, sizeof(number));
+                return double(number);
+            }
+            case 0xcb: {
+                uint64_t bits = read_uint(8);
+                double number;
+                memcpy(&number, &bits, sizeof(number));
+                return number;
+            }
+            case 0xcc: return int64_t(read_uint(1));
+            case 0xcd: return int64_t(read_uint(2));
+            case 0xce: return int64_t(read_uint(4));
+            case 0xcf: return int64_t(read_uint(8));
+            case 0xd0: return int64_t(int8_t(read_uint(1)));
+            case 0xd1: return int64_t(int16_t(read_uint(2)));
+            case 0xd2: return int64_t(int32_t(read_uint(4)));
+            case 0xd3: return int64_t(read_uint(8));
+            case 0xdc: return read_array(read_uint(2));
+            case 0xdd: return read_array(read_uint(4));
+            case 0xde: return read_object(read_uint(2));
+            case 0xdf: return read_object(read_uint(4));
+        }
+        throw std::runtime_error("Unsupported MessagePack type");
+    }
+};
+
+} // anonymous namespace
+
+std::string realm::rpc::dump_msgpack(const json &value) {
+    std::string out;
+    write_msgpack(out, value);
+    return out;
+}
+
+json realm::rpc::parse_msgpack(const char *data, size_t size) {
+    MsgpackReader reader(data, size);
+    json value = reader.read();
+    if (!reader.at_end()) {
+        throw std::runtime_error("Unexpected data after MessagePack value");
+    }
+    return value;
+}
+
 static RPCServer*& get_rpc_server(JSGlobalContextRef ctx) {
     static std::map<JSGlobalContextRef, RPCServer*> s_map;
     return s_map[ctx];
@@ -54,8 +262,13 @@ static RPCServer*& get_rpc_server(JSGlobalContextRef ctx) {
 RPCWorker::RPCWorker() {
     m_thread = std::thread([this]() {
         // TODO: Create ALooper/CFRunLoop to support async calls.
-        while (!m_stop) {
-            try_run_task();
+        while (true) {
+            // Read the interrupt count first so a stop() after the check still ends the wait.
+            size_t count = interrupt_count();
+            if (m_stop) {
+                break;
+            }
+            run_task(count);
         }
     });
 }
@@ -76,9 +289,8 @@ json RPCWorker::pop_task_result() {
     return future.get();
 }
 
-void RPCWorker::try_run_task() {
-    // Use a 10 millisecond timeout to keep this thread unblocked.
-    auto task = m_tasks.try_pop_back(10);
+void RPCWorker::run_task(size_t interrupt_count) {
+    auto task = m_tasks.pop_back_interruptible(interrupt_count);
     if (!task) {
         return;
     }
@@ -92,11 +304,12 @@ void RPCWorker::try_run_task() {
 void RPCWorker::stop() {
     if (!m_stop) {
         m_stop = true;
+        interrupt();
         m_thread.join();
     }
 }
 
-RPCServer::RPCServer() {
+RPCServer::RPCServer(bool msgpack_supported) : m_msgpack_supported(msgpack_supported) {
     m_context = JSGlobalContextCreate(NULL);
     get_rpc_server(m_context) = this;
 
@@ -119,7 +332,12 @@ RPCServer::RPCServer() {
         jsc::Object::set_property(m_context, user_constructor, "_refreshAccessToken", refreshAccessTokenCallback);
 
         m_session_id = store_object(realm_constructor);
-        return (json){{"result", m_session_id}};
+
+        // The response to this request is always JSON, and tells the client what to send from now on.
+        json encodings = dict.count("encodings") ? dict["encodings"] : json::array();
+        m_uses_msgpack = m_msgpack_supported && std::find(encodings.begin(), encodings.end(), "msgpack") != encodings.end();
+
+        return (json){{"result", m_session_id}, {"encoding", m_uses_msgpack ? "msgpack" : "json"}};
     };
     m_requests["/create_realm"] = [this](const json dict) {
         JSObjectRef realm_constructor = m_session_id ? JSObjectRef(m_objects[m_session_id]) : NULL;
@@ -203,6 +421,39 @@ RPCServer::RPCServer() {
 
         return json::object();
     };
+    m_requests["/get_rows"] = [this](const json dict) {
+        JSObjectRef collection = m_objects[dict["id"].get<RPCObjectID>()];
+        uint32_t length = jsc::Object::validated_get_length(m_context, collection);
+        uint32_t start = dict["start"].get<uint32_t>();
+        uint32_t end = std::min(dict["end"].get<uint32_t>(), length);
+        json::array_t rows;
+
+        for (uint32_t i = start; i < end; i++) {
+            JSValueRef value = jsc::Object::get_property(m_context, collection, i);
+            json row = serialize_json_value(value);
+
+            // Send along the values that can be serialized without storing another object, so reading them
+            // doesn't take another request. Links and lists are still fetched when they are accessed.
+            if (JSValueIsObject(m_context, value)) {
+                JSObjectRef js_object = jsc::Value::to_object(m_context, value);
+                if (jsc::Object::is_instance<js::RealmObjectClass<jsc::Types>>(m_context, js_object)) {
+                    auto object = jsc::Object::get_internal<js::RealmObjectClass<jsc::Types>>(js_object);
+                    json values = json::object();
+
+                    for (auto &prop : object->get_object_schema().persisted_properties) {
+                        if (prop.type != realm::PropertyType::Object && prop.type != realm::PropertyType::Array) {
+                            values[prop.name] = serialize_json_value(jsc::Object::get_property(m_context, js_object, prop.name));
+                        }
+                    }
+                    row["values"] = values;
+                }
+            }
+
+            rows.push_back(row);
+        }
+
+        return (json){{"result", {{"length", length}, {"rows", rows}}}};
+    };
     m_requests["/dispose_object"] = [this](const json dict) {
         RPCObjectID oid = dict["id"].get<RPCObjectID>();
         m_objects.erase(oid);
@@ -271,10 +522,15 @@ void RPCServer::run_callback(JSContextRef ctx, JSObjectRef function, JSObjectRef
         };
     });
 
-    // Wait for the next callback result to come off the result stack.
-    while (server->m_callback_results.empty()) {
+    // Wait for the next callback result to come off the result stack. perform_request() interrupts
+    // the worker when a result arrives, so the interrupt count is read before checking for one.
+    while (true) {
+        size_t interrupt_count = server->m_worker.interrupt_count();
+        if (!server->m_callback_results.empty()) {
+            break;
+        }
         // This may recursively bring us into another callback, hence the callback results being a stack.
-        server->m_worker.try_run_task();
+        server->m_worker.run_task(interrupt_count);
     }
 
     json results = server->m_callback_results.pop_back();
@@ -302,6 +558,7 @@ json RPCServer::perform_request(std::string name, const json &args) {
     if (name == "/callback_result") {
         json results(args);
         m_callback_results.push_back(std::move(results));
+        m_worker.interrupt();
     }
     else {
         RPCRequest action = m_requests[name];
@@ -413,6 +670,12 @@ json RPCServer::serialize_json_value(JSValueRef js_value) {
     }
     else if (jsc::Value::is_binary(m_context, js_object)) {
         auto data = jsc::Value::to_binary(m_context, js_object);
+        if (m_uses_msgpack) {
+            return {
+                {"type", RealmObjectTypesData},
+                {"bytes", std::string(data.data(), data.size())},
+            };
+        }
         return {
             {"type", RealmObjectTypesData},
             {"value", base64_encode((unsigned char *)data.data(), data.size())},
@@ -510,6 +773,12 @@ JSValueRef RPCServer::deserialize_json_value(const json dict) {
             return js_object;
         }
         else if (type_string == RealmObjectTypesData) {
+            auto raw_bytes = dict.find("bytes");
+            if (raw_bytes != dict.end()) {
+                std::string bytes = raw_bytes->get<std::string>();
+                return jsc::Value::from_binary(m_context, realm::BinaryData(bytes.data(), bytes.size()));
+            }
+
             std::string bytes;
             if (!base64_decode(value.get<std::string>(), &bytes)) {
                 throw std::runtime_error("Failed to decode base64 encoded data");
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <future>
 #include <thread>
@@ -38,6 +39,11 @@ using json = nlohmann::json;
 using RPCObjectID = u_int64_t;
 using RPCRequest = std::function<json(const json)>;
 
+// MessagePack encoding of RPC messages, which hosts use instead of JSON text once a session has
+// negotiated it. The "bytes" string of a value whose "type" is data is encoded as raw binary.
+std::string dump_msgpack(const json &value);
+json parse_msgpack(const char *data, size_t size);
+
 class RPCWorker {
   public:
     RPCWorker();
@@ -45,11 +51,15 @@ class RPCWorker {
 
     void add_task(std::function<json()>);
     json pop_task_result();
-    void try_run_task();
     void stop();
 
+    // Runs the next task, waiting for one unless interrupt() is called after `interrupt_count` was read.
+    void run_task(size_t interrupt_count);
+    size_t interrupt_count() { return m_tasks.interrupt_count(); }
+    void interrupt() { m_tasks.interrupt(); }
+
   private:
-    bool m_stop = false;
+    std::atomic<bool> m_stop {false};
     std::thread m_thread;
     ConcurrentDeque<std::packaged_task<json()>> m_tasks;
     ConcurrentDeque<std::future<json>> m_futures;
@@ -57,12 +67,19 @@ class RPCWorker {
 
 class RPCServer {
   public:
-    RPCServer();
+    // Hosts that can carry binary request and response bodies pass true to allow MessagePack sessions.
+    RPCServer(bool msgpack_supported = false);
     ~RPCServer();
     json perform_request(std::string name, const json &args);
 
+    // Whether requests after /create_session are MessagePack encoded rather than JSON text. It is set on
+    // the worker thread and read by the host's server thread.
+    bool uses_msgpack() const { return m_uses_msgpack; }
+
   private:
     JSGlobalContextRef m_context;
+    bool m_msgpack_supported;
+    std::atomic<bool> m_uses_msgpack {false};
     std::mutex m_request_mutex;
     std::map<std::string, RPCRequest> m_requests;
     std::map<RPCObjectID, js::Protected<JSObjectRef>> m_objects;
@@ -124,4 +124,49 @@ module.exports = {
             TestCase.assertEqual(oliviersParents.length, 0);
         });
     },
+
+    testMethodCount: function() {
+        var realm = new Realm({schema: [schemas.PersonObject]});
+
+        var olivier;
+        realm.write(function() {
+            olivier = realm.create('PersonObject', {name: 'Olivier', age: 0});
+            TestCase.assertEqual(olivier.linkingObjectsCount('PersonObject', 'children'), 0);
+
+            realm.create('PersonObject', {name: 'Christine', age: 25, children: [olivier]});
+            realm.create('PersonObject', {name: 'JP', age: 28, children: [olivier, olivier]});
+        });
+
+        TestCase.assertEqual(olivier.linkingObjectsCount('PersonObject', 'children'), 3);
+        TestCase.assertEqual(olivier.linkingObjectsCount('PersonObject', 'children'),
+                             olivier.linkingObjects('PersonObject', 'children').length);
+
+        TestCase.assertThrows(() => olivier.linkingObjectsCount('PersonObject', 'name'),
+            "'PersonObject.name' is not a relationship to 'PersonObject'");
+        TestCase.assertThrows(() => olivier.linkingObjectsCount('PersonObject', 'name'),
+            'failed lookups should not be cached');
+
+        realm.write(function() {
+            realm.delete(olivier);
+        });
+        TestCase.assertThrows(() => olivier.linkingObjectsCount('PersonObject', 'children'));
+    },
+
+    testMethodCountAfterCompact: function() {
+        var realm = new Realm({schema: [schemas.PersonObject]});
+
+        realm.write(function() {
+            var olivier = realm.create('PersonObject', {name: 'Olivier', age: 0});
+            realm.create('PersonObject', {name: 'Christine', age: 25, children: [olivier]});
+        });
+        var olivier = realm.objects('PersonObject').filtered('name = "Olivier"')[0];
+        TestCase.assertEqual(olivier.linkingObjectsCount('PersonObject', 'children'), 1);
+
+        // Compacting the file detaches the tables, which the cached lookup must not hold on to.
+        TestCase.assertTrue(realm.compact());
+
+        olivier = realm.objects('PersonObject').filtered('name = "Olivier"')[0];
+        TestCase.assertEqual(olivier.linkingObjectsCount('PersonObject', 'children'), 1);
+        TestCase.assertEqual(olivier.linkingObjects('PersonObject', 'children')[0].name, 'Christine');
+    },
 };
@@ -369,6 +369,44 @@ module.exports = {
         }, 'can only splice in a write transaction');
     },
 
+    testListPushManyReplaceAll: function() {
+        var realm = new Realm({schema: [schemas.LinkTypes, schemas.TestObject]});
+        var values = (list) => list.map((object) => object.doubleCol);
+        var array, others;
+
+        realm.write(function() {
+            var obj = realm.create('LinkTypesObject', {
+                objectCol: {doubleCol: 1},
+                objectCol1: {doubleCol: 2},
+                arrayCol: [],
+            });
+            array = obj.arrayCol;
+            others = realm.objects('TestObject');
+
+            TestCase.assertEqual(array.pushMany([obj.objectCol, {doubleCol: 3}, obj.objectCol1]), 3);
+            TestCase.assertArraysEqual(values(array), [1, 3, 2]);
+            TestCase.assertEqual(others.length, 3);
+
+            array.replaceAll([array[0], {doubleCol: 4}, array[1], array[2]]);
+            TestCase.assertArraysEqual(values(array), [1, 4, 3, 2]);
+            array.replaceAll([array[3], array[0]]);
+            TestCase.assertArraysEqual(values(array), [2, 1]);
+            array.replaceAll([]);
+            TestCase.assertEqual(array.length, 0);
+
+            TestCase.assertThrows(function() {
+                array.pushMany([obj]);
+            }, 'wrong object type');
+            TestCase.assertThrows(function() {
+                array.pushMany(obj.objectCol);
+            }, 'objects must be an array');
+        });
+
+        TestCase.assertThrows(function() {
+            array.pushMany([others[0]]);
+        }, 'can only push in a write transaction');
+    },
+
     testListDeletions: function() {
         var realm = new Realm({schema: [schemas.LinkTypes, schemas.TestObject]});
         var object;
@@ -68,6 +68,55 @@ module.exports = {
         realm.close();
     },
 
+    testSkipMigrationForAdditiveChanges: function() {
+        var count = 0;
+        function migrationFunction() {
+            count++;
+        }
+        function schemaWith(properties) {
+            return [{name: 'TestObject', properties: properties}];
+        }
+
+        var realm = new Realm({schema: schemaWith({name: 'string'})});
+        realm.write(function() {
+            realm.create('TestObject', {name: 'a'});
+        });
+        realm.close();
+
+        // new optional properties, new object types and new indexes are applied without the migration function
+        realm = new Realm({
+            schema: schemaWith({name: {type: 'string', indexed: true}, note: {type: 'string', optional: true}}).concat([
+                {name: 'OtherObject', properties: {value: 'int'}}
+            ]),
+            schemaVersion: 1,
+            migration: migrationFunction,
+            skipMigrationForAdditiveChanges: true,
+        });
+        TestCase.assertEqual(count, 0);
+        TestCase.assertEqual(realm.objects('TestObject')[0].name, 'a');
+        TestCase.assertEqual(realm.objects('TestObject')[0].note, null);
+        realm.close();
+
+        // a new required property still needs the migration function
+        realm = new Realm({
+            schema: schemaWith({name: 'string', note: {type: 'string', optional: true}, count: 'int'}),
+            schemaVersion: 2,
+            migration: migrationFunction,
+            skipMigrationForAdditiveChanges: true,
+        });
+        TestCase.assertEqual(count, 1);
+        realm.close();
+
+        // and without the option additive changes run it as before
+        realm = new Realm({
+            schema: schemaWith({name: 'string', note: {type: 'string', optional: true}, count: 'int', other: {type: 'string', optional: true}}),
+            schemaVersion: 3,
+            migration: migrationFunction,
+        });
+        TestCase.assertEqual(count, 2);
+        realm.close();
+    },
+
     testDataMigration: function() {
         var realm = new Realm({schema: [{
             name: 'TestObject',
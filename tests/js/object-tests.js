@@ -390,6 +390,14 @@ module.exports = {
         });
         TestCase.assertArraysEqual(new Uint8Array(object.dataCol), RANDOM_DATA);
 
+        // The stored data should not change along with the buffer it was written from.
+        var source = new Uint8Array(RANDOM_DATA);
+        realm.write(function() {
+            object.dataCol = source;
+        });
+        source[0] = ~source[0];
+        TestCase.assertArraysEqual(new Uint8Array(object.dataCol), RANDOM_DATA);
+
         // Test that a variety of size and slices of data still work.
         [
             [0, -1],
@@ -497,6 +505,244 @@ module.exports = {
         TestCase.assertEqual(obj.ignored, true);
     },
 
+    testStringEncoding: function() {
+        var realm = new Realm({schema: [schemas.StringOnly]});
+        var strings = ['', 'ascii', 'caf\u00e9', '\u65e5\u672c\u8a9e', '\ud83d\ude00 emoji', new Array(1025).join('long \u00e9')];
+
+        var objects = [];
+        realm.write(function() {
+            strings.forEach(function(string) {
+                objects.push(realm.create('StringOnlyObject', {stringCol: string}));
+            });
+        });
+        objects.forEach(function(object, index) {
+            TestCase.assertEqual(object.stringCol, strings[index]);
+        });
+
+        // Shorter values reuse the buffer left by longer ones.
+        realm.write(function() {
+            objects.forEach(function(object, index) {
+                object.stringCol = strings[strings.length - 1 - index];
+            });
+        });
+        objects.forEach(function(object, index) {
+            TestCase.assertEqual(object.stringCol, strings[strings.length - 1 - index]);
+        });
+
+        TestCase.assertThrows(function() {
+            realm.write(function() {
+                realm.create('StringOnlyObject', {stringCol: 1});
+            });
+        }, 'numbers are not converted to strings');
+    },
+
+    testObjectListeners: function() {
+        var realm = new Realm({schema: [schemas.BasicTypes]});
+        var object, other;
+        realm.write(function() {
+            object = realm.create('BasicTypesObject', {boolCol: true, intCol: 1, floatCol: 1.1, doubleCol: 1.11,
+                                                       stringCol: 'a', dateCol: new Date(1), dataCol: RANDOM_DATA});
+            other = realm.create('BasicTypesObject', {boolCol: true, intCol: 2, floatCol: 1.1, doubleCol: 1.11,
+                                                      stringCol: 'b', dateCol: new Date(1), dataCol: RANDOM_DATA});
+        });
+
+        TestCase.assertThrows(function() {
+            object.addListener('not a function');
+        });
+
+        var removedCalls = 0;
+        function removed() {
+            removedCalls++;
+        }
+        object.addListener(removed);
+        object.removeListener(removed);
+
+        var changes = [];
+        return new Promise(function(resolve, reject) {
+            object.addListener(function(changedObject, change) {
+                changes.push(change);
+                if (changes.length == 1) {
+                    // Changes to other objects aren't reported, so the next notification is the deletion.
+                    realm.write(function() {
+                        other.intCol = 3;
+                    });
+                    realm.write(function() {
+                        realm.delete(object);
+                    });
+                }
+                else {
+                    resolve();
+                }
+            });
+
+            realm.write(function() {
+                object.intCol = 2;
+                object.stringCol = 'b';
+            });
+        }).then(function() {
+            TestCase.assertEqual(removedCalls, 0);
+            TestCase.assertEqual(changes[0].deleted, false);
+            TestCase.assertArraysEqual(changes[0].changedProperties.sort(), ['intCol', 'stringCol']);
+            TestCase.assertEqual(changes[1].deleted, true);
+            TestCase.assertArraysEqual(changes[1].changedProperties, []);
+            object.removeAllListeners();
+        });
+    },
+
+    testRepeatedPropertyLookups: function() {
+        var realm = new Realm({schema: [schemas.TestObject]});
+        var otherRealm = new Realm({path: 'other.realm', schema: [{
+            name: 'TestObject',
+            properties: {intCol: 'int', doubleCol: 'double'},
+        }]});
+
+        var object, otherObject;
+        realm.write(function() {
+            object = realm.create('TestObject', {doubleCol: 1});
+        });
+        otherRealm.write(function() {
+            otherObject = otherRealm.create('TestObject', {intCol: 2, doubleCol: 3});
+        });
+
+        for (var i = 0; i < 3; i++) {
+            TestCase.assertEqual(object.doubleCol, 1);
+            TestCase.assertEqual(object.intCol, undefined);
+            TestCase.assertEqual(otherObject.doubleCol, 3);
+            TestCase.assertEqual(otherObject.intCol, 2);
+        }
+
+        realm.write(function() {
+            object.doubleCol = 4;
+            realm.delete(object);
+        });
+        TestCase.assertThrows(function() {
+            object.doubleCol;
+        }, 'reading a deleted object should throw');
+        TestCase.assertEqual(object.isValid(), false);
+    },
+
+    testPropertySettersAcrossObjectTypes: function() {
+        var realm = new Realm({schema: [schemas.TestObject, schemas.IntPrimary]});
+        var object, primary;
+        realm.write(function() {
+            object = realm.create('TestObject', {doubleCol: 1});
+            primary = realm.create('IntPrimaryObject', {primaryCol: 1, valueCol: 'a'});
+
+            object.doubleCol = 2;
+            primary.valueCol = 'b';
+            TestCase.assertThrows(function() {
+                primary.primaryCol = 2;
+            }, 'primary keys can only be changed in a migration');
+            TestCase.assertThrows(function() {
+                primary.valueCol = 3;
+            }, 'setting a string property to a number should throw');
+        });
+        TestCase.assertEqual(object.doubleCol, 2);
+        TestCase.assertEqual(primary.primaryCol, 1);
+        TestCase.assertEqual(primary.valueCol, 'b');
+
+        realm.write(function() {
+            realm.delete(object);
+            TestCase.assertThrows(function() {
+                object.doubleCol = 3;
+            }, 'setting a property of a deleted object should throw');
+        });
+    },
+
+    testToJSON: function() {
+        var realm = new Realm({schema: [schemas.PersonObject]});
+        var parent, child;
+        realm.write(function() {
+            parent = realm.create('PersonObject', {name: 'Parent', age: 40});
+            child = realm.create('PersonObject', {name: 'Child', age: 10});
+            parent.children.push(child);
+            child.children.push(parent);
+            child.children.push({name: 'Grandchild', age: 1, children: [{name: 'Great-grandchild', age: 0}]});
+        });
+
+        var json = parent.toJSON();
+        TestCase.assertEqual(Object.getPrototypeOf(json), Object.prototype);
+        TestCase.assertEqual(json.name, 'Parent');
+        TestCase.assertEqual(json.married, false);
+        TestCase.assertEqual(json.children.length, 1);
+        TestCase.assertEqual(json.children[0].name, 'Child');
+        TestCase.assertEqual(json.children[0].children[0], null, 'cycles should become null');
+        TestCase.assertEqual(json.children[0].children[1].name, 'Grandchild');
+        TestCase.assertEqual(json.children[0].children[1].children, undefined, 'two levels are followed by default');
+        TestCase.assertEqual(parent.toJSON({depth: Infinity}).children[0].children[1].children[0].name, 'Great-grandchild');
+        TestCase.assertEqual(json.parents, undefined, 'computed properties are only copied when asked for');
+
+        TestCase.assertEqual(JSON.parse(JSON.stringify(parent)).children[0].age, 10);
+
+        json = parent.toJSON({properties: ['name', 'parents'], depth: 1});
+        TestCase.assertArraysEqual(Object.keys(json).sort(), ['name', 'parents']);
+        TestCase.assertEqual(json.parents[0].name, 'Child');
+        TestCase.assertEqual(json.parents[0].children, undefined, 'links below the depth should be left out');
+
+        var plain = realm.objects('PersonObject').filtered('age >= 10').sorted('age').toPlainArray(0, 1, {depth: 0});
+        TestCase.assertEqual(plain.length, 1);
+        TestCase.assertEqual(plain[0].name, 'Child');
+        TestCase.assertEqual(plain[0].children, undefined);
+        TestCase.assertEqual(parent.children.toPlainArray()[0].name, 'Child');
+
+        TestCase.assertThrows(function() {
+            parent.toJSON({properties: ['nosuchproperty']});
+        });
+    },
+
+    testPrototypeAccessors: function() {
+        function CustomObject() {}
+        CustomObject.schema = schemas.TestObject;
+        CustomObject.prototype = Object.create(Realm.Object.prototype);
+        CustomObject.prototype.doubled = function() {
+            return this.doubleCol * 2;
+        };
+
+        var realm = new Realm({schema: [CustomObject, schemas.LinkTypes], prototypeAccessors: true});
+        var object, links;
+        realm.write(function() {
+            object = realm.create('TestObject', {doubleCol: 1});
+            links = realm.create('LinkTypesObject', {objectCol: object, objectCol1: null, arrayCol: [object]});
+        });
+
+        TestCase.assertTrue(object instanceof CustomObject);
+        TestCase.assertTrue(object instanceof Realm.Object);
+        TestCase.assertEqual(object.doubleCol, 1);
+        TestCase.assertEqual(object.doubled(), 2);
+        TestCase.assertEqual(links.objectCol.doubleCol, 1);
+        TestCase.assertEqual(links.objectCol1, null);
+        TestCase.assertEqual(links.arrayCol.length, 1);
+        TestCase.assertEqual(links.nonexistent, undefined);
+
+        var names = [];
+        for (var name in object) {
+            names.push(name);
+        }
+        TestCase.assertTrue(names.indexOf('doubleCol') != -1);
+
+        realm.write(function() {
+            object.doubleCol = 3;
+            links.objectCol = null;
+        });
+        TestCase.assertEqual(object.doubleCol, 3);
+        TestCase.assertEqual(links.objectCol, null);
+
+        TestCase.assertThrows(function() {
+            object.doubleCol = 4;
+        }, 'can only set property values in a write transaction');
+        TestCase.assertThrows(function() {
+            realm.write(function() {
+                object.doubleCol = 'four';
+            });
+        }, 'property values must be valid for the property type');
+
+        realm.write(function() {
+            realm.create('TestObject', {doubleCol: 5});
+        });
+        TestCase.assertEqual(realm.objects('TestObject').indexOf(object), 0);
+        TestCase.assertEqual(realm.objects('TestObject')[1].doubleCol, 5);
+    },
+
     testDates: function() {
         Realm.copyBundledRealmFiles();
 
@@ -154,5 +154,48 @@ module.exports = {
     },
     testOptionalQueries: function() {
         runQuerySuite(testCases.optionalTests);
+    },
+    testFullTextQueries: function() {
+        var realm = new Realm({schema: [{
+            name: 'Note',
+            properties: {
+                text: {type: 'string', optional: true, fullText: true},
+                plain: {type: 'string', optional: true},
+            }
+        }]});
+        var texts = ['The quick brown fox', 'A lazy dog', 'foxes and hounds', 'Brown-eyed FOX', null, 'unfoxed'];
+        realm.write(function() {
+            texts.forEach(function(text) {
+                realm.create('Note', {text: text, plain: text});
+            });
+        });
+
+        var notes = realm.objects('Note');
+        var check = function(operator, term) {
+            var indexed = notes.filtered('text ' + operator + ' $0', term).map(function(note) { return note.text; });
+            var scanned = notes.filtered('plain ' + operator + ' $0', term).map(function(note) { return note.plain; });
+            TestCase.assertArraysEqual(indexed, scanned, operator + " '" + term + "'");
+        };
+        ['fox', 'brown fox', 'ox', 'quick b', 'x and h', 'DOG', '-eyed', '', '  ', 'ünï'].forEach(function(term) {
+            check('CONTAINS', term);
+            check('CONTAINS[c]', term);
+        });
+        TestCase.assertEqual(notes.filtered("text CONTAINS[c] 'fox' AND text CONTAINS 'and'").length, 1);
+        TestCase.assertEqual(notes.filtered("text CONTAINS[c] 'fox' OR text CONTAINS 'dog'").length, 5);
+        TestCase.assertEqual(notes.filtered("NOT text CONTAINS[c] 'fox'").length, 2);
+
+        // Results re-run their query after a write, when the index no longer matches the table.
+        var foxes = notes.filtered('text CONTAINS[c] $0', 'fox');
+        TestCase.assertEqual(foxes.length, 4);
+        realm.write(function() {
+            realm.create('Note', {text: 'Fox in socks', plain: 'Fox in socks'});
+        });
+        TestCase.assertEqual(foxes.length, 5);
+        check('CONTAINS[c]', 'socks');
+        realm.close();
+
+        TestCase.assertThrows(function() {
+            new Realm({path: 'fullText.realm', schema: [{name: 'Note', properties: {count: {type: 'int', fullText: true}}}]});
+        });
     }
 };
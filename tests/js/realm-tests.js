@@ -103,6 +103,74 @@ module.exports = {
         TestCase.assertEqual(objects[0].doubleCol, 1.0);
     },
 
+    testRealmConstructorReusedSchema: function() {
+        var schema = [schemas.TestObject, schemas.DefaultValues];
+        var realm = new Realm({schema: schema});
+        realm.close();
+
+        // Opening again with the same schema array must still apply its defaults.
+        realm = new Realm({schema: schema});
+        realm.write(function() {
+            realm.create('DefaultValuesObject', {});
+        });
+        TestCase.assertEqual(realm.objects('DefaultValuesObject')[0].stringCol, 'defaultString');
+        realm.close();
+
+        // Adding an object schema to the same array must be picked up.
+        schema.push(schemas.IntPrimary);
+        realm = new Realm({schema: schema, schemaVersion: 1});
+        TestCase.assertEqual(realm.schema.length, 3);
+        realm.close();
+    },
+
+    testRealmLastOpenStats: function() {
+        var realm = new Realm({schema: [schemas.TestObject]});
+        var stats = Realm.lastOpenStats;
+
+        ['config', 'schema', 'open', 'migration', 'datetimeConversion', 'accessorPrototypes', 'total'].forEach(function(phase) {
+            TestCase.assertEqual(typeof stats[phase], 'number', phase + ' should be reported');
+            TestCase.assertTrue(stats[phase] >= 0, phase + ' should not be negative');
+        });
+        TestCase.assertTrue(stats.total >= stats.open, 'total should include opening the file');
+        TestCase.assertEqual(stats.migration, 0);
+        realm.close();
+
+        realm = new Realm({schema: [schemas.TestObject], schemaVersion: 1, migration: function() {}});
+        TestCase.assertTrue(Realm.lastOpenStats.open >= Realm.lastOpenStats.migration);
+        realm.close();
+    },
+
+    testRealmCallStats: function() {
+        var realm = new Realm({schema: [schemas.TestObject]});
+        realm.write(function() {
+            realm.create('TestObject', {doubleCol: 1});
+        });
+
+        TestCase.assertEqual(Realm.collectCallStats, false);
+        Realm.collectCallStats = true;
+        var objects = realm.objects('TestObject');
+        objects.filtered('doubleCol > 0');
+        objects.filtered('doubleCol > 1');
+        TestCase.assertEqual(objects[0].doubleCol, 1);
+        Realm.collectCallStats = false;
+        objects.filtered('doubleCol > 2');
+
+        var stats = Realm.callStats;
+        var filtered = stats['Results.filtered'];
+        TestCase.assertEqual(filtered.calls, 2);
+        TestCase.assertTrue(filtered.totalTime >= filtered.maxTime);
+        TestCase.assertEqual(filtered.histogram.length, 16);
+        TestCase.assertEqual(filtered.histogram.reduce(function(sum, count) { return sum + count; }), 2);
+        TestCase.assertEqual(stats['Realm.objects'].calls, 1);
+        TestCase.assertEqual(stats['Results[index]'].calls, 1);
+        TestCase.assertEqual(stats['Results.sorted'], undefined);
+
+        Realm.collectCallStats = true;
+        TestCase.assertEqual(Realm.callStats['Results.filtered'], undefined, 'turning collection on should reset the counters');
+        Realm.collectCallStats = false;
+        realm.close();
+    },
+
     testRealmConstructorSchemaValidation: function() {
         TestCase.assertThrows(function() {
             new Realm({schema: schemas.AllTypes});
@@ -124,6 +192,10 @@ module.exports = {
             new Realm({schema: [{properties: {intCol: 'int'}}]});
         }, 'The schema should be an array of ObjectSchema objects');
 
+        TestCase.assertThrows(function() {
+            new Realm({schema: [{name: 'Tagged', properties: {tags: {type: 'list', objectType: 'string'}}}]});
+        }, 'Lists should only contain objects');
+
         // linkingObjects property where the source property is missing
         TestCase.assertThrows(function() {
             new Realm({schema: [{
@@ -162,6 +234,18 @@ module.exports = {
         }, "Property 'InvalidObject.link' declared as origin of linking objects property 'InvalidObject.linkingObjects' links to type 'IntObject'")
     },
 
+    testRealmConstructorBundled: function() {
+        TestCase.assertThrows(function() {
+            new Realm({path: 'bundled.realm', bundled: true});
+        }, 'bundled Realms must be read-only');
+        TestCase.assertThrows(function() {
+            new Realm({readOnly: true, bundled: true});
+        }, 'bundled Realms must be named');
+        TestCase.assertThrows(function() {
+            new Realm({path: 'no-such-bundled.realm', readOnly: true, bundled: true});
+        }, 'the file must be bundled with the app');
+    },
+
     testRealmConstructorReadOnly: function() {
         var realm = new Realm({schema: [schemas.TestObject]});
         realm.write(function() {
@@ -256,6 +340,41 @@ module.exports = {
         TestCase.assertEqual(objects[1].doubleCol, 2, 'wrong object property value');
     },
 
+    testRealmCreateMany: function() {
+        var realm = new Realm({schema: [schemas.TestObject, schemas.IntPrimary]});
+
+        TestCase.assertThrows(function() {
+            realm.createMany('TestObject', [{doubleCol: 1}]);
+        }, 'can only create inside a write transaction');
+
+        realm.write(function() {
+            TestCase.assertEqual(realm.createMany('TestObject', [{doubleCol: 1}, [2], {doubleCol: 3}]), 3);
+            TestCase.assertEqual(realm.createMany('TestObject', []), 0);
+
+            TestCase.assertThrows(function() {
+                realm.createMany('TestObject', {doubleCol: 1});
+            }, 'objects must be an array');
+            TestCase.assertThrows(function() {
+                realm.createMany('TestObject', [[1, 2]]);
+            }, 'array-form objects must contain all properties');
+
+            realm.createMany('IntPrimaryObject', [
+                {primaryCol: 0, valueCol: 'val0'},
+                {primaryCol: 1, valueCol: 'val1'},
+            ]);
+            realm.createMany('IntPrimaryObject', [{primaryCol: 1, valueCol: 'newVal1'}], true);
+        });
+
+        var objects = realm.objects('TestObject');
+        TestCase.assertEqual(objects.length, 3, 'wrong object count');
+        TestCase.assertEqual(objects[0].doubleCol, 1, 'wrong object property value');
+        TestCase.assertEqual(objects[1].doubleCol, 2, 'wrong object property value');
+        TestCase.assertEqual(objects[2].doubleCol, 3, 'wrong object property value');
+
+        TestCase.assertEqual(realm.objects('IntPrimaryObject').length, 2);
+        TestCase.assertEqual(realm.objectForPrimaryKey('IntPrimaryObject', 1).valueCol, 'newVal1');
+    },
+
     testRealmCreatePrimaryKey: function() {
         var realm = new Realm({schema: [schemas.IntPrimary]});
 
@@ -634,6 +753,40 @@ module.exports = {
         });
     },
 
+    testRealmDeleteWhere: function() {
+        var realm = new Realm({schema: [schemas.TestObject]});
+
+        realm.write(function() {
+            for (var i = 0; i < 10; i++) {
+                realm.create('TestObject', {doubleCol: i});
+            }
+        });
+
+        var objects = realm.objects('TestObject');
+        TestCase.assertThrows(function() {
+            realm.deleteWhere('TestObject', 'doubleCol < 5');
+        }, 'can only delete in a write transaction');
+
+        realm.write(function() {
+            TestCase.assertEqual(realm.deleteWhere('TestObject', 'doubleCol < $0', 5), 5);
+            TestCase.assertEqual(objects.length, 5, 'wrong object count');
+            TestCase.assertEqual(objects.filtered('doubleCol < 5').length, 0);
+
+            TestCase.assertEqual(realm.deleteWhere('TestObject', 'doubleCol > 100'), 0);
+            TestCase.assertEqual(objects.length, 5, 'wrong object count');
+
+            TestCase.assertThrows(function() {
+                realm.deleteWhere('TestObject', 'invalidProperty == 1');
+            }, 'invalid query');
+            TestCase.assertThrows(function() {
+                realm.deleteWhere('NoSuchObject', 'doubleCol > 1');
+            }, 'invalid object type');
+            TestCase.assertThrows(function() {
+                realm.deleteWhere('TestObject');
+            }, 'missing query');
+        });
+    },
+
     testDeleteAll: function() {
         var realm = new Realm({schema: [schemas.TestObject, schemas.IntPrimary]});
 
@@ -773,6 +926,125 @@ module.exports = {
         });
     },
 
+    testRealmObjectsReturnsSameResults: function() {
+        var realm = new Realm({schema: [schemas.TestObject, schemas.PersonObject], cacheObjects: true});
+
+        var objects = realm.objects('TestObject');
+        TestCase.assertTrue(realm.objects('TestObject') === objects);
+        TestCase.assertTrue(realm.objects(schemas.PersonObject) === realm.objects('PersonObject'));
+        TestCase.assertEqual(Object.keys(realm).indexOf('_objectsCache'), -1);
+
+        realm.write(function() {
+            realm.create('TestObject', {doubleCol: 1});
+        });
+        TestCase.assertEqual(objects.length, 1);
+        TestCase.assertEqual(realm.objects('TestObject').filtered('doubleCol == 1').length, 1);
+        realm.close();
+
+        // Without `cacheObjects`, every call has Results of its own.
+        var reopened = new Realm({schema: [schemas.TestObject, schemas.PersonObject]});
+        TestCase.assertTrue(reopened.objects('TestObject') !== objects);
+        TestCase.assertTrue(reopened.objects('TestObject') !== reopened.objects('TestObject'));
+        TestCase.assertEqual(reopened.objects('TestObject').length, 1);
+    },
+
+    testRealmObjectsForPrimaryKeys: function() {
+        var realm = new Realm({schema: [schemas.IntPrimary, schemas.StringPrimary, schemas.TestObject]});
+
+        realm.write(function() {
+            TestCase.assertEqual(realm.upsertMany('StringPrimaryObject', [
+                {primaryCol: 'a', valueCol: 1},
+                {primaryCol: 'b', valueCol: 2},
+            ]), 2);
+            TestCase.assertEqual(realm.upsertMany('StringPrimaryObject', [
+                {primaryCol: 'b', valueCol: 3},
+                ['c', 4],
+            ]), 2);
+            realm.create('IntPrimaryObject', {primaryCol: 7, valueCol: 'seven'});
+
+            TestCase.assertThrows(function() {
+                realm.upsertMany('TestObject', [{doubleCol: 1}]);
+            }, 'no primary key');
+        });
+
+        var objects = realm.objectsForPrimaryKeys('StringPrimaryObject', ['c', 'missing', 'b', 'a', 'b']);
+        TestCase.assertEqual(objects.length, 5);
+        TestCase.assertEqual(objects[0].valueCol, 4);
+        TestCase.assertEqual(objects[1], undefined);
+        TestCase.assertEqual(objects[2].valueCol, 3);
+        TestCase.assertEqual(objects[3].valueCol, 1);
+        TestCase.assertTrue(objects[4].primaryCol === 'b');
+        TestCase.assertEqual(realm.objects('StringPrimaryObject').length, 3);
+
+        objects = realm.objectsForPrimaryKeys('IntPrimaryObject', [7, 8]);
+        TestCase.assertEqual(objects[0].valueCol, 'seven');
+        TestCase.assertEqual(objects[1], undefined);
+        TestCase.assertEqual(realm.objectsForPrimaryKeys('IntPrimaryObject', []).length, 0);
+
+        TestCase.assertThrows(function() {
+            realm.objectsForPrimaryKeys('TestObject', [0]);
+        }, 'no primary key');
+        TestCase.assertThrows(function() {
+            realm.objectsForPrimaryKeys('IntPrimaryObject', 7);
+        }, 'keys must be an array');
+        TestCase.assertThrows(function() {
+            realm.objectsForPrimaryKeys('IntPrimaryObject', [null]);
+        }, 'primary key is not nullable');
+        TestCase.assertThrows(function() {
+            realm.objectsForPrimaryKeys('IntPrimaryObject', [7.5]);
+        }, 'integer primary keys must not be truncated');
+    },
+
+    testNotificationsReuseRealmWrapper: function() {
+        var realm = new Realm({schema: []});
+        var notifiedRealms = [];
+        function listener(notifiedRealm) {
+            notifiedRealms.push(notifiedRealm);
+        }
+
+        realm.addListener('change', listener);
+        realm.write(function() {});
+        realm.write(function() {});
+        TestCase.assertEqual(notifiedRealms.length, 2);
+        // The wrapper is only reused in-process; the Chrome debugger creates a proxy for each notification.
+        if (typeof navigator === 'undefined' || !/Chrome/.test(navigator.userAgent)) { // eslint-disable-line no-undef
+            TestCase.assertTrue(notifiedRealms[0] === notifiedRealms[1], 'listeners should receive the same Realm object');
+        }
+        TestCase.assertEqual(notifiedRealms[0].path, realm.path);
+
+        realm.removeListener('change', listener);
+        realm.addListener('change', listener);
+        realm.write(function() {});
+        TestCase.assertEqual(notifiedRealms.length, 3);
+        TestCase.assertEqual(notifiedRealms[2].path, realm.path);
+        realm.close();
+    },
+
+    testManyNotificationListeners: function() {
+        var realm = new Realm({schema: []});
+        var calls = [];
+        var listeners = [];
+        for (var i = 0; i < 1000; i++) {
+            listeners.push(function(index) {
+                return function() { calls.push(index); };
+            }(i));
+            realm.addListener('change', listeners[i]);
+        }
+
+        // Remove every other listener, in reverse order.
+        for (var j = listeners.length - 1; j >= 0; j -= 2) {
+            realm.removeListener('change', listeners[j]);
+        }
+        realm.addListener('change', listeners[0]);
+
+        realm.write(function() {});
+        TestCase.assertEqual(calls.length, 500);
+        for (var k = 0; k < calls.length; k++) {
+            TestCase.assertEqual(calls[k], k * 2, 'listeners should be called in the order they were added');
+        }
+        realm.close();
+    },
+
     testNotifications: function() {
         var realm = new Realm({schema: []});
         var notificationCount = 0;
@@ -824,6 +1096,118 @@ module.exports = {
         });
     },
 
+    testDeferWrite: function() {
+        var realm = new Realm({schema: [schemas.TestObject]});
+        var order = [];
+
+        var first = realm.deferWrite(function() {
+            order.push(1);
+            realm.create('TestObject', {doubleCol: 1});
+            return 'first';
+        });
+        var failed = realm.deferWrite(function() {
+            order.push(2);
+            realm.create('TestObject', {doubleCol: 2});
+            throw new Error('rolled back');
+        });
+        var last = realm.deferWrite(function() {
+            order.push(3);
+            return realm.objects('TestObject').length;
+        });
+
+        // Nothing runs until a later turn of the event loop.
+        TestCase.assertEqual(order.length, 0);
+        TestCase.assertThrows(function() {
+            realm.deferWrite('not a function');
+        });
+
+        return first.then(function(result) {
+            TestCase.assertEqual(result, 'first');
+            return failed.then(function() {
+                throw new Error('deferWrite should have been rejected');
+            }, function(error) {
+                TestCase.assertEqual(error.message, 'rolled back');
+                return last;
+            });
+        }).then(function(length) {
+            TestCase.assertEqual(length, 1);
+            TestCase.assertArraysEqual(order, [1, 2, 3]);
+        });
+    },
+
+    testDeferWriteGroupCommit: function() {
+        var realm = new Realm({schema: [schemas.TestObject]});
+        var calls = [];
+
+        TestCase.assertThrows(function() {
+            realm.setGroupCommit({maxWrites: 0});
+        });
+        realm.setGroupCommit({delay: 1, maxWrites: 10});
+
+        var writes = [1, 2, 3].map(function(value) {
+            return realm.deferWrite(function() {
+                calls.push(value);
+                TestCase.assertEqual(realm.isInTransaction, true);
+                realm.create('TestObject', {doubleCol: value});
+                if (value == 2) {
+                    throw new Error('rolled back');
+                }
+                return value;
+            });
+        });
+
+        return writes[0].then(function(result) {
+            TestCase.assertEqual(result, 1);
+            return writes[1].then(function() {
+                throw new Error('deferWrite should have been rejected');
+            }, function(error) {
+                TestCase.assertEqual(error.message, 'rolled back');
+                return writes[2];
+            });
+        }).then(function(result) {
+            TestCase.assertEqual(result, 3);
+            // The first write ran again after the second one failed, then together with the third.
+            TestCase.assertArraysEqual(calls, [1, 2, 1, 3]);
+            TestCase.assertArraysEqual(realm.objects('TestObject').sorted('doubleCol').map(function(object) {
+                return object.doubleCol;
+            }), [1, 3]);
+            realm.setGroupCommit(null);
+        });
+    },
+
+    testChangesetNotifications: function() {
+        var realm = new Realm({schema: [schemas.TestObject, schemas.IntPrimary]});
+        var changes = [];
+
+        realm.addListener('changeset', function(realm, name, changeset) {
+            TestCase.assertEqual(name, 'changeset');
+            changes.push(changeset.objectTypes);
+        });
+
+        // Transactions that don't touch any objects are not reported.
+        realm.write(function() {});
+        TestCase.assertEqual(changes.length, 0);
+
+        realm.write(function() {
+            realm.create('TestObject', {doubleCol: 1});
+        });
+        TestCase.assertEqual(changes.length, 1);
+        TestCase.assertArraysEqual(changes[0], ['TestObject']);
+
+        realm.write(function() {
+            realm.create('TestObject', {doubleCol: 2});
+            realm.create('IntPrimaryObject', {primaryCol: 1, valueCol: 'a'});
+        });
+        TestCase.assertEqual(changes.length, 2);
+        TestCase.assertArraysEqual(changes[1].sort(), ['IntPrimaryObject', 'TestObject']);
+
+        realm.removeAllListeners('changeset');
+        realm.write(function() {
+            realm.create('TestObject', {doubleCol: 3});
+        });
+        TestCase.assertEqual(changes.length, 2);
+    },
+
     testSchema: function() {
         var originalSchema = [schemas.TestObject, schemas.BasicTypes, schemas.NullableBasicTypes, schemas.IndexedTypes, schemas.IntPrimary, 
             schemas.PersonObject, schemas.LinkTypes, schemas.LinkingObjectsObject];
@@ -1030,5 +1414,234 @@ module.exports = {
         const realm1 = new Realm({schema: [schemas.StringOnly]});
         const realm2 = new Realm({schema: [schemas.StringOnly]});
         TestCase.assertThrows(realm1.compact());
+    },
+
+    testCompactAsync: function() {
+        const path = 'compact-async.realm';
+        const realm = new Realm({path: path, schema: [schemas.StringOnly]});
+        realm.write(() => {
+            for (var i = 0; i < 1000; i++) {
+                realm.create('StringOnlyObject', { stringCol: 'ABCDEFG' });
+            }
+        });
+        realm.write(() => {
+            realm.deleteAll();
+        });
+        realm.close();
+
+        var progressCalls = 0;
+        return Realm.compactAsync({path: path}, {threshold: 1}).then(() => {
+            throw new Error('compactAsync should have been rejected');
+        }, (error) => {
+            TestCase.assertTrue(error instanceof Error);
+            return Realm.compactAsync({path: path}, {progress: () => progressCalls++});
+        }).then((result) => {
+            TestCase.assertEqual(result.compacted, true);
+            TestCase.assertEqual(progressCalls, 1);
+            TestCase.assertTrue(result.compactedBytes < result.totalBytes);
+
+            // The freshly compacted file has little free space left.
+            return Realm.compactAsync({path: path}, {threshold: 0.9});
+        }).then((result) => {
+            TestCase.assertEqual(result.compacted, false);
+            TestCase.assertEqual(result.compactedBytes, result.totalBytes);
+
+            const compacted = new Realm({path: path, schema: [schemas.StringOnly]});
+            TestCase.assertTrue(compacted.empty);
+            compacted.close();
+        });
+    },
+
+    testRealmOpenExistingLocalRealm: function() {
+        const path = 'open-existing.realm';
+        const realm = new Realm({path: path, schema: [schemas.TestObject]});
+        realm.write(() => realm.create('TestObject', {doubleCol: 1}));
+        realm.close();
+
+        return Realm.open({path: path, schema: [schemas.TestObject]}).then((openedRealm) => {
+            TestCase.assertEqual(openedRealm.objects('TestObject').length, 1);
+            openedRealm.close();
+
+            return Realm.open({path: path, schema: [schemas.TestObject], encryptionKey: new Int8Array(64)});
+        }).then(() => {
+            throw new Error('Realm.open should have been rejected');
+        }, (error) => {
+            TestCase.assertTrue(error instanceof Error);
+        });
+    },
+
+    testStats: function() {
+        const realm = new Realm({schema: [schemas.TestObject]});
+        realm.write(() => realm.create('TestObject', {doubleCol: 1}));
+
+        const object = realm.objects('TestObject')[0];
+        const objects = realm.objects('TestObject');
+        const listener = () => {};
+        objects.addListener(listener);
+
+        let stats = realm.stats();
+        TestCase.assertTrue(stats.liveObjects.TestObject >= 1);
+        TestCase.assertTrue(stats.liveObjects['Realm.Results'] >= 1);
+        TestCase.assertEqual(stats.notificationTokens, 1);
+        TestCase.assertTrue(stats.versions >= 1);
+        TestCase.assertTrue(stats.fileSize > 0);
+        TestCase.assertTrue(stats.usedSize > 0);
+
+        objects.removeListener(listener);
+        TestCase.assertEqual(realm.stats().notificationTokens, 0);
+        TestCase.assertEqual(object.doubleCol, 1);
+
+        TestCase.assertEqual(Realm.versionWarningThreshold, 0);
+        Realm.versionWarningThreshold = 100;
+        TestCase.assertEqual(Realm.versionWarningThreshold, 100);
+        Realm.versionWarningThreshold = 0;
+
+        realm.close();
+        TestCase.assertThrows(() => realm.stats());
+    },
+
+    testStatsThenCompact: function() {
+        const realm = new Realm({schema: [schemas.TestObject]});
+        realm.write(() => realm.create('TestObject', {doubleCol: 1}));
+
+        // Reading the stats doesn't leave the file open elsewhere, which would keep it from being compacted.
+        TestCase.assertTrue(realm.stats().versions >= 1);
+        TestCase.assertTrue(realm.compact());
+
+        Realm.versionWarningThreshold = 100;
+        realm.write(() => realm.create('TestObject', {doubleCol: 2}));
+        Realm.versionWarningThreshold = 0;
+        TestCase.assertTrue(realm.compact());
+        TestCase.assertEqual(realm.objects('TestObject').length, 2);
+        realm.close();
+    },
+
+    testKeepOpenAcrossReloads: function() {
+        TestCase.assertEqual(Realm.keepOpenAcrossReloads, false);
+        Realm.keepOpenAcrossReloads = true;
+        try {
+            TestCase.assertEqual(Realm.keepOpenAcrossReloads, true);
+            TestCase.assertThrows(function() {
+                Realm.keepOpenAcrossReloads = 'yes';
+            });
+        }
+        finally {
+            Realm.keepOpenAcrossReloads = false;
+        }
+    },
+
+    testSchemaModifiedInPlace: function() {
+        const schema = [{name: 'Thing', properties: {name: 'string'}}];
+        const first = new Realm({path: 'schema-first.realm', schema: schema});
+        TestCase.assertEqual(Object.keys(first.schema[0].properties).length, 1);
+        first.close();
+
+        // Reusing the same objects after adding or removing properties must not reuse what was parsed before.
+        schema[0].properties.count = {type: 'int', optional: true};
+        const second = new Realm({path: 'schema-second.realm', schema: schema});
+        TestCase.assertEqual(second.schema[0].properties.count.type, 'int');
+        TestCase.assertTrue(second.schema[0].properties.count.optional);
+        second.close();
+
+        delete schema[0].properties.name;
+        const third = new Realm({path: 'schema-third.realm', schema: schema});
+        TestCase.assertEqual(third.schema[0].properties.name, undefined);
+        third.close();
+    },
+
+    testInMemory: function() {
+        const config = {path: 'in-memory.realm', schema: [schemas.TestObject], inMemory: true};
+        const realm = new Realm(config);
+        realm.write(() => {
+            realm.create('TestObject', {doubleCol: 1});
+        });
+
+        // Realms opened with the same path share the data, which must all be in memory or not.
+        TestCase.assertEqual(new Realm(config).objects('TestObject').length, 1);
+        TestCase.assertThrows(() => new Realm({path: 'in-memory.realm', schema: [schemas.TestObject]}));
+        realm.close();
+
+        // Closing the last one discards the data.
+        TestCase.assertEqual(Realm.schemaVersion('in-memory.realm'), -1);
+        const reopened = new Realm(config);
+        TestCase.assertEqual(reopened.objects('TestObject').length, 0);
+        reopened.close();
+
+        TestCase.assertThrows(() => new Realm({path: 'in-memory.realm', inMemory: true, readOnly: true}));
+        TestCase.assertThrows(() => new Realm({path: 'in-memory.realm', inMemory: 'yes'}));
+    },
+
+    testDeleteFile: function() {
+        const realm = new Realm({path: 'delete-file.realm', schema: [schemas.TestObject]});
+        TestCase.assertThrows(() => Realm.deleteFile({path: 'delete-file.realm'}));
+        realm.close();
+
+        Realm.deleteFile({path: 'delete-file.realm'});
+        TestCase.assertEqual(Realm.schemaVersion('delete-file.realm'), -1);
+        // Deleting files that don't exist is not an error.
+        Realm.deleteFile({path: 'delete-file.realm'});
+    },
+
+    testDeleteFilesAsync: function() {
+        ['first.realm', 'second.realm', 'third.realm'].forEach((path) => {
+            new Realm({path: path, schema: [schemas.TestObject]}).close();
+        });
+
+        return Realm.deleteFilesAsync().then(() => {
+            TestCase.assertEqual(Realm.schemaVersion('first.realm'), -1);
+            TestCase.assertEqual(Realm.schemaVersion('third.realm'), -1);
+        });
+    },
+
+    testImportFrom: function() {
+        // Writing the files to import needs the file system of Node.
+        if (typeof process !== 'object' || process + '' !== '[object process]') {
+            return;
+        }
+        const fs = require('fs');
+
+        const realm = new Realm({schema: [schemas.IntPrimary, schemas.DefaultValues, schemas.TestObject]});
+        const jsonPath = realm.path + '.import.json';
+        const csvPath = realm.path + '.import.csv';
+        const defaultsPath = realm.path + '.defaults.json';
+        const invalidPath = realm.path + '.invalid.json';
+        fs.writeFileSync(jsonPath, '{"primaryCol": 1, "valueCol": "one"}\n\n[2, "two"]\n{"primaryCol": 3, "valueCol": "three"}\n');
+        fs.writeFileSync(csvPath, 'valueCol,primaryCol\r\n"four, ""quoted""\nlines",4\r\nfive,5\r\n');
+        fs.writeFileSync(defaultsPath, '{"intCol": 5}\n');
+        fs.writeFileSync(invalidPath, '{"primaryCol": 6, "valueCol": "six"}\n{"primaryCol": "seven"}\n');
+
+        TestCase.assertThrows(() => realm.importFrom(jsonPath, 'NoSuchObject'));
+        TestCase.assertThrows(() => realm.importFrom(jsonPath, 'IntPrimaryObject', {format: 'xml'}));
+
+        const progress = [];
+        return realm.importFrom(jsonPath, 'IntPrimaryObject', {batchSize: 2, progress: (rows) => progress.push(rows)}).then((result) => {
+            TestCase.assertEqual(result.rows, 3);
+            TestCase.assertArraysEqual(progress, [2]);
+            TestCase.assertEqual(realm.objectForPrimaryKey('IntPrimaryObject', 2).valueCol, 'two');
+
+            return realm.importFrom(csvPath, 'IntPrimaryObject', {format: 'csv'});
+        }).then((result) => {
+            TestCase.assertEqual(result.rows, 2);
+            TestCase.assertEqual(realm.objectForPrimaryKey('IntPrimaryObject', 4).valueCol, 'four, "quoted"\nlines');
+            TestCase.assertEqual(realm.objects('IntPrimaryObject').length, 5);
+
+            return realm.importFrom(defaultsPath, 'DefaultValuesObject');
+        }).then(() => {
+            const object = realm.objects('DefaultValuesObject')[0];
+            TestCase.assertEqual(object.intCol, 5);
+            TestCase.assertEqual(object.stringCol, 'defaultString');
+            TestCase.assertEqual(object.objectCol.doubleCol, 1);
+            TestCase.assertEqual(object.arrayCol.length, 1);
+
+            return realm.importFrom(invalidPath, 'IntPrimaryObject', {batchSize: 1});
+        }).then(() => {
+            throw new Error('importFrom should have been rejected');
+        }, (error) => {
+            TestCase.assertTrue(error.message.indexOf('Line 2') == 0);
+            // The batch before the failing line is kept.
+            TestCase.assertEqual(realm.objects('IntPrimaryObject').length, 6);
+
+            [jsonPath, csvPath, defaultsPath, invalidPath].forEach((path) => fs.unlinkSync(path));
+        });
     }
 };
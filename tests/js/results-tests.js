@@ -128,6 +128,134 @@ module.exports = {
         TestCase.assertEqual(keys.length, 1);
     },
 
+    testResultsChunkedIteration: function() {
+        var realm = new Realm({schema: [schemas.TestObject]});
+        realm.write(function() {
+            for (var i = 0; i < 600; i++) {
+                realm.create('TestObject', {doubleCol: i});
+            }
+        });
+        var objects = realm.objects('TestObject').sorted('doubleCol');
+
+        var index = 0;
+        for (var object of objects) {
+            TestCase.assertEqual(object.doubleCol, index++);
+        }
+        TestCase.assertEqual(index, 600);
+
+        var entries = Array.from(objects.entries());
+        TestCase.assertEqual(entries.length, 600);
+        TestCase.assertEqual(entries[300][0], 300);
+        TestCase.assertEqual(entries[300][1].doubleCol, 300);
+
+        var visited = [];
+        objects.forEach(function(object, i, collection) {
+            TestCase.assertTrue(collection === objects);
+            TestCase.assertTrue(this === visited);
+            visited.push(i);
+        }, visited);
+        TestCase.assertEqual(visited.length, 600);
+
+        TestCase.assertEqual(objects.map(function(object) { return object.doubleCol; })[599], 599);
+        TestCase.assertEqual(objects.filter(function(object) { return object.doubleCol % 100 == 0; }).length, 6);
+        TestCase.assertEqual(objects.reduce(function(sum, object) { return sum + object.doubleCol; }, 0), 179700);
+        TestCase.assertEqual(objects.find(function(object) { return object.doubleCol == 500; }).doubleCol, 500);
+        TestCase.assertEqual(objects.findIndex(function(object) { return object.doubleCol == 500; }), 500);
+        TestCase.assertEqual(objects.find(function() { return false; }), undefined);
+        TestCase.assertEqual(objects.findIndex(function() { return false; }), -1);
+        TestCase.assertTrue(objects.some(function(object) { return object.doubleCol == 599; }));
+        TestCase.assertEqual(objects.every(function(object) { return object.doubleCol < 599; }), false);
+        TestCase.assertThrows(function() {
+            objects.filtered('doubleCol < 0').reduce(function() {});
+        });
+        TestCase.assertThrows(function() {
+            objects.forEach();
+        });
+
+        // Within a write transaction objects deleted by the callback are not handed out afterwards.
+        realm.write(function() {
+            var seen = 0;
+            realm.objects('TestObject').filtered('doubleCol < 10').forEach(function(object) {
+                if (object) {
+                    TestCase.assertTrue(object.isValid());
+                    realm.delete(object);
+                    seen++;
+                }
+            });
+            TestCase.assertTrue(seen > 0);
+        });
+
+        // Objects read ahead of a write that deletes them are read again rather than handed out.
+        var remaining = realm.objects('TestObject').filtered('doubleCol >= 10').sorted('doubleCol');
+        var visitedValues = [];
+        remaining.forEach(function(object) {
+            TestCase.assertTrue(object.isValid());
+            visitedValues.push(object.doubleCol);
+            if (object.doubleCol == 10) {
+                realm.write(function() {
+                    realm.delete(realm.objects('TestObject').filtered('doubleCol > 10 && doubleCol < 20'));
+                });
+            }
+        });
+        TestCase.assertEqual(visitedValues[0], 10);
+        TestCase.assertEqual(visitedValues[1], 20);
+
+        var iterator = remaining.values();
+        TestCase.assertEqual(iterator.next().value.doubleCol, 10);
+        realm.write(function() {
+            realm.delete(realm.objects('TestObject').filtered('doubleCol == 20'));
+        });
+        TestCase.assertEqual(iterator.next().value.doubleCol, 21);
+
+        // Objects read ahead of a write that moves them within the sorted results are read again as well.
+        var reordered = [];
+        remaining.forEach(function(object) {
+            reordered.push(object.doubleCol);
+            if (reordered.length == 1) {
+                realm.write(function() {
+                    realm.objects('TestObject').filtered('doubleCol == 22')[0].doubleCol = 1000;
+                });
+            }
+        });
+        TestCase.assertEqual(reordered[1], 21);
+        TestCase.assertEqual(reordered[2], 23);
+    },
+
+    testResultsEnumerationLimit: function() {
+        var realm = new Realm({schema: [schemas.TestObject]});
+        realm.write(function() {
+            for (var i = 0; i < 20; i++) {
+                realm.create('TestObject', {doubleCol: i});
+            }
+        });
+        var objects = realm.objects('TestObject');
+
+        TestCase.assertEqual(Realm.collectionEnumerationLimit, Infinity);
+        TestCase.assertEqual(Object.keys(objects).length, 20);
+
+        Realm.collectionEnumerationLimit = 5;
+        try {
+            TestCase.assertEqual(Realm.collectionEnumerationLimit, 5);
+            TestCase.assertArraysEqual(Object.keys(objects), ['0', '1', '2', '3', '4']);
+            TestCase.assertEqual(objects.length, 20);
+            TestCase.assertEqual(objects[19].doubleCol, 19);
+            TestCase.assertEqual(objects.toArray().length, 20);
+        }
+        finally {
+            Realm.collectionEnumerationLimit = Infinity;
+        }
+        TestCase.assertEqual(Object.keys(objects).length, 20);
+
+        var part = objects.toArray(5, 8);
+        TestCase.assertTrue(Array.isArray(part));
+        TestCase.assertEqual(part.length, 3);
+        TestCase.assertEqual(part[0].doubleCol, 5);
+
+        TestCase.assertThrows(function() {
+            Realm.collectionEnumerationLimit = -1;
+        });
+    },
+
     testResultsFiltered: function() {
         var realm = new Realm({schema: [schemas.PersonObject, schemas.DefaultValues, schemas.TestObject]});
 
@@ -174,6 +302,46 @@ module.exports = {
         TestCase.assertEqual(realm.objects('DefaultValuesObject').filtered('dateCol <= $0', new Date(4)).length, 2);
     },
 
+    testCompileQuery: function() {
+        var realm = new Realm({schema: [schemas.PersonObject, schemas.TestObject]});
+        realm.write(function() {
+            realm.create('PersonObject', {name: 'Ari', age: 10});
+            realm.create('PersonObject', {name: 'Alex', age: 12});
+            realm.create('PersonObject', {name: 'Bjarne', age: 12});
+        });
+
+        TestCase.assertThrows(function() {
+            realm.compileQuery('NoSuchObject', 'age > 1');
+        });
+        TestCase.assertThrows(function() {
+            realm.compileQuery('PersonObject', 1);
+        });
+
+        var search = realm.compileQuery('PersonObject', 'name BEGINSWITH[c] $0');
+        TestCase.assertEqual(search.objectType, 'PersonObject');
+        TestCase.assertEqual(search.predicate, 'name BEGINSWITH[c] $0');
+        TestCase.assertEqual(search.run('a').length, 2);
+        TestCase.assertEqual(search.run('al').length, 1);
+        TestCase.assertEqual(search.run('al')[0].name, 'Alex');
+        TestCase.assertEqual(search.run('x').length, 0);
+
+        // The results are live, like those of filtered().
+        var results = search.run('b');
+        realm.write(function() {
+            realm.create('PersonObject', {name: 'Bob', age: 30});
+        });
+        TestCase.assertEqual(results.length, 2);
+
+        // Reusing a parsed predicate must not change how it is applied to other types or arguments.
+        TestCase.assertEqual(realm.objects('PersonObject').filtered('name BEGINSWITH[c] $0', 'A').length, 2);
+        TestCase.assertThrows(function() {
+            realm.objects('TestObject').filtered('name BEGINSWITH[c] $0', 'A');
+        });
+        TestCase.assertThrows(function() {
+            search.run();
+        });
+    },
+
     testResultsFilteredByForeignObject: function() {
         var realm = new Realm({schema: [schemas.LinkTypes, schemas.TestObject]});
         var realm2 = new Realm({path: '2.realm', schema: realm.schema});
@@ -256,6 +424,35 @@ module.exports = {
         });
     },
 
+    testResultsSortedRepeatedly: function() {
+        var realm = new Realm({schema: [schemas.PersonObject]});
+        realm.write(function() {
+            realm.create('PersonObject', {name: 'Ari', age: 10});
+            realm.create('PersonObject', {name: 'Tim', age: 11});
+            realm.create('PersonObject', {name: 'Alex', age: 11});
+        });
+
+        var objects = realm.objects('PersonObject');
+        function names(results) {
+            return results.map(function(person) { return person.name; });
+        }
+
+        // The same properties sorted in a different direction or order must not be mistaken for each other.
+        for (var i = 0; i < 3; i++) {
+            TestCase.assertArraysEqual(names(objects.sorted([['age', false], ['name', false]])), ['Ari', 'Alex', 'Tim']);
+            TestCase.assertArraysEqual(names(objects.sorted([['age', true], ['name', false]])), ['Alex', 'Tim', 'Ari']);
+            TestCase.assertArraysEqual(names(objects.sorted([['name', false], ['age', false]])), ['Alex', 'Ari', 'Tim']);
+            TestCase.assertArraysEqual(names(objects.sorted('name', true)), ['Tim', 'Ari', 'Alex']);
+        }
+
+        TestCase.assertThrows(function() {
+            objects.sorted([['age', false], ['noSuchProperty', false]]);
+        });
+        TestCase.assertThrows(function() {
+            objects.sorted([['age', false], ['noSuchProperty', false]]);
+        });
+    },
+
     testResultsSortedAllTypes: function() {
         var realm = new Realm({schema: [schemas.BasicTypes]});
         var objects = realm.objects('BasicTypesObject');
@@ -420,6 +617,314 @@ module.exports = {
         });
     },
 
+    testResultsRepeatedIndexOf: function() {
+        var realm = new Realm({schema: [schemas.TestObject]});
+        var objects = [];
+        realm.write(function() {
+            for (var i = 0; i < 20; i++) {
+                objects.push(realm.create('TestObject', {doubleCol: i}));
+            }
+        });
+
+        var sorted = realm.objects('TestObject').sorted('doubleCol', true);
+        for (var pass = 0; pass < 2; pass++) {
+            objects.forEach(function(object, index) {
+                TestCase.assertEqual(sorted.indexOf(object), 19 - index);
+                TestCase.assertTrue(sorted.includes(object));
+            });
+        }
+
+        // Positions are looked up again after the Realm changes.
+        realm.write(function() {
+            realm.delete(objects[19]);
+            objects.pop();
+            objects[5].doubleCol = 100;
+        });
+        TestCase.assertEqual(sorted.indexOf(objects[5]), 0);
+        TestCase.assertEqual(sorted.indexOf(objects[5]), 0);
+        TestCase.assertEqual(sorted.indexOf(objects[0]), 18);
+        TestCase.assertEqual(sorted.indexOf(objects[0]), 18);
+
+        var filtered = sorted.filtered('doubleCol < 10');
+        TestCase.assertEqual(filtered.includes(objects[5]), false);
+        TestCase.assertEqual(filtered.includes(objects[5]), false);
+        TestCase.assertTrue(filtered.includes(objects[4]));
+        TestCase.assertEqual(filtered.includes({doubleCol: 4}), false);
+    },
+
+    testResultsCountAndIsEmpty: function() {
+        var realm = new Realm({schema: [schemas.TestObject, schemas.PersonList, schemas.PersonObject]});
+        var objects = realm.objects('TestObject');
+        var filtered = objects.filtered('doubleCol > 5');
+
+        TestCase.assertTrue(objects.isEmpty());
+        TestCase.assertEqual(filtered.count(), 0);
+        TestCase.assertEqual(realm.count('TestObject'), 0);
+
+        realm.write(function() {
+            for (var i = 0; i < 10; i++) {
+                realm.create('TestObject', {doubleCol: i});
+            }
+        });
+        TestCase.assertEqual(objects.isEmpty(), false);
+        TestCase.assertEqual(filtered.isEmpty(), false);
+        TestCase.assertEqual(filtered.count(), 4);
+        TestCase.assertEqual(filtered.count(), filtered.length);
+        TestCase.assertEqual(realm.count('TestObject'), 10);
+        TestCase.assertEqual(realm.count('TestObject', 'doubleCol > 5'), 4);
+        TestCase.assertEqual(realm.count('TestObject', 'doubleCol > $0', 7), 2);
+        TestCase.assertTrue(objects.filtered('doubleCol > 100').isEmpty());
+
+        // Remembered counts are dropped when the Realm changes.
+        realm.write(function() {
+            realm.create('TestObject', {doubleCol: 50});
+        });
+        TestCase.assertEqual(filtered.count(), 5);
+        TestCase.assertEqual(realm.count('TestObject', 'doubleCol > 5'), 5);
+
+        TestCase.assertThrows(function() {
+            realm.count('NoSuchObject');
+        });
+
+        var list;
+        realm.write(function() {
+            list = realm.create('PersonList', {list: []}).list;
+        });
+        TestCase.assertTrue(list.isEmpty());
+    },
+
+    testResultsToColumns: function() {
+        var realm = new Realm({schema: [schemas.NullableBasicTypes]});
+        var objects = realm.objects('NullableBasicTypesObject');
+
+        realm.write(function() {
+            realm.create('NullableBasicTypesObject', {boolCol: true, intCol: 1, doubleCol: 1.5, stringCol: 'a', dateCol: new Date(1)});
+            realm.create('NullableBasicTypesObject', {});
+            realm.create('NullableBasicTypesObject', {boolCol: false, intCol: 3, doubleCol: 3.5, stringCol: 'c', dateCol: new Date(3)});
+        });
+
+        var columns = objects.toColumns(['intCol', 'doubleCol', 'boolCol', 'stringCol', 'dateCol']);
+        TestCase.assertTrue(columns.intCol instanceof Float64Array);
+        TestCase.assertArraysEqual(Array.from(columns.intCol.filter((v, i) => i != 1)), [1, 3]);
+        TestCase.assertTrue(isNaN(columns.intCol[1]));
+        TestCase.assertArraysEqual(Array.from(columns.doubleCol.filter((v, i) => i != 1)), [1.5, 3.5]);
+        TestCase.assertArraysEqual(columns.boolCol, [true, null, false]);
+        TestCase.assertArraysEqual(columns.stringCol, ['a', null, 'c']);
+        TestCase.assertEqual(columns.dateCol[2], 3);
+
+        columns = objects.filtered('intCol > 1').toColumns(['intCol']);
+        TestCase.assertEqual(columns.intCol.length, 1);
+        TestCase.assertEqual(columns.intCol[0], 3);
+        TestCase.assertEqual(Object.keys(objects.toColumns([])).length, 0);
+
+        TestCase.assertThrows(function() {
+            objects.toColumns(['noSuchColumn']);
+        }, 'invalid property');
+        TestCase.assertThrows(function() {
+            objects.toColumns(['dataCol']);
+        }, 'unsupported property type');
+        TestCase.assertThrows(function() {
+            objects.toColumns('intCol');
+        }, 'properties must be an array');
+    },
+
+    testResultsIndexAfterChanges: function() {
+        var realm = new Realm({schema: [schemas.TestObject, schemas.LinkTypes]});
+        var objects = realm.objects('TestObject').sorted('doubleCol');
+
+        realm.write(function() {
+            for (var i = 0; i < 300; i++) {
+                realm.create('TestObject', {doubleCol: i});
+            }
+        });
+
+        var first = objects[0];
+        TestCase.assertEqual(objects[0].doubleCol, 0);
+        TestCase.assertEqual(objects[299].doubleCol, 299);
+
+        // Wrappers are only reused in-process; the Chrome debugger proxies every read.
+        if (typeof navigator === 'undefined' || !/Chrome/.test(navigator.userAgent)) { // eslint-disable-line no-undef
+            TestCase.assertTrue(objects[0] === first);
+            TestCase.assertTrue(objects[256] !== first);
+        }
+
+        realm.write(function() {
+            realm.delete(first);
+            realm.create('TestObject', {doubleCol: -1});
+        });
+
+        TestCase.assertEqual(first.isValid(), false);
+        TestCase.assertEqual(objects[0].doubleCol, -1);
+        TestCase.assertEqual(objects[1].doubleCol, 1);
+        TestCase.assertEqual(objects[256].doubleCol, 256);
+
+        var list = realm.write(function() {
+            return realm.create('LinkTypesObject', {arrayCol: [{doubleCol: 1}, {doubleCol: 2}]}).arrayCol;
+        });
+        TestCase.assertEqual(list[1].doubleCol, 2);
+        realm.write(function() {
+            list.shift();
+        });
+        TestCase.assertEqual(list[0].doubleCol, 2);
+    },
+
+    testResultsAggregates: function() {
+        var realm = new Realm({schema: [schemas.NullableBasicTypes]});
+        var objects = realm.objects('NullableBasicTypesObject');
+
+        TestCase.assertEqual(objects.min('intCol'), undefined);
+        TestCase.assertEqual(objects.sum('intCol'), 0);
+        TestCase.assertEqual(objects.avg('intCol'), undefined);
+
+        realm.write(function() {
+            realm.create('NullableBasicTypesObject', {stringCol: 'a', intCol: 1, doubleCol: 1.5, dateCol: new Date(1)});
+            realm.create('NullableBasicTypesObject', {stringCol: 'b', intCol: 4});
+            realm.create('NullableBasicTypesObject', {stringCol: 'a', intCol: 3, doubleCol: 3.5, dateCol: new Date(3)});
+            realm.create('NullableBasicTypesObject', {});
+        });
+
+        TestCase.assertEqual(objects.min('intCol'), 1);
+        TestCase.assertEqual(objects.max('intCol'), 4);
+        TestCase.assertEqual(objects.sum('intCol'), 8);
+        TestCase.assertEqual(objects.avg('doubleCol'), 2.5);
+        TestCase.assertEqual(objects.max('dateCol').getTime(), 3);
+        TestCase.assertEqual(objects.filtered('stringCol == "a"').sum('intCol'), 4);
+
+        // Groups are ordered by key, with null first. Joining each [key, value] pair prints null and undefined as ''.
+        var groups = (aggregate, property) => objects.groupBy('stringCol', aggregate, property).map((group) => group.join(':'));
+        TestCase.assertArraysEqual(objects.groupBy('stringCol').map((group) => group.join(':')), [':1', 'a:2', 'b:1']);
+        TestCase.assertArraysEqual(groups('max', 'intCol'), [':', 'a:3', 'b:4']);
+        TestCase.assertArraysEqual(groups('avg', 'doubleCol'), [':', 'a:2.5', 'b:']);
+        TestCase.assertEqual(objects.groupBy('stringCol')[0][0], null);
+
+        TestCase.assertThrows(function() {
+            objects.sum('stringCol');
+        }, 'cannot sum a string property');
+        TestCase.assertThrows(function() {
+            objects.sum('dateCol');
+        }, 'cannot sum a date property');
+        TestCase.assertThrows(function() {
+            objects.min('noSuchColumn');
+        }, 'invalid property');
+        TestCase.assertThrows(function() {
+            objects.groupBy('stringCol', 'sum');
+        }, 'missing aggregated property');
+        TestCase.assertThrows(function() {
+            objects.groupBy('stringCol', 'median', 'intCol');
+        }, 'unknown aggregate');
+        TestCase.assertThrows(function() {
+            objects.groupBy('doubleCol');
+        }, 'cannot group by a double property');
+    },
+
+    testResultsSlice: function() {
+        var realm = new Realm({schema: [schemas.PersonObject]});
+        realm.write(function() {
+            ['Ari', 'Tim', 'Bjarne', 'Alex'].forEach(function(name, index) {
+                realm.create('PersonObject', {name: name, age: index});
+            });
+        });
+        var objects = realm.objects('PersonObject');
+        var names = (array) => array.map((person) => person.name);
+
+        TestCase.assertArraysEqual(names(objects.slice()), ['Ari', 'Tim', 'Bjarne', 'Alex']);
+        TestCase.assertArraysEqual(names(objects.slice(1, 3)), ['Tim', 'Bjarne']);
+        TestCase.assertArraysEqual(names(objects.slice(1, 3, undefined, 'ignored')), ['Tim', 'Bjarne']);
+        TestCase.assertArraysEqual(names(objects.slice(-2)), ['Bjarne', 'Alex']);
+        TestCase.assertArraysEqual(names(objects.slice(3, 1)), []);
+        TestCase.assertArraysEqual(names(objects.slice(NaN, Infinity)), ['Ari', 'Tim', 'Bjarne', 'Alex']);
+        TestCase.assertArraysEqual(names(objects.slice(-Infinity, 1.5)), ['Ari']);
+        TestCase.assertArraysEqual(names(objects.slice(2, -Infinity)), []);
+        TestCase.assertTrue(objects.slice(0, 1)[0] instanceof Realm.Object);
+
+        var rows = objects.sorted('age', true).slice(0, 2, ['name', 'age']);
+        TestCase.assertEqual(rows.length, 2);
+        TestCase.assertEqual(rows[0] instanceof Realm.Object, false);
+        TestCase.assertArraysEqual(Object.keys(rows[0]), ['name', 'age']);
+        TestCase.assertEqual(rows[0].name, 'Alex');
+        TestCase.assertEqual(rows[1].age, 2);
+
+        TestCase.assertThrows(function() {
+            objects.slice(0, 1, ['noSuchProperty']);
+        }, 'invalid property');
+        TestCase.assertThrows(function() {
+            objects.slice(0, 1, 'name');
+        }, 'properties must be an array');
+    },
+
+    testResultsFilteredSortedAsync: function() {
+        var realm = new Realm({schema: [schemas.TestObject]});
+        realm.write(function() {
+            [3, 1, 2].forEach(function(value) {
+                realm.create('TestObject', {doubleCol: value});
+            });
+        });
+        var objects = realm.objects('TestObject');
+
+        return objects.filteredAsync('doubleCol > $0', 1).then(function(filtered) {
+            TestCase.assertTrue(filtered instanceof Realm.Results);
+            TestCase.assertEqual(filtered.length, 2);
+            return filtered.sortedAsync('doubleCol', true);
+        }).then(function(sorted) {
+            TestCase.assertArraysEqual(sorted.map(function(object) { return object.doubleCol; }), [3, 2]);
+            return objects.filteredAsync('invalidProperty == 1').then(function() {
+                throw new Error('filteredAsync should have been rejected');
+            }, function() {});
+        }).then(function() {
+            // Closing the Realm before the first notification rejects the promise instead of leaving it pending.
+            var pending = objects.filteredAsync('doubleCol > 1');
+            realm.close();
+            return pending.then(function() {
+                throw new Error('filteredAsync should have been rejected');
+            }, function(error) {
+                TestCase.assertTrue(error instanceof Error);
+            });
+        });
+    },
+
+    testResultsExportTo: function() {
+        // Reading the exported files back needs the file system of Node.
+        if (typeof process !== 'object' || process + '' !== '[object process]') {
+            return;
+        }
+        var fs = require('fs');
+
+        var realm = new Realm({schema: [schemas.IntPrimary]});
+        realm.write(function() {
+            realm.create('IntPrimaryObject', {primaryCol: 1, valueCol: 'one'});
+            realm.create('IntPrimaryObject', {primaryCol: 2, valueCol: 'two, "quoted"\nlines'});
+            realm.create('IntPrimaryObject', {primaryCol: 3, valueCol: 'three'});
+        });
+        var objects = realm.objects('IntPrimaryObject').filtered('primaryCol < 3').sorted('primaryCol');
+        var jsonPath = realm.path + '.export.json';
+        var csvPath = realm.path + '.export.csv';
+
+        TestCase.assertThrows(function() {
+            objects.exportTo(jsonPath, {properties: ['noSuchProperty']});
+        });
+        TestCase.assertThrows(function() {
+            objects.exportTo(jsonPath, {format: 'xml'});
+        });
+
+        return objects.exportTo(jsonPath).then(function(result) {
+            TestCase.assertEqual(result.rows, 2);
+            var lines = fs.readFileSync(jsonPath, 'utf8').split('\n');
+            TestCase.assertEqual(lines.length, 3);
+            TestCase.assertEqual(lines[2], '');
+            TestCase.assertEqual(JSON.parse(lines[0]).valueCol, 'one');
+            TestCase.assertEqual(JSON.parse(lines[1]).primaryCol, 2);
+            TestCase.assertEqual(JSON.parse(lines[1]).valueCol, 'two, "quoted"\nlines');
+
+            return objects.exportTo(csvPath, {format: 'csv', properties: ['valueCol', 'primaryCol']});
+        }).then(function(result) {
+            TestCase.assertEqual(result.rows, 2);
+            TestCase.assertEqual(fs.readFileSync(csvPath, 'utf8'),
+                                 'valueCol,primaryCol\none,1\n"two, ""quoted""\nlines",2\n');
+            fs.unlinkSync(jsonPath);
+            fs.unlinkSync(csvPath);
+        });
+    },
+
     testAddListener: function() {
         return new Promise((resolve, _reject) => {
             var realm = new Realm({ schema: [schemas.TestObject] });
@@ -443,6 +948,120 @@ module.exports = {
                 realm.create('TestObject', { doubleCol: 1 });
             });
         })
+    },
+
+    testAddListenerFormats: function() {
+        var realm = new Realm({ schema: [schemas.TestObject] });
+        var objects = realm.objects('TestObject');
+
+        TestCase.assertThrows(function() {
+            objects.addListener(function() {}, { format: 'bits' });
+        });
+
+        var typed = new Promise((resolve, _reject) => {
+            objects.addListener((testObjects, changes) => {
+                TestCase.assertTrue(changes.insertions instanceof Uint32Array);
+                TestCase.assertTrue(changes.deletions instanceof Uint32Array);
+                TestCase.assertTrue(changes.modifications instanceof Uint32Array);
+                resolve();
+            }, { format: 'typed' });
+        });
+        var ranges = new Promise((resolve, _reject) => {
+            objects.addListener((testObjects, changes) => {
+                TestCase.assertTrue(Array.isArray(changes.insertions));
+                changes.insertions.forEach((range) => TestCase.assertEqual(range.length, 2));
+                resolve();
+            }, { format: 'ranges' });
+        });
+
+        realm.write(() => {
+            realm.create('TestObject', { doubleCol: 1 });
+        });
+        return Promise.all([typed, ranges]);
+    },
+
+    testAddListenerProperties: function() {
+        var realm = new Realm({ schema: [schemas.BasicTypes] });
+        var objects = realm.objects('BasicTypesObject');
+
+        TestCase.assertThrows(function() {
+            objects.addListener(function() {}, { properties: ['noSuchProperty'] });
+        });
+
+        var object;
+        realm.write(() => {
+            object = realm.create('BasicTypesObject', {
+                boolCol: true, intCol: 1, floatCol: 1, doubleCol: 1, stringCol: 'a', dateCol: new Date(1), dataCol: new ArrayBuffer(1)
+            });
+        });
+
+        return new Promise((resolve, _reject) => {
+            var calls = 0;
+            objects.addListener((collection, changes) => {
+                // The first call is the initial notification, and changing intCol must not notify.
+                if (++calls == 2) {
+                    TestCase.assertArraysEqual(changes.modifications, [0]);
+                    TestCase.assertArraysEqual(changes.modifiedProperties.stringCol, [0]);
+                    TestCase.assertEqual(changes.modifiedProperties.intCol, undefined);
+                    resolve();
+                }
+            }, { properties: ['stringCol'] });
+
+            setTimeout(() => {
+                realm.write(() => {
+                    object.intCol = 2;
+                });
+                setTimeout(() => {
+                    realm.write(() => {
+                        object.stringCol = 'b';
+                    });
+                }, 10);
+            }, 10);
+        });
+    },
+
+    testAddListenerPriority: function() {
+        var realm = new Realm({ schema: [schemas.TestObject] });
+        var objects = realm.objects('TestObject');
+
+        TestCase.assertThrows(function() {
+            objects.addListener(function() {}, { priority: 'urgent' });
+        });
+
+        // The Realm isn't opened with `cacheObjects`, so each listener is on Results of its own, and core would
+        // call them in the order they were added.
+        var calls = [];
+        var insertions = 0;
+        var record = (name) => (collection, changes) => {
+            if (changes.insertions.length) {
+                calls.push(name);
+            }
+            if (name == 'low') {
+                insertions += changes.insertions.length;
+            }
+        };
+        realm.objects('TestObject').addListener(record('low'), { priority: 'low' });
+        realm.objects('TestObject').addListener(record('default'));
+        realm.objects('TestObject').addListener(record('high'), { priority: 'high' });
+
+        return new Promise((resolve, _reject) => {
+            setTimeout(() => {
+                realm.write(() => {
+                    realm.create('TestObject', { doubleCol: 1 });
+                });
+                realm.write(() => {
+                    // Listeners left waiting for the first write's changes are run as the second one begins.
+                    TestCase.assertEqual(insertions, 1);
+                    realm.create('TestObject', { doubleCol: 2 });
+                });
+                setTimeout(() => {
+                    TestCase.assertEqual(calls[0], 'high');
+                    TestCase.assertEqual(calls[calls.length - 1], 'low');
+                    TestCase.assertEqual(insertions, 2);
+                    resolve();
+                }, 100);
+            }, 10);
+        });
     }
     
     
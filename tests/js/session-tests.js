@@ -100,6 +100,15 @@ module.exports = {
         TestCase.assertNull(realm.syncSession);
     },
 
+    testSetLogger() {
+        TestCase.assertThrows(() => Realm.Sync.setLogger('loud', () => {}), 'the level must be valid');
+        TestCase.assertThrows(() => Realm.Sync.setLogger('debug'), 'a callback is required');
+        TestCase.assertThrows(() => Realm.Sync.setLogger('debug', () => {}, 0), 'the buffer must hold a message');
+
+        Realm.Sync.setLogger('debug', (entries, dropped) => {}, 100);
+        Realm.Sync.setLogger(null);
+    },
+
     testProperties() {
         return promisifiedRegister('http://localhost:9080', uuid(), 'password').then(user => {
             return new Promise((resolve, reject) => {
@@ -449,5 +458,51 @@ module.exports = {
                 session._simulateError(123, 'simulated error');
             });
         });
+    },
+
+    testProgressNotificationsForSession() {
+        if (!isNodeProccess) {
+            return Promise.resolve();
+        }
+
+        const username = uuid();
+        const realmName = uuid();
+
+        return runOutOfProcess(__dirname + '/download-api-helper.js', username, realmName, REALM_MODULE_PATH)
+            .then(() => promisifiedLogin('http://localhost:9080', username, 'password'))
+            .then(user => {
+                return new Promise((resolve, reject) => {
+                    const realm = new Realm({
+                        sync: { user, url: `realm://localhost:9080/~/${realmName}` },
+                        schema: [{ name: 'Dog', properties: { name: 'string' } }],
+                    });
+                    const session = realm.syncSession;
+
+                    TestCase.assertThrows(() => session.addProgressNotification('sideways', 'reportIndefinitely', () => {}));
+                    TestCase.assertThrows(() => session.addProgressNotification('download', 'sometimes', () => {}));
+                    TestCase.assertThrows(() => session.addProgressNotification('download', 'reportIndefinitely', () => {}, { minDelta: 2 }));
+
+                    let calls = 0;
+                    const callback = (transferred, transferable) => {
+                        calls++;
+                        try {
+                            TestCase.assertTrue(transferred <= transferable);
+                            if (transferred === transferable) {
+                                // The registration is kept with the session rather than with its JS object.
+                                realm.syncSession.removeProgressNotification(callback);
+                                // Removing twice is harmless.
+                                session.removeProgressNotification(callback);
+                                TestCase.assertTrue(calls >= 1);
+                                realm.close();
+                                resolve();
+                            }
+                        }
+                        catch (e) {
+                            reject(e);
+                        }
+                    };
+                    session.addProgressNotification('download', 'forCurrentlyOutstandingWork', callback, { minInterval: 100, minDelta: 0.25 });
+                });
+            });
     }
 }